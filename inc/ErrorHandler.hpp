@@ -123,7 +123,16 @@ public:
 		 * The length of the provided data exceeds the maximum number of events allowed.
 		 * This error occurs when attempting to process more events than the system can handle.
 		 */
-		LengthExceedsNumberOfEvents = 22
+		LengthExceedsNumberOfEvents = 22,
+		/**
+		 * A snapshot of the time-based schedule does not fit in its journal, so a change of the schedule is not
+		 * journaled (ST[11]). It is reported for every change until a snapshot fits.
+		 */
+		ScheduleJournalIsFull = 23,
+		/**
+		 * All the buffers of a message pool are taken, and none could be made available for a new message
+		 */
+		MessagePoolExhausted = 24,
 	};
 
 	/**
@@ -431,6 +440,101 @@ public:
 		 * PMON Check Type is requested, but it is missing (ST[12])
 		 */
 		 PMONCheckTypeMissing = 63,
+		/**
+		 * Attempt to add a parameter monitoring definition with an ID outside the range of PMON IDs (ST[12])
+		 */
+		PMONIdOutOfRange = 64,
+		/**
+		 * Attempt to access a functional monitoring definition that does not exist (ST[12])
+		 */
+		GetNonExistingFunctionalMonitoringDefinition = 65,
+		/**
+		 * Attempt to add a functional monitoring definition with an ID that is already used (ST[12])
+		 */
+		AddAlreadyExistingFunctionalMonitoringDefinition = 66,
+		/**
+		 * Attempt to add a functional monitoring definition, but the functional monitoring list is full (ST[12])
+		 */
+		FunctionalMonitoringListIsFull = 67,
+		/**
+		 * Attempt to add a functional monitoring definition with an ID out of range, an invalid minimum number of
+		 * failing PMONs, or a list of PMONs that is too long, repeats a PMON or refers to a non-existing one (ST[12])
+		 */
+		InvalidFunctionalMonitoringDefinition = 68,
+		/**
+		 * Attempt to delete a functional monitoring definition that is enabled or protected (ST[12])
+		 */
+		InvalidRequestToDeleteFunctionalMonitoringDefinition = 69,
+		/**
+		 * Attempt to store the request of a scheduled activity or of an event-action definition, but there is not
+		 * enough space left for its packet (ST[11], ST[19])
+		 */
+		TelecommandStorageIsFull = 70,
+		/**
+		 * Attempt to refer to a sub-schedule of the time-based schedule that does not exist (ST[11])
+		 */
+		InvalidSubScheduleId = 71,
+		/**
+		 * Attempt to refer to a group of the time-based schedule that does not exist, or to delete the default group
+		 * (ST[11])
+		 */
+		InvalidSchedulingGroupId = 72,
+		/**
+		 * Attempt to create a group of the time-based schedule that already exists (ST[11])
+		 */
+		SchedulingGroupAlreadyExists = 73,
+		/**
+		 * Attempt to delete a group of the time-based schedule that still has scheduled activities (ST[11])
+		 */
+		SchedulingGroupIsNotEmpty = 74,
+		/**
+		 * Attempt to add an event-action definition whose request is not a valid TC packet (ST[19])
+		 */
+		InvalidEventActionRequest = 75,
+		/**
+		 * Attempt to enable or disable the report generation, or the forwarding, of an event definition that is not in
+		 * the event catalogue (ST[05], ST[14])
+		 */
+		UnknownEventDefinitionId = 76,
+		/**
+		 * Attempt to set the rate limit of an event when the maximum number of rate-limited events has been reached
+		 * (ST[05])
+		 */
+		EventRateLimitsAreFull = 77,
+		/**
+		 * Attempt to set a rate limit of an unknown type, with no burst, or with an interval that is not a multiple of
+		 * the time resolution (ST[05])
+		 */
+		InvalidEventRateLimit = 78,
+		/**
+		 * Attempt to add a housekeeping parameter report structure to the forwarding configuration with a
+		 * subsampling rate of 0 (ST[14])
+		 */
+		InvalidSubsamplingRate = 79,
+		/**
+		 * Attempt to add a housekeeping parameter report structure, when the max number of structures per
+		 * application process in the Housekeeping Parameter Report configuration is already reached (ST[14])
+		 */
+		MaxHousekeepingStructuresReached = 80,
+		/**
+		 * Attempt to access a non-existing housekeeping parameter report structure definition, from the
+		 * Housekeeping Parameter Report configuration (ST[14])
+		 */
+		NonExistentHousekeepingStructureDefinition = 81,
+		/**
+		 * Attempt to block an event definition, when the max number of event definitions per application process in
+		 * the Event Report Blocking configuration is already reached (ST[14])
+		 */
+		MaxEventDefinitionsReached = 82,
+		/**
+		 * Attempt to access a non-existing event definition, from the Event Report Blocking configuration (ST[14])
+		 */
+		NonExistentEventDefinition = 83,
+		/**
+		 * Attempt to set a sliding window of a statistic that cannot hold all the samples taken during its length, or
+		 * when sliding-window statistics are not supported (ST[04])
+		 */
+		InvalidStatisticsWindowLength = 84,
 	};
 
 	/**
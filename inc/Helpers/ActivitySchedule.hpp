@@ -0,0 +1,311 @@
+#ifndef ECSS_SERVICES_ACTIVITYSCHEDULE_HPP
+#define ECSS_SERVICES_ACTIVITYSCHEDULE_HPP
+
+#include <cstdint>
+#include "etl/algorithm.h"
+#include "etl/array.h"
+
+/**
+ * Fixed-capacity schedule of activities, ordered by their release time.
+ *
+ * The activities are stored in place in a preallocated pool, and never move, so they are referred to by their
+ * @ref Index in the pool. The release order is kept in an indexed binary min-heap of pool indices: every entry knows
+ * its position in the heap, so that inserting, deleting and retiming any activity are O(log n), and the earliest
+ * activity is always at the front. Activities with the same release time are released in insertion order.
+ *
+ * @tparam Activity The type of the scheduled activities. It must be default constructible and have a
+ * requestReleaseTime member.
+ * @tparam Capacity The maximum number of scheduled activities
+ */
+template <typename Activity, size_t Capacity>
+class ActivitySchedule {
+public:
+	using Index = uint32_t;
+
+	/**
+	 * Index that no activity can have, returned when there is no activity to refer to
+	 */
+	static constexpr Index NoActivity = UINT32_MAX;
+
+private:
+	struct Entry {
+		Activity activity;
+
+		/**
+		 * The insertion order of the activity, which breaks ties between equal release times
+		 */
+		uint32_t sequence = 0;
+
+		/**
+		 * The position of the entry in @ref heap, or @ref NoActivity if the entry is free
+		 */
+		Index heapPosition = NoActivity;
+
+		/**
+		 * The next free entry, if the entry is free
+		 */
+		Index nextFree = NoActivity;
+	};
+
+	etl::array<Entry, Capacity> entries;
+
+	/**
+	 * The indices of the scheduled activities, as a binary min-heap ordered by release time
+	 */
+	etl::array<Index, Capacity> heap;
+
+	Index heapSize = 0;
+	Index firstFree = 0;
+	uint32_t nextSequence = 0;
+
+	void place(Index position, Index index) {
+		heap[position] = index;
+		entries[index].heapPosition = position;
+	}
+
+	void siftUp(Index position) {
+		const Index index = heap[position];
+		while (position > 0) {
+			const Index parent = (position - 1) / 2;
+			if (not isReleasedBefore(index, heap[parent])) {
+				break;
+			}
+			place(position, heap[parent]);
+			position = parent;
+		}
+		place(position, index);
+	}
+
+	void siftDown(Index position) {
+		const Index index = heap[position];
+		while (true) {
+			Index child = 2 * position + 1;
+			if (child >= heapSize) {
+				break;
+			}
+			if (child + 1 < heapSize and isReleasedBefore(heap[child + 1], heap[child])) {
+				child++;
+			}
+			if (not isReleasedBefore(heap[child], index)) {
+				break;
+			}
+			place(position, heap[child]);
+			position = child;
+		}
+		place(position, index);
+	}
+
+	/**
+	 * Restores the heap order after the release time of the activity at a position has changed
+	 */
+	void restore(Index position) {
+		if (position > 0 and isReleasedBefore(heap[position], heap[(position - 1) / 2])) {
+			siftUp(position);
+		} else {
+			siftDown(position);
+		}
+	}
+
+public:
+	ActivitySchedule() {
+		clear();
+	}
+
+	/**
+	 * @return true if the activity at index a is released before the one at index b
+	 */
+	bool isReleasedBefore(Index a, Index b) const {
+		const Entry& first = entries[a];
+		const Entry& second = entries[b];
+		if (first.activity.requestReleaseTime < second.activity.requestReleaseTime) {
+			return true;
+		}
+		return first.activity.requestReleaseTime == second.activity.requestReleaseTime and
+		       first.sequence < second.sequence;
+	}
+
+	/**
+	 * Adds a copy of an activity to the schedule.
+	 *
+	 * @return The index of the stored activity, or @ref NoActivity if the schedule is full
+	 */
+	Index insert(const Activity& activity) {
+		if (full()) {
+			return NoActivity;
+		}
+
+		const Index index = firstFree;
+		Entry& entry = entries[index];
+		firstFree = entry.nextFree;
+		entry.activity = activity;
+		entry.sequence = nextSequence++;
+
+		place(heapSize, index);
+		heapSize++;
+		siftUp(heapSize - 1);
+		return index;
+	}
+
+	/**
+	 * Adds a copy of an activity at a given index, e.g. to rebuild a schedule with the indices it had before. The free
+	 * indices are not tracked in the meantime, so @ref rebuildFreeList must be called before the next @ref insert.
+	 *
+	 * @return false if the index is out of range or already taken
+	 */
+	bool insertAt(Index index, const Activity& activity) {
+		if (index >= Capacity or entries[index].heapPosition != NoActivity) {
+			return false;
+		}
+
+		Entry& entry = entries[index];
+		entry.activity = activity;
+		entry.sequence = nextSequence++;
+
+		place(heapSize, index);
+		heapSize++;
+		siftUp(heapSize - 1);
+		return true;
+	}
+
+	/**
+	 * Collects the free indices again, after activities have been added by @ref insertAt.
+	 */
+	void rebuildFreeList() {
+		firstFree = NoActivity;
+		for (Index index = Capacity; index-- > 0;) {
+			if (entries[index].heapPosition == NoActivity) {
+				entries[index].nextFree = firstFree;
+				firstFree = index;
+			}
+		}
+	}
+
+	/**
+	 * Removes an activity from the schedule. Its index may be reused by later insertions.
+	 */
+	void remove(Index index) {
+		if (get(index) == nullptr) {
+			return;
+		}
+
+		const Index position = entries[index].heapPosition;
+		heapSize--;
+		if (position != heapSize) {
+			place(position, heap[heapSize]);
+			restore(position);
+		}
+
+		Entry& entry = entries[index];
+		entry.heapPosition = NoActivity;
+		entry.nextFree = firstFree;
+		firstFree = index;
+	}
+
+	/**
+	 * Changes the release time of an activity.
+	 */
+	template <typename Time>
+	void retime(Index index, const Time& releaseTime) {
+		if (get(index) == nullptr) {
+			return;
+		}
+		entries[index].activity.requestReleaseTime = releaseTime;
+		restore(entries[index].heapPosition);
+	}
+
+	/**
+	 * Moves the release times of all the activities by the same offset. The release order does not change, so this
+	 * is O(n) without any reordering.
+	 */
+	template <typename Duration>
+	void shiftAll(const Duration& offset) {
+		for (Index position = 0; position < heapSize; position++) {
+			entries[heap[position]].activity.requestReleaseTime += offset;
+		}
+	}
+
+	/**
+	 * @return The activity stored at an index, or nullptr if there is none
+	 */
+	Activity* get(Index index) {
+		if (index >= Capacity or entries[index].heapPosition == NoActivity) {
+			return nullptr;
+		}
+		return &entries[index].activity;
+	}
+
+	/**
+	 * @return The index of the activity that is released first, or @ref NoActivity if the schedule is empty
+	 */
+	Index front() const {
+		return (heapSize == 0) ? NoActivity : heap[0];
+	}
+
+	/**
+	 * Removes the activity that is released first.
+	 */
+	void popFront() {
+		remove(front());
+	}
+
+	/**
+	 * Removes all the activities.
+	 */
+	void clear() {
+		for (Index index = 0; index < Capacity; index++) {
+			entries[index].heapPosition = NoActivity;
+			entries[index].nextFree = (index + 1 < Capacity) ? index + 1 : NoActivity;
+		}
+		firstFree = (Capacity > 0) ? 0 : NoActivity;
+		heapSize = 0;
+	}
+
+	/**
+	 * Calls function(index, activity) for every scheduled activity, in no particular order.
+	 */
+	template <typename Function>
+	void forEach(Function&& function) {
+		for (Index position = 0; position < heapSize; position++) {
+			function(heap[position], entries[heap[position]].activity);
+		}
+	}
+
+	/**
+	 * Calls function(index, activity) for every scheduled activity, in release order.
+	 *
+	 * The heap is sorted in place first, which is O(n log n). A sorted array is also a valid heap, so the schedule
+	 * needs no further reordering.
+	 */
+	template <typename Function>
+	void forEachInReleaseOrder(Function&& function) {
+		etl::sort(heap.begin(), heap.begin() + heapSize, [this](Index a, Index b) {
+			return isReleasedBefore(a, b);
+		});
+		for (Index position = 0; position < heapSize; position++) {
+			entries[heap[position]].heapPosition = position;
+		}
+		forEach(function);
+	}
+
+	size_t size() const {
+		return heapSize;
+	}
+
+	bool empty() const {
+		return heapSize == 0;
+	}
+
+	bool full() const {
+		return heapSize == Capacity;
+	}
+
+	size_t available() const {
+		return Capacity - heapSize;
+	}
+
+	static constexpr size_t capacity() {
+		return Capacity;
+	}
+};
+
+#endif // ECSS_SERVICES_ACTIVITYSCHEDULE_HPP
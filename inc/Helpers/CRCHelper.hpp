@@ -2,6 +2,7 @@
 #define ECSS_SERVICES_CRCHELPER_HPP
 
 #include <cstdint>
+#include "etl/array.h"
 
 class CRCHelper {
 	/**
@@ -21,22 +22,39 @@ private:
 	/**
 	 * shift register contains all 1's initially (ECSS-E-ST-70-41C, Annex B - CRC and ISO checksum)
 	 */
-	inline static const uint16_t InitialShiftRegisterValue = 0xFFFFU;
+	inline static constexpr uint16_t InitialShiftRegisterValue = 0xFFFFU;
 	// TODO (#204): Change this to hardware implementation or a trusted software one
 	/**
 	 * CRC16-CCITT generator polynomial (as specified in standard)
 	 */
-	inline static const uint16_t Polynomial = 0x1021U;
+	inline static constexpr uint16_t Polynomial = 0x1021U;
 	/**
 	 * MSB mask (for shifting)
 	 * if the MSB is set, the bitwise AND gives 1
 	 */
-	inline static const uint16_t MSBMask = 0x8000U;
+	inline static constexpr uint16_t MSBMask = 0x8000U;
 
 	/**
 	* Number of bits in a byte
 	 */
-	inline static const uint16_t BitNumber = 8U;
+	inline static constexpr uint16_t BitNumber = 8U;
+
+	/**
+	 * The remainder of the division of every byte value, shifted into the MSB of the register, by the generator, so
+	 * that the CRC is calculated one byte at a time instead of one bit at a time
+	 */
+	static constexpr etl::array<uint16_t, 256> Table = [] {
+		etl::array<uint16_t, 256> table{};
+		for (uint16_t byte = 0; byte < 256; byte++) {
+			uint16_t shiftReg = byte << BitNumber;
+			for (uint16_t bit = 0; bit < BitNumber; bit++) {
+				// if the MSB is set, toss it out of the register and divide (XOR) its content with the generator
+				shiftReg = ((shiftReg & MSBMask) != 0U) ? ((shiftReg << 1U) ^ Polynomial) : (shiftReg << 1U);
+			}
+			table[byte] = shiftReg;
+		}
+		return table;
+	}();
 
 public:
 	/**
@@ -0,0 +1,131 @@
+#ifndef ECSS_SERVICES_DUESCHEDULE_HPP
+#define ECSS_SERVICES_DUESCHEDULE_HPP
+
+#include <cstddef>
+#include "Time/TimeStamp.hpp"
+#include "etl/algorithm.h"
+#include "etl/vector.h"
+
+/**
+ * Fixed-capacity schedule of the times at which periodic jobs are due, e.g. the checks of the ST[12] PMON definitions
+ * or the samples of the ST[4] statistics definitions.
+ *
+ * The entries are kept in a binary min-heap ordered by due time, so that the next due job is found in O(1) and taken
+ * or added in O(log n). Entries are never searched for and removed. Instead, the owner of the schedule keeps the due
+ * time of the current entry of every job, and passes a predicate that tells whether an entry is still current.
+ * Deleting or rescheduling a job only makes its previous entry outdated, and outdated entries are dropped when they
+ * reach the front, or all at once when the heap fills up. Twice as many entries as jobs should be kept, so that
+ * purging the outdated entries always frees at least half of the heap.
+ *
+ * @tparam Key The identifier of a job
+ * @tparam Capacity The maximum number of entries
+ */
+template <typename Key, size_t Capacity>
+class DueSchedule {
+public:
+	struct Entry {
+		Time::DefaultCUC dueTime;
+		Key key;
+	};
+
+private:
+	etl::vector<Entry, Capacity> entries;
+
+	/**
+	 * Heap comparator, placing the earliest entry at the front
+	 */
+	static bool isDueLater(const Entry& lhs, const Entry& rhs) {
+		return rhs.dueTime < lhs.dueTime;
+	}
+
+	void popFront() {
+		etl::pop_heap(entries.begin(), entries.end(), isDueLater);
+		entries.pop_back();
+	}
+
+public:
+	/**
+	 * Adds an entry for a job. The owner of the schedule is expected to record dueTime as the current due time of the
+	 * job, so that any previous entry of the job becomes outdated.
+	 *
+	 * @param isCurrent Returns whether an entry is current, used to purge the outdated entries if the heap is full
+	 */
+	template <typename IsCurrent>
+	void schedule(const Key& key, const Time::DefaultCUC& dueTime, IsCurrent isCurrent) {
+		if (entries.full()) {
+			purge(isCurrent);
+		}
+
+		entries.push_back({dueTime, key});
+		etl::push_heap(entries.begin(), entries.end(), isDueLater);
+	}
+
+	/**
+	 * Takes the earliest current entry that is due at currentTime, dropping the outdated entries before it
+	 *
+	 * @param[out] dueEntry The entry that was taken
+	 * @return false if no current entry is due
+	 */
+	template <typename IsCurrent>
+	bool takeDue(const Time::DefaultCUC& currentTime, IsCurrent isCurrent, Entry& dueEntry) {
+		while (not entries.empty() and entries.front().dueTime <= currentTime) {
+			dueEntry = entries.front();
+			popFront();
+			if (isCurrent(dueEntry)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Finds the due time of the earliest current entry, dropping the outdated entries before it
+	 *
+	 * @param[out] dueTime The due time of the earliest current entry
+	 * @return false if there is no current entry
+	 */
+	template <typename IsCurrent>
+	bool nextDueTime(IsCurrent isCurrent, Time::DefaultCUC& dueTime) {
+		while (not entries.empty() and not isCurrent(entries.front())) {
+			popFront();
+		}
+		if (entries.empty()) {
+			return false;
+		}
+		dueTime = entries.front().dueTime;
+		return true;
+	}
+
+	/**
+	 * Removes all the outdated entries
+	 */
+	template <typename IsCurrent>
+	void purge(IsCurrent isCurrent) {
+		auto outdatedEntries = etl::remove_if(entries.begin(), entries.end(), [&isCurrent](const Entry& entry) {
+			return not isCurrent(entry);
+		});
+		entries.erase(outdatedEntries, entries.end());
+		etl::make_heap(entries.begin(), entries.end(), isDueLater);
+	}
+
+	void clear() {
+		entries.clear();
+	}
+
+	bool empty() const {
+		return entries.empty();
+	}
+
+	/**
+	 * @return The number of entries, including the outdated ones that have not been dropped yet
+	 */
+	size_t size() const {
+		return entries.size();
+	}
+
+	static constexpr size_t capacity() {
+		return Capacity;
+	}
+};
+
+#endif // ECSS_SERVICES_DUESCHEDULE_HPP
@@ -0,0 +1,253 @@
+#ifndef ECSS_SERVICES_FMON_HPP
+#define ECSS_SERVICES_FMON_HPP
+
+#include <cstdint>
+#include "ECSS_Definitions.hpp"
+#include "Helpers/SlotPool.hpp"
+#include "Helpers/TypeDefinitions.hpp"
+#include "etl/array.h"
+#include "etl/vector.h"
+
+/**
+ * A functional monitoring definition, as defined in 5.12.4 of ECSS-E-ST-70-41C. It combines several parameter
+ * monitoring definitions, and fails once at least @ref minimumFailingPMONs of them have a failing confirmed
+ * Checking Status (see @ref PMON::isFailingStatus).
+ */
+class FMON {
+public:
+	enum class CheckingStatus : uint8_t {
+		Running = 1,
+		Failed = 2
+	};
+
+	FMONId id = 0;
+
+	/**
+	 * The event that is raised when the definition fails.
+	 */
+	EventDefinitionId eventDefinitionId = 0;
+
+	/**
+	 * The number of failing PMONs that makes this definition fail.
+	 */
+	uint16_t minimumFailingPMONs = 1;
+
+	/**
+	 * The parameter monitoring definitions combined by this definition.
+	 */
+	etl::vector<ParameterId, ECSSMaxPMONsPerFMON> PMONIds;
+
+	/**
+	 * If false, a failure of this definition does not raise its event.
+	 */
+	bool enabled = false;
+
+	/**
+	 * A protected definition cannot be deleted.
+	 */
+	bool isProtected = false;
+
+	/**
+	 * The number of PMONs in @ref PMONIds whose confirmed Checking Status is currently failing.
+	 */
+	uint16_t failingPMONs = 0;
+
+	CheckingStatus checkingStatus = CheckingStatus::Running;
+};
+
+/**
+ * Storage of functional monitoring definitions, together with an index from every PMON to the FMONs that combine it.
+ *
+ * The FMONs are never rescanned. Whenever the confirmed Checking Status of a PMON switches between failing and not
+ * failing, @ref updatePMONStatus walks only the FMONs that depend on that PMON and updates their failing counters, so
+ * the cost of a transition is proportional to the number of FMONs that use the PMON.
+ *
+ * @tparam MaxFMONs The maximum number of stored definitions
+ * @tparam FMONIdRange The number of valid FMON IDs
+ * @tparam PMONIdRange The number of valid PMON IDs
+ */
+template <size_t MaxFMONs, size_t FMONIdRange, size_t PMONIdRange>
+class FMONList {
+	/**
+	 * Index of a link that does not exist, terminating the link lists.
+	 */
+	static constexpr uint32_t NoLink = UINT32_MAX;
+
+	static constexpr size_t MaxLinks = MaxFMONs * ECSSMaxPMONsPerFMON;
+
+	/**
+	 * Entry of the PMON to FMON index, stating that an FMON depends on a PMON.
+	 */
+	struct Link {
+		SlotHandle fmon;
+		uint32_t next = NoLink;
+	};
+
+	SlotPool<FMON, sizeof(FMON), MaxFMONs> definitions;
+
+	/**
+	 * The handle of the definition with each FMON ID, indexed by the FMON ID.
+	 */
+	etl::array<SlotHandle, FMONIdRange> handles;
+
+	etl::array<Link, MaxLinks> links;
+
+	/**
+	 * The first link of the list of the FMONs that depend on each PMON, indexed by the PMON ID.
+	 */
+	etl::array<uint32_t, PMONIdRange> firstLinks;
+
+	/**
+	 * The first link of the list of unused links.
+	 */
+	uint32_t firstFreeLink = 0;
+
+	void linkPMON(ParameterId PMONId, SlotHandle fmon) {
+		const uint32_t link = firstFreeLink;
+		firstFreeLink = links[link].next;
+		links[link] = {fmon, firstLinks[PMONId]};
+		firstLinks[PMONId] = link;
+	}
+
+	void unlinkPMON(ParameterId PMONId, SlotHandle fmon) {
+		uint32_t* previousNext = &firstLinks[PMONId];
+		while (*previousNext != NoLink) {
+			const uint32_t link = *previousNext;
+			if (links[link].fmon == fmon) {
+				*previousNext = links[link].next;
+				links[link].next = firstFreeLink;
+				firstFreeLink = link;
+				return;
+			}
+			previousNext = &links[link].next;
+		}
+	}
+
+public:
+	FMONList() {
+		clear();
+	}
+
+	/**
+	 * @return The definition with the given ID, or nullptr if there is none
+	 */
+	FMON* find(FMONId id) {
+		if (id >= FMONIdRange) {
+			return nullptr;
+		}
+		return definitions.get(handles[id]);
+	}
+
+	/**
+	 * Stores a new definition and links it to its PMONs. The definition is expected to be valid, i.e. to have an ID
+	 * in range that is not used yet, and distinct PMON IDs in range.
+	 *
+	 * @param isPMONFailing Called with every PMON ID of the definition, returning whether the PMON is currently
+	 * failing, to initialise the failing counter.
+	 * @return false if there is no room for the definition
+	 */
+	template <typename IsPMONFailing>
+	bool add(const FMON& fmon, IsPMONFailing&& isPMONFailing) {
+		const SlotHandle handle = definitions.template emplace<FMON>(fmon);
+		if (not handle.isValid()) {
+			return false;
+		}
+
+		FMON& definition = *definitions.get(handle);
+		definition.failingPMONs = 0;
+		for (const ParameterId PMONId: definition.PMONIds) {
+			linkPMON(PMONId, handle);
+			if (isPMONFailing(PMONId)) {
+				definition.failingPMONs++;
+			}
+		}
+		definition.checkingStatus = (definition.failingPMONs >= definition.minimumFailingPMONs) ? FMON::CheckingStatus::Failed : FMON::CheckingStatus::Running;
+
+		handles[definition.id] = handle;
+		return true;
+	}
+
+	/**
+	 * Deletes a definition and unlinks it from its PMONs.
+	 */
+	void remove(FMONId id) {
+		FMON* definition = find(id);
+		if (definition == nullptr) {
+			return;
+		}
+
+		for (const ParameterId PMONId: definition->PMONIds) {
+			unlinkPMON(PMONId, handles[id]);
+		}
+		definitions.release(handles[id]);
+		handles[id] = {};
+	}
+
+	/**
+	 * Deletes all the definitions.
+	 */
+	void clear() {
+		definitions.clear();
+		handles.fill({});
+		firstLinks.fill(NoLink);
+		for (uint32_t link = 0; link < MaxLinks; link++) {
+			links[link].next = (link + 1 < MaxLinks) ? link + 1 : NoLink;
+		}
+		firstFreeLink = (MaxLinks > 0) ? 0 : NoLink;
+	}
+
+	/**
+	 * @return true if at least one definition combines the PMON
+	 */
+	bool isPMONUsed(ParameterId PMONId) const {
+		return PMONId < PMONIdRange and firstLinks[PMONId] != NoLink;
+	}
+
+	/**
+	 * Updates the FMONs that depend on a PMON whose confirmed Checking Status changed.
+	 *
+	 * @param onFailure Called with every FMON that fails because of this change
+	 */
+	template <typename OnFailure>
+	void updatePMONStatus(ParameterId PMONId, bool wasFailing, bool isFailing, OnFailure&& onFailure) {
+		if (wasFailing == isFailing or PMONId >= PMONIdRange) {
+			return;
+		}
+
+		for (uint32_t link = firstLinks[PMONId]; link != NoLink; link = links[link].next) {
+			FMON& fmon = *definitions.get(links[link].fmon);
+			if (isFailing) {
+				fmon.failingPMONs++;
+				if (fmon.failingPMONs >= fmon.minimumFailingPMONs and fmon.checkingStatus == FMON::CheckingStatus::Running) {
+					fmon.checkingStatus = FMON::CheckingStatus::Failed;
+					onFailure(fmon);
+				}
+			} else {
+				fmon.failingPMONs--;
+				if (fmon.failingPMONs < fmon.minimumFailingPMONs) {
+					fmon.checkingStatus = FMON::CheckingStatus::Running;
+				}
+			}
+		}
+	}
+
+	/**
+	 * Calls function(fmon) for every stored definition.
+	 */
+	template <typename Function>
+	void forEach(Function&& function) {
+		definitions.forEach([&function](SlotHandle /* handle */, FMON& fmon) {
+			function(fmon);
+		});
+	}
+
+	size_t size() const {
+		return definitions.size();
+	}
+
+	bool full() const {
+		return definitions.full();
+	}
+};
+
+#endif // ECSS_SERVICES_FMON_HPP
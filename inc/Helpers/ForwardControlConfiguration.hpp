@@ -4,6 +4,9 @@
 #include "ECSS_Definitions.hpp"
 #include "ErrorHandler.hpp"
 #include "Helpers/Parameter.hpp"
+#include "Helpers/TypeDefinitions.hpp"
+#include "Helpers/WordBitset.hpp"
+#include "etl/array.h"
 #include "etl/map.h"
 #include "etl/vector.h"
 
@@ -45,4 +48,109 @@ public:
 	ApplicationProcessConfiguration() = default;
 };
 
+/**
+ * The Housekeeping Parameter Report configuration. It contains, for each application process, the housekeeping
+ * parameter report structures whose reports are forwarded to the ground station, each with a subsampling rate: only
+ * one in every 'subsampling rate' reports of a structure is forwarded.
+ *
+ * The structures of an application process are stored densely, indexed by their ID, so that checking a report takes a
+ * single lookup.
+ */
+class HousekeepingReportConfiguration {
+public:
+	/**
+	 * The number of possible housekeeping parameter report structure IDs
+	 */
+	static constexpr size_t NumberOfStructureIds = 1U << (8 * sizeof(ParameterReportStructureId));
+
+	struct ApplicationDefinition {
+		ApplicationProcessId applicationID = 0;
+
+		/**
+		 * The subsampling rate of each structure, or 0 if the reports of the structure are not forwarded
+		 */
+		etl::array<uint16_t, NumberOfStructureIds> subsamplingRates{};
+
+		/**
+		 * The number of reports of each structure that have been generated since the last forwarded one
+		 */
+		etl::array<uint16_t, NumberOfStructureIds> reportCounters{};
+
+		/**
+		 * The number of structures with a subsampling rate
+		 */
+		uint8_t numberOfStructures = 0;
+	};
+
+	etl::vector<ApplicationDefinition, ECSSMaxControlledApplicationProcesses> definitions;
+
+	/**
+	 * @return The definition of an application process, or nullptr if it has none
+	 */
+	ApplicationDefinition* find(ApplicationProcessId applicationID) {
+		for (auto& definition: definitions) {
+			if (definition.applicationID == applicationID) {
+				return &definition;
+			}
+		}
+		return nullptr;
+	}
+
+	/**
+	 * Deletes the definition of an application process, if it has one
+	 */
+	void erase(ApplicationProcessId applicationID) {
+		for (auto definition = definitions.begin(); definition != definitions.end(); definition++) {
+			if (definition->applicationID == applicationID) {
+				definitions.erase(definition);
+				return;
+			}
+		}
+	}
+};
+
+/**
+ * The Event Report Blocking configuration. It contains, for each application process, the event definitions whose
+ * reports are not forwarded to the ground station, as a bitset indexed by the event definition ID.
+ */
+class EventReportBlockingConfiguration {
+public:
+	struct ApplicationDefinition {
+		ApplicationProcessId applicationID = 0;
+
+		WordBitset<ECSSEventCatalogueSize> blockedEvents;
+
+		/**
+		 * The number of event definitions that are blocked
+		 */
+		uint8_t numberOfEvents = 0;
+	};
+
+	etl::vector<ApplicationDefinition, ECSSMaxControlledApplicationProcesses> definitions;
+
+	/**
+	 * @return The definition of an application process, or nullptr if it has none
+	 */
+	ApplicationDefinition* find(ApplicationProcessId applicationID) {
+		for (auto& definition: definitions) {
+			if (definition.applicationID == applicationID) {
+				return &definition;
+			}
+		}
+		return nullptr;
+	}
+
+	/**
+	 * Deletes the definition of an application process, if it has one
+	 */
+	void erase(ApplicationProcessId applicationID) {
+		for (auto definition = definitions.begin(); definition != definitions.end(); definition++) {
+			if (definition->applicationID == applicationID) {
+				definitions.erase(definition);
+				return;
+			}
+		}
+	}
+};
+
 #endif
@@ -0,0 +1,128 @@
+#ifndef ECSS_SERVICES_HASHINDEX_HPP
+#define ECSS_SERVICES_HASHINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "etl/array.h"
+
+/**
+ * Fixed-capacity index from keys to values, e.g. to find stored objects by an identifier without scanning them.
+ *
+ * The entries live in an open-addressing hash table with linear probing, with at least twice as many slots as
+ * entries, so that lookups, insertions and removals are O(1) on average. Removals shift the following entries of the
+ * probe sequence back, instead of leaving tombstones, so lookups do not degrade over time. The same key may be
+ * inserted several times with different values.
+ *
+ * @tparam Key The type of the keys. It must be comparable with ==.
+ * @tparam Value The type of the values
+ * @tparam Capacity The maximum number of entries
+ * @tparam Hash A function object that returns the hash of a key as a uint32_t
+ */
+template <typename Key, typename Value, size_t Capacity, typename Hash>
+class HashIndex {
+	/**
+	 * The number of slots, the smallest power of two that is at least twice the capacity
+	 */
+	static constexpr size_t TableSize = [] {
+		size_t size = 1;
+		while (size < 2 * Capacity) {
+			size *= 2;
+		}
+		return size;
+	}();
+
+	struct Slot {
+		Key key;
+		Value value;
+		bool occupied = false;
+	};
+
+	etl::array<Slot, TableSize> slots;
+	size_t entries = 0;
+
+	static size_t home(const Key& key) {
+		return Hash()(key) & (TableSize - 1);
+	}
+
+	static size_t next(size_t slot) {
+		return (slot + 1) & (TableSize - 1);
+	}
+
+public:
+	/**
+	 * Adds an entry to the index.
+	 *
+	 * @return false if the index is full
+	 */
+	bool insert(const Key& key, const Value& value) {
+		if (full()) {
+			return false;
+		}
+		size_t slot = home(key);
+		while (slots[slot].occupied) {
+			slot = next(slot);
+		}
+		slots[slot] = {key, value, true};
+		entries++;
+		return true;
+	}
+
+	/**
+	 * Removes the entry with both a key and a value, if there is one.
+	 *
+	 * @return false if there was no such entry
+	 */
+	bool erase(const Key& key, const Value& value) {
+		size_t slot = home(key);
+		while (slots[slot].occupied and not(slots[slot].key == key and slots[slot].value == value)) {
+			slot = next(slot);
+		}
+		if (not slots[slot].occupied) {
+			return false;
+		}
+
+		// Move back every following entry whose home slot is not between the hole and the entry itself
+		size_t hole = slot;
+		for (size_t candidate = next(hole); slots[candidate].occupied; candidate = next(candidate)) {
+			const size_t candidateHome = home(slots[candidate].key);
+			const bool canMove = (hole <= candidate) ? (candidateHome <= hole or candidateHome > candidate)
+			                                          : (candidateHome <= hole and candidateHome > candidate);
+			if (canMove) {
+				slots[hole] = slots[candidate];
+				hole = candidate;
+			}
+		}
+		slots[hole].occupied = false;
+		entries--;
+		return true;
+	}
+
+	/**
+	 * Calls function(value) for every entry with a key.
+	 */
+	template <typename Function>
+	void forEachMatch(const Key& key, Function&& function) const {
+		for (size_t slot = home(key); slots[slot].occupied; slot = next(slot)) {
+			if (slots[slot].key == key) {
+				function(slots[slot].value);
+			}
+		}
+	}
+
+	void clear() {
+		for (Slot& slot: slots) {
+			slot.occupied = false;
+		}
+		entries = 0;
+	}
+
+	size_t size() const {
+		return entries;
+	}
+
+	bool full() const {
+		return entries == Capacity;
+	}
+};
+
+#endif // ECSS_SERVICES_HASHINDEX_HPP
@@ -0,0 +1,311 @@
+#ifndef ECSS_SERVICES_JOURNAL_HPP
+#define ECSS_SERVICES_JOURNAL_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "Helpers/CRCHelper.hpp"
+#include "etl/array.h"
+#include "etl/span.h"
+
+/**
+ * Write-ahead journal in a fixed memory region, e.g. a memory-mapped file or a bank of non-volatile RAM, from which
+ * the state of a service is rebuilt after a restart.
+ *
+ * The region starts with a small header, and the rest is split into two equal areas. The active area holds a snapshot
+ * of the state, followed by the records of every change since then. When the active area is full, the owner writes a
+ * new snapshot into the other area, between @ref beginSnapshot and @ref commitSnapshot. Only the last call switches
+ * the active area, so an interrupted snapshot leaves the previous snapshot and its records intact. A snapshot that does
+ * not fit is given up with @ref abortSnapshot, after which records are appended to the active area again.
+ *
+ * Each record is stored as its length, its CRC and its bytes, in the native byte order. An area is zeroed before it is
+ * used, and the records are read up to the first one with no length or a wrong CRC, which also drops a record whose
+ * write was interrupted.
+ */
+class Journal {
+public:
+	/**
+	 * The bytes stored before every record
+	 */
+	static constexpr size_t RecordOverhead = 2 * sizeof(uint16_t);
+
+	/**
+	 * Builds a record field by field, in the native byte order
+	 *
+	 * @tparam Capacity The maximum size of the record
+	 */
+	template <size_t Capacity>
+	class Record {
+		etl::array<uint8_t, Capacity> bytes;
+		uint16_t length = 0;
+
+	public:
+		template <typename T>
+		void append(const T& value) {
+			static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be stored in a record");
+			appendBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(T)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+		}
+
+		void appendBytes(const uint8_t* data, uint16_t size) {
+			if (length + size <= Capacity) {
+				std::memcpy(bytes.data() + length, data, size);
+				length += size;
+			}
+		}
+
+		const uint8_t* data() const {
+			return bytes.data();
+		}
+
+		uint16_t size() const {
+			return length;
+		}
+	};
+
+	/**
+	 * A record with exactly enough space for the given fields
+	 */
+	template <typename... Fields>
+	using RecordOf = Record<(sizeof(Fields) + ... + 0)>;
+
+	/**
+	 * Reads the fields of a record in the order they were appended
+	 */
+	class RecordReader {
+		etl::span<const uint8_t> bytes;
+		size_t position = 0;
+
+	public:
+		explicit RecordReader(etl::span<const uint8_t> record) : bytes(record) {}
+
+		/**
+		 * @return The next field, or a default value if the record is too short
+		 */
+		template <typename T>
+		T read() {
+			T value{};
+			if (position + sizeof(T) <= bytes.size()) {
+				std::memcpy(&value, bytes.data() + position, sizeof(T));
+			}
+			position += sizeof(T);
+			return value;
+		}
+
+		/**
+		 * @return The next size bytes, or an empty span if the record is too short
+		 */
+		etl::span<const uint8_t> readBytes(size_t size) {
+			if (position + size > bytes.size()) {
+				position = bytes.size();
+				return {};
+			}
+			position += size;
+			return bytes.subspan(position - size, size);
+		}
+	};
+
+private:
+	struct Header {
+		uint32_t magic;
+		uint32_t activeArea;
+	};
+
+	static constexpr uint32_t Magic = 0x4A524E4CU;
+
+	uint8_t* region = nullptr;
+	size_t areaSize = 0;
+
+	uint32_t activeArea = 0;
+
+	/**
+	 * The area that records are appended to, which is the inactive one while a snapshot is written
+	 */
+	uint32_t writeArea = 0;
+
+	/**
+	 * The offset after the last record in @ref writeArea
+	 */
+	size_t writePosition = 0;
+
+	/**
+	 * The offset after the last record in the active area, kept while a snapshot is written
+	 */
+	size_t activePosition = 0;
+
+	uint8_t* area(uint32_t index) const {
+		return region + sizeof(Header) + index * areaSize;
+	}
+
+	void writeHeader() const {
+		const Header header{Magic, activeArea};
+		std::memcpy(region, &header, sizeof(Header));
+	}
+
+public:
+	/**
+	 * Uses a region for the journal, and calls function(record) with the bytes of every record of the journal that is
+	 * already in it, from the oldest to the newest. If the region does not hold a journal, it is formatted instead.
+	 *
+	 * @return true if a journal was found in the region
+	 */
+	template <typename Function>
+	bool attach(etl::span<uint8_t> memory, Function&& function) {
+		detach();
+		if (memory.size() <= sizeof(Header) + 2 * RecordOverhead) {
+			return false;
+		}
+		region = memory.data();
+		areaSize = (memory.size() - sizeof(Header)) / 2;
+
+		Header header{};
+		std::memcpy(&header, region, sizeof(Header));
+		if (header.magic != Magic or header.activeArea > 1) {
+			activeArea = 0;
+			writeArea = 0;
+			std::memset(area(0), 0, areaSize);
+			writePosition = 0;
+			writeHeader();
+			return false;
+		}
+
+		activeArea = header.activeArea;
+		writeArea = activeArea;
+		const uint8_t* records = area(activeArea);
+		size_t position = 0;
+		while (position + RecordOverhead <= areaSize) {
+			uint16_t length = 0;
+			uint16_t crc = 0;
+			std::memcpy(&length, records + position, sizeof(length));
+			std::memcpy(&crc, records + position + sizeof(length), sizeof(crc));
+			if (length == 0 or position + RecordOverhead + length > areaSize or
+			    CRCHelper::calculateCRC(records + position + RecordOverhead, length) != crc) {
+				break;
+			}
+			function(etl::span<const uint8_t>(records + position + RecordOverhead, length));
+			position += RecordOverhead + length;
+		}
+		writePosition = position;
+		// Clear a record whose write was interrupted, so that it is not mistaken for the end of the next one
+		std::memset(area(activeArea) + position, 0, areaSize - position);
+		return true;
+	}
+
+	/**
+	 * Stops using the region. Nothing is appended to the journal until it is attached again.
+	 */
+	void detach() {
+		region = nullptr;
+		areaSize = 0;
+		writePosition = 0;
+	}
+
+	bool isAttached() const {
+		return region != nullptr;
+	}
+
+	/**
+	 * Appends a record to the log, or to the snapshot being written.
+	 *
+	 * @return false if there is no space left in the area, or the journal is not attached
+	 */
+	bool append(const uint8_t* record, uint16_t length) {
+		return append(etl::span<const uint8_t>(record, length), {});
+	}
+
+	template <size_t Capacity>
+	bool append(const Record<Capacity>& record) {
+		return append(record.data(), record.size());
+	}
+
+	/**
+	 * Appends a single record made of the fields of record followed by payload, e.g. a variable-length packet, without
+	 * first copying them into one buffer.
+	 */
+	template <size_t Capacity>
+	bool append(const Record<Capacity>& record, etl::span<const uint8_t> payload) {
+		return append(etl::span<const uint8_t>(record.data(), record.size()), payload);
+	}
+
+	/**
+	 * Appends a single record made of the bytes of head followed by the bytes of tail
+	 *
+	 * @return false if there is no space left in the area, or the journal is not attached
+	 */
+	bool append(etl::span<const uint8_t> head, etl::span<const uint8_t> tail) {
+		const size_t totalLength = head.size() + tail.size();
+		if (not isAttached() or totalLength == 0 or totalLength > UINT16_MAX or
+		    writePosition + RecordOverhead + totalLength > areaSize) {
+			return false;
+		}
+		const auto length = static_cast<uint16_t>(totalLength);
+		uint8_t* destination = area(writeArea) + writePosition;
+		uint8_t* recordBytes = destination + RecordOverhead;
+		if (not head.empty()) {
+			std::memcpy(recordBytes, head.data(), head.size());
+		}
+		if (not tail.empty()) {
+			std::memcpy(recordBytes + head.size(), tail.data(), tail.size());
+		}
+		// The length is written last, so that a record that was interrupted is not taken for a complete one
+		const uint16_t crc = CRCHelper::calculateCRC(recordBytes, length);
+		std::memcpy(destination + sizeof(length), &crc, sizeof(crc));
+		std::memcpy(destination, &length, sizeof(length));
+		writePosition += RecordOverhead + length;
+		return true;
+	}
+
+	/**
+	 * Starts writing a snapshot into the inactive area. The records appended until @ref commitSnapshot make up the
+	 * snapshot, and the records of the active area are discarded when it is committed.
+	 */
+	void beginSnapshot() {
+		if (not isAttached()) {
+			return;
+		}
+		if (writeArea == activeArea) {
+			activePosition = writePosition;
+		}
+		writeArea = 1 - activeArea;
+		std::memset(area(writeArea), 0, areaSize);
+		writePosition = 0;
+	}
+
+	/**
+	 * Makes the snapshot the active area. Later records are appended after it.
+	 */
+	void commitSnapshot() {
+		if (not isAttached()) {
+			return;
+		}
+		activeArea = writeArea;
+		writeHeader();
+	}
+
+	/**
+	 * Gives up the snapshot being written, e.g. because it does not fit in an area. Later records are appended to the
+	 * active area again, after its last record.
+	 */
+	void abortSnapshot() {
+		if (not isAttached() or writeArea == activeArea) {
+			return;
+		}
+		writeArea = activeArea;
+		writePosition = activePosition;
+	}
+
+	/**
+	 * @return The number of bytes used in the area that records are appended to
+	 */
+	size_t usedBytes() const {
+		return writePosition;
+	}
+
+	/**
+	 * @return The number of bytes in each of the two areas
+	 */
+	size_t capacity() const {
+		return areaSize;
+	}
+};
+
+#endif // ECSS_SERVICES_JOURNAL_HPP
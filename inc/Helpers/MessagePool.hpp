@@ -0,0 +1,342 @@
+#ifndef ECSS_SERVICES_MESSAGEPOOL_HPP
+#define ECSS_SERVICES_MESSAGEPOOL_HPP
+
+#include <cstdint>
+#include <utility>
+#include "ECSS_Definitions.hpp"
+#include "ErrorHandler.hpp"
+#include "Message.hpp"
+#include "etl/algorithm.h"
+#include "etl/array.h"
+
+/**
+ * Fixed-capacity pool of preallocated @ref Message buffers, shared through reference-counted handles.
+ *
+ * A message that has to outlive the function that created it, e.g. a TM packet kept in a packet store, is placed in a
+ * buffer of the pool once, and is then passed around by copying its @ref Handle, which only increases the reference
+ * count of the buffer instead of copying its bytes. The buffer returns to the free list of the pool when its last
+ * handle is destroyed.
+ *
+ * When all the buffers are taken, the pool follows its @ref ExhaustionPolicy. Every exhaustion is counted, and every
+ * failed acquisition is also reported as an internal error, so that running out of buffers is observable.
+ *
+ * @note The pool must outlive all of its handles.
+ *
+ * @tparam Capacity The number of buffers
+ */
+template <size_t Capacity>
+class MessagePool {
+	static_assert(Capacity > 0 and Capacity < UINT16_MAX, "The pool capacity must fit in a 16-bit index");
+
+	static constexpr uint16_t InvalidIndex = UINT16_MAX;
+
+public:
+	/**
+	 * What the pool does when a buffer is requested while all of them are taken
+	 */
+	enum class ExhaustionPolicy : uint8_t {
+		/**
+		 * The request fails, and an invalid handle is returned
+		 */
+		Fail,
+		/**
+		 * The buffer that was acquired first is taken from its holders, whose handles no longer resolve, and reused
+		 */
+		DropOldest,
+		/**
+		 * The wait function is called until a buffer is released, or until it returns false, e.g. on a timeout. The
+		 * request fails if no buffer has been released, or if there is no wait function.
+		 */
+		Block,
+	};
+
+	/**
+	 * Waits for other tasks to release buffers, e.g. by yielding or blocking on a semaphore
+	 *
+	 * @return false to stop waiting
+	 */
+	using WaitFunction = bool (*)();
+
+	/**
+	 * Shared reference to a message in the pool.
+	 *
+	 * Copying a handle adds a reference to the same buffer, and destroying it removes one. A handle becomes invalid if
+	 * its buffer is taken back by the pool under @ref ExhaustionPolicy::DropOldest, even after the buffer has been
+	 * reused by another message.
+	 *
+	 * @note As with @ref SlotHandle, the generations are 32-bit counters, so a dropped handle could only resolve again
+	 * after its buffer has been reused 2^32 times.
+	 */
+	class Handle {
+		friend class MessagePool;
+
+		MessagePool* pool = nullptr;
+		uint16_t index = 0;
+		uint32_t generation = 0;
+
+		Handle(MessagePool* pool, uint16_t index, uint32_t generation)
+		    : pool(pool), index(index), generation(generation) {}
+
+	public:
+		Handle() = default;
+
+		Handle(const Handle& handle) : pool(handle.pool), index(handle.index), generation(handle.generation) {
+			if (pool != nullptr) {
+				pool->retain(index, generation);
+			}
+		}
+
+		Handle(Handle&& handle) noexcept : pool(handle.pool), index(handle.index), generation(handle.generation) {
+			handle.pool = nullptr;
+		}
+
+		Handle& operator=(Handle handle) noexcept {
+			std::swap(pool, handle.pool);
+			std::swap(index, handle.index);
+			std::swap(generation, handle.generation);
+			return *this;
+		}
+
+		~Handle() {
+			reset();
+		}
+
+		/**
+		 * Drops the reference of this handle, which then no longer refers to any message
+		 */
+		void reset() {
+			if (pool != nullptr) {
+				pool->release(index, generation);
+				pool = nullptr;
+			}
+		}
+
+		/**
+		 * @return The referenced message, or nullptr if the handle is empty or its buffer has been taken back
+		 */
+		Message* get() const {
+			return (pool != nullptr) ? pool->messageAt(index, generation) : nullptr;
+		}
+
+		/**
+		 * @pre The handle resolves to a message, which has to be checked first with `operator bool`, since a handle
+		 * can become invalid at any time under @ref ExhaustionPolicy::DropOldest. Dereferencing a handle that does not
+		 * resolve dereferences a null pointer.
+		 */
+		Message& operator*() const {
+			return *get();
+		}
+
+		/**
+		 * @return The referenced message, or nullptr if the handle does not resolve, as for @ref get
+		 */
+		Message* operator->() const {
+			return get();
+		}
+
+		explicit operator bool() const {
+			return get() != nullptr;
+		}
+
+		/**
+		 * @return The number of handles that refer to the same message
+		 */
+		uint16_t useCount() const {
+			return (get() != nullptr) ? pool->buffers[index].references : 0;
+		}
+	};
+
+private:
+	struct Buffer {
+		Message message;
+		/**
+		 * The order in which the buffer was acquired, used to find the oldest one
+		 */
+		uint32_t acquisition = 0;
+		uint16_t references = 0;
+		uint32_t generation = 0;
+		uint16_t nextFree = InvalidIndex;
+	};
+
+	etl::array<Buffer, Capacity> buffers;
+
+	uint16_t firstFree = 0;
+	uint16_t usedBuffers = 0;
+	uint32_t acquisitions = 0;
+
+	ExhaustionPolicy policy = ExhaustionPolicy::Fail;
+	WaitFunction waitForRelease = nullptr;
+
+	Message* messageAt(uint16_t index, uint32_t generation) {
+		Buffer& buffer = buffers[index];
+		return (buffer.references > 0 and buffer.generation == generation) ? &buffer.message : nullptr;
+	}
+
+	void retain(uint16_t index, uint32_t generation) {
+		if (messageAt(index, generation) != nullptr) {
+			buffers[index].references++;
+		}
+	}
+
+	void release(uint16_t index, uint32_t generation) {
+		if (messageAt(index, generation) != nullptr) {
+			buffers[index].references--;
+			if (buffers[index].references == 0) {
+				freeBuffer(index);
+			}
+		}
+	}
+
+	void freeBuffer(uint16_t index) {
+		Buffer& buffer = buffers[index];
+		buffer.references = 0;
+		buffer.generation++;
+		buffer.nextFree = firstFree;
+		firstFree = index;
+		usedBuffers--;
+	}
+
+	/**
+	 * Takes back the buffer that was acquired first, invalidating all of its handles
+	 */
+	void dropOldest() {
+		uint16_t oldest = 0;
+		for (uint16_t index = 1; index < Capacity; index++) {
+			if (static_cast<int32_t>(buffers[index].acquisition - buffers[oldest].acquisition) < 0) {
+				oldest = index;
+			}
+		}
+		freeBuffer(oldest);
+		droppedMessages++;
+	}
+
+	/**
+	 * Tries to make a buffer available according to the exhaustion policy
+	 */
+	void handleExhaustion() {
+		exhaustions++;
+		if (policy == ExhaustionPolicy::DropOldest) {
+			dropOldest();
+		} else if (policy == ExhaustionPolicy::Block and waitForRelease != nullptr) {
+			while (firstFree == InvalidIndex and waitForRelease()) {}
+		}
+	}
+
+public:
+	/**
+	 * The number of times that a buffer was requested while all of them were taken
+	 */
+	uint32_t exhaustions = 0;
+
+	/**
+	 * The number of requests that did not get a buffer
+	 */
+	uint32_t failedAcquisitions = 0;
+
+	/**
+	 * The number of messages that were taken from their holders under @ref ExhaustionPolicy::DropOldest
+	 */
+	uint32_t droppedMessages = 0;
+
+	/**
+	 * The largest number of buffers that have been in use at the same time
+	 */
+	uint16_t highWaterMark = 0;
+
+	MessagePool() {
+		for (uint16_t index = 0; index < Capacity; index++) {
+			buffers[index].nextFree = (index + 1U < Capacity) ? index + 1U : InvalidIndex;
+		}
+	}
+
+	MessagePool(const MessagePool&) = delete;
+	MessagePool& operator=(const MessagePool&) = delete;
+
+	void setExhaustionPolicy(ExhaustionPolicy exhaustionPolicy, WaitFunction waitFunction = nullptr) {
+		policy = exhaustionPolicy;
+		waitForRelease = waitFunction;
+	}
+
+	ExhaustionPolicy exhaustionPolicy() const {
+		return policy;
+	}
+
+	/**
+	 * Takes a free buffer, holding an empty message
+	 *
+	 * @return The only handle to the message, or an invalid handle if no buffer could be made available
+	 */
+	Handle acquire() {
+		if (firstFree == InvalidIndex) {
+			handleExhaustion();
+			if (firstFree == InvalidIndex) {
+				failedAcquisitions++;
+				ErrorHandler::reportInternalError(ErrorHandler::MessagePoolExhausted);
+				return {};
+			}
+		}
+
+		const uint16_t index = firstFree;
+		Buffer& buffer = buffers[index];
+		firstFree = buffer.nextFree;
+
+		// Only the header of a message is initialized, so this does not touch the bytes of the previous one
+		buffer.message = Message();
+		buffer.references = 1;
+		buffer.acquisition = acquisitions++;
+		usedBuffers++;
+		highWaterMark = etl::max(highWaterMark, usedBuffers);
+
+		return Handle(this, index, buffer.generation);
+	}
+
+	/**
+	 * Takes a free buffer for a new message, in the same way as a message is created with its constructor
+	 */
+	Handle create(ServiceTypeNum serviceType, MessageTypeNum messageType, Message::PacketType packetType,
+	              ApplicationProcessId applicationId = ApplicationId) {
+		Handle handle = acquire();
+		if (handle) {
+			*handle = Message(serviceType, messageType, packetType, applicationId);
+		}
+		return handle;
+	}
+
+	/**
+	 * Copies a message into a free buffer. Only the used bytes of the message are copied.
+	 */
+	Handle store(const Message& message) {
+		Handle handle = acquire();
+		if (handle) {
+			*handle = message;
+		}
+		return handle;
+	}
+
+	/**
+	 * @return The number of buffers in use
+	 */
+	size_t size() const {
+		return usedBuffers;
+	}
+
+	/**
+	 * @return The number of free buffers
+	 */
+	size_t available() const {
+		return Capacity - usedBuffers;
+	}
+
+	static constexpr size_t capacity() {
+		return Capacity;
+	}
+};
+
+/**
+ * The pool of the messages that are kept by the services, e.g. the TM packets of the ST[15] packet stores
+ */
+using ServiceMessagePool = MessagePool<ECSSMessagePoolSize>;
+
+using MessageHandle = ServiceMessagePool::Handle;
+
+#endif // ECSS_SERVICES_MESSAGEPOOL_HPP
@@ -5,6 +5,7 @@
 #include "Message.hpp"
 #include "Service.hpp"
 #include "TimeGetter.hpp"
+#include "etl/algorithm.h"
 #include "etl/array.h"
 #include "etl/functional.h"
 #include "etl/map.h"
@@ -46,6 +47,12 @@ public:
 	 */
 	PMONRepetitionNumber repetitionCounter = 0;
 
+	/**
+	 * The number of on-board parameter minimum sampling intervals (@ref ECSSMonitoringFrequency) between two
+	 * consecutive checks of this definition.
+	 */
+	PMONMonitoringInterval monitoringInterval = 1;
+
 	/**
 	 * If false, the parameter of this PMON will not be checked, and no events will be generated if it goes off-bounds.
 	 */
@@ -54,9 +61,11 @@ public:
 	CheckingStatus checkingStatus = Unchecked;
 
 	/**
-	 * The list of Checking Statuses that have been recorded so far.
+	 * The last two confirmed Checking Statuses of this definition. The first element is the previous confirmed status
+	 * and the second element is the current one. A status is confirmed once it has been the result of
+	 * @ref repetitionNumber consecutive checks.
 	 */
-	etl::array<CheckingStatus, 2> checkTransitionList = {};
+	etl::array<CheckingStatus, 2> checkTransitionList = {Unchecked, Unchecked};
 
 	/**
 	 * The check type of this monitoring definition, set by the child classes to differentiate between class types
@@ -70,6 +79,20 @@ public:
 		return repetitionNumber;
 	}
 
+	/**
+	 * Returns the number of on-board parameter minimum sampling intervals between two checks of this definition.
+	 */
+	PMONMonitoringInterval getMonitoringInterval() const {
+		return monitoringInterval;
+	}
+
+	/**
+	 * Returns the time between two checks of this definition. A monitoring interval of 0 is treated as 1.
+	 */
+	auto getMonitoringPeriod() const {
+		return ECSSMonitoringFrequency * etl::max<PMONMonitoringInterval>(monitoringInterval, 1);
+	}
+
 	/**
 	 * Returns True if Monitoring is enabled, False otherwise.
 	 */
@@ -98,10 +121,55 @@ public:
 		return checkingStatus;
 	}
 
+	/**
+	 * Returns true if a Checking Status indicates that the monitored parameter is not nominal, i.e. it has an
+	 * unexpected value, or it is out of its limits or thresholds.
+	 */
+	static bool isFailingStatus(CheckingStatus status) {
+		return status == UnexpectedValue or status == BelowLowLimit or status == AboveHighLimit or
+		       status == BelowLowThreshold or status == AboveHighThreshold;
+	}
+
+	/**
+	 * Returns true if the last confirmed Checking Status of this definition is a failing one.
+	 */
+	bool isFailing() const {
+		return isFailingStatus(checkTransitionList[1]);
+	}
+
+	/**
+	 * Returns true if the latest check result has been repeated enough times to be confirmed, and differs from the
+	 * last confirmed Checking Status.
+	 */
+	bool hasUnconfirmedTransition() const {
+		return repetitionCounter >= repetitionNumber and checkingStatus != checkTransitionList[1];
+	}
+
+	/**
+	 * Records the current Checking Status as the new confirmed status, shifting the previous one in
+	 * @ref checkTransitionList.
+	 */
+	void confirmTransition() {
+		checkTransitionList[0] = checkTransitionList[1];
+		checkTransitionList[1] = checkingStatus;
+	}
+
+	/**
+	 * Brings the definition back to its initial unchecked state, forgetting any confirmed Checking Statuses.
+	 */
+	void resetCheckingStatus() {
+		repetitionCounter = 0;
+		checkingStatus = Unchecked;
+		checkTransitionList = {Unchecked, Unchecked};
+	}
+
 	/**
 	 * Pure virtual function to be implemented by derived classes for performing the specific check.
 	 * The function updates PMON::checkingStatus based on the result of the check.
 	 *
+	 * @param checkTime The time of the monitoring cycle that this check belongs to. All the definitions checked in the
+	 * same cycle should be given the same time, so that the time is only read once per cycle.
+	 *
 	 * This function is expected to be called by the periodic monitoring system, which is responsible for
 	 * invoking the check on each monitored parameter at regular intervals. It ensures that parameters are
 	 * within their defined limits, match expected values, or have acceptable delta changes over time.
@@ -110,7 +178,7 @@ public:
 	 * If they are the same, the repetition counter is incremented. If they are different, the repetition counter is reset to 1.
 	 *
 	 * @note
-	 * It is crucial that this function is called periodically and consistently every @ref ECSSMonitoringFrequency to ensure the
+	 * It is crucial that this function is called periodically and consistently every @ref getMonitoringPeriod to ensure the
 	 * reliability of the monitoring system. Irregular calls or missed checks can lead to incorrect status updates and potentially
 	 * missed parameter anomalies.
 	 *
@@ -119,7 +187,16 @@ public:
 	 * perform a check even if the PMON definition is _disabled_.
 	 *
 	 */
-	virtual void performCheck() = 0;
+	virtual void performCheck(const Time::DefaultCUC& checkTime) = 0;
+
+	virtual ~PMON() = default;
+
+	/**
+	 * Performs the check using the current on-board time as the time of the check.
+	 */
+	void performCheck() {
+		performCheck(TimeGetter::getCurrentTimeDefaultCUC());
+	}
 
 protected:
 	/**
@@ -133,6 +210,8 @@ protected:
  */
 class PMONExpectedValueCheck : public PMON {
 public:
+	using PMON::performCheck;
+
 	PMONExpectedValue expectedValue;
 	PMONBitMask mask;
 	EventDefinitionId unexpectedValueEvent;
@@ -175,7 +254,7 @@ public:
 	 *
 	 * @note This function overrides the pure virtual function in the base PMON class.
 	 */
-	void performCheck() override {
+	void performCheck(const Time::DefaultCUC& /* checkTime */) override {
 		auto previousStatus = checkingStatus;
 		auto currentValueAsUint64 = monitoredParameter.get().getValueAsUint64();
 		uint64_t maskedValue = currentValueAsUint64 & getMask();
@@ -199,6 +278,8 @@ public:
  */
 class PMONLimitCheck : public PMON {
 public:
+	using PMON::performCheck;
+
 	PMONLimit lowLimit;
 	EventDefinitionId belowLowLimitEvent;
 	PMONLimit highLimit;
@@ -247,7 +328,7 @@ public:
 	 *
 	 * @note This function overrides the pure virtual function in the base PMON class.
 	 */
-	void performCheck() override {
+	void performCheck(const Time::DefaultCUC& /* checkTime */) override {
 		auto previousStatus = checkingStatus;
 		auto currentValue = monitoredParameter.get().getValueAsDouble();
 		if (currentValue < getLowLimit()) {
@@ -271,6 +352,8 @@ public:
  */
 class PMONDeltaCheck : public PMON {
 public:
+	using PMON::performCheck;
+
 	NumberOfConsecutiveDeltaChecks numberOfConsecutiveDeltaChecks;
 	DeltaThreshold lowDeltaThreshold;
 	EventDefinitionId belowLowThresholdEvent;
@@ -335,12 +418,12 @@ public:
 	}
 
 	/**
-	 * Returns the delta per second between the current value and the previous one.
+	 * Returns the delta per second between the current value, sampled at currentTimestamp, and the previous one.
 	 */
-	double getDeltaPerSecond(double currentValue) const {
+	double getDeltaPerSecond(double currentValue, const Time::DefaultCUC& currentTimestamp) const {
 		if (previousTimestamp.has_value()) {
 			double delta = currentValue - previousValue;
-			auto duration = TimeGetter::getCurrentTimeDefaultCUC() - *previousTimestamp;
+			auto duration = currentTimestamp - *previousTimestamp;
 			double deltaSeconds = std::chrono::duration<double>(duration).count();
 
 			if (deltaSeconds == 0) {
@@ -361,7 +444,7 @@ public:
 	/**
 	 * @brief Performs the check for the PMONDeltaCheck class.
 	 *
-	 * This function first retrieves the current value of the monitored parameter and the current timestamp.
+	 * This function first retrieves the current value of the monitored parameter, which is timestamped with the time of the check.
 	 * If there is a previous value, it calculates the delta per second between the current and previous values.
 	 * Depending on the delta per second, it sets the checking status to BelowLowThreshold, AboveHighThreshold, or WithinThreshold.
 	 * If there is no previous value, it sets the checking status to Invalid.
@@ -372,13 +455,12 @@ public:
 	 * @note The delta check is performed on the actual difference between the previous and the current
 	 * value ($\Delta = \mathrm{current} - \mathrm{last}$). No absolute value is considered.
 	 */
-	void performCheck() override {
+	void performCheck(const Time::DefaultCUC& checkTime) override {
 		auto previousStatus = checkingStatus;
 		auto currentValue = monitoredParameter.get().getValueAsDouble();
-		auto currentTimestamp = TimeGetter::getCurrentTimeDefaultCUC();
 
 		if (hasOldValue()) {
-			double deltaPerSecond = getDeltaPerSecond(currentValue);
+			double deltaPerSecond = getDeltaPerSecond(currentValue, checkTime);
 			if (deltaPerSecond < getLowDeltaThreshold()) {
 				checkingStatus = BelowLowThreshold;
 			} else if (deltaPerSecond > getHighDeltaThreshold()) {
@@ -390,7 +472,7 @@ public:
 			checkingStatus = Invalid;
 		}
 
-		updatePreviousValueAndTimestamp(currentValue, currentTimestamp);
+		updatePreviousValueAndTimestamp(currentValue, checkTime);
 
 		if (checkingStatus == previousStatus) {
 			repetitionCounter++;
@@ -3,6 +3,7 @@
 
 #include "ECSS_Definitions.hpp"
 #include "ErrorHandler.hpp"
+#include "Helpers/MessagePool.hpp"
 #include "Message.hpp"
 #include "etl/deque.h"
 #include "numeric"
@@ -68,18 +69,32 @@ public:
 	/**
 	 * A queue containing the TM messages stored by the packet store. Every TM is accompanied by its timestamp.
 	 *
+	 * The messages are held in the buffers of a @ref MessagePool, so that copying packets between packet stores only
+	 * shares their handles.
+	 *
 	 * @note A convention is made that this should be filled out using `push_back` and NOT `push_front`, dictating that
 	 * earlier packets are placed in the front position. So removing the earlier packets is done with `pop_front`.
 	 *
 	 * 				old packets  <---------->  new packets
 	 * 				[][][][][][][][][][][][][][][][][][][]	<--- deque
 	 */
-	etl::deque<std::pair<Time::DefaultCUC, Message>, ECSSMaxPacketStoreSize> storedTelemetryPackets;
+	etl::deque<std::pair<Time::DefaultCUC, MessageHandle>, ECSSMaxPacketStoreSize> storedTelemetryPackets;
 
 	/**
 	 * Returns the sum of the sizes of the packets stored in this PacketStore, in bytes.
 	 */
 	uint16_t calculateSizeInBytes();
+
+	/**
+	 * Removes the packets whose buffers have been taken back by the message pool, e.g. under
+	 * @ref ServiceMessagePool::ExhaustionPolicy::DropOldest, so that they no longer take space in the packet store.
+	 */
+	void removeDroppedPackets();
+
+	/**
+	 * Returns the number of stored packets whose buffers are still held.
+	 */
+	uint16_t countHeldPackets() const;
 };
 
 #endif
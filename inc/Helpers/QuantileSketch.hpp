@@ -0,0 +1,178 @@
+#ifndef ECSS_SERVICES_QUANTILESKETCH_HPP
+#define ECSS_SERVICES_QUANTILESKETCH_HPP
+
+#include <cmath>
+#include <cstdint>
+#include "etl/array.h"
+
+/**
+ * Fixed-memory sketch of the distribution of a stream of values, from which quantiles are estimated.
+ *
+ * The values are counted in logarithmically sized buckets, as in DDSketch: bucket i holds the magnitudes in
+ * (γ^(i-1), γ^i], with γ = (1 + α) / (1 - α), so that any quantile is estimated within a relative error α. Positive
+ * and negative values have their own buckets, and magnitudes below @ref MinimumMagnitude are counted as zero.
+ *
+ * Each sign has Buckets consecutive buckets, centred on the first value added. When a larger value does not fit,
+ * the lowest buckets are collapsed into one, so the accuracy of the low quantiles degrades first while the memory
+ * stays constant. Sketches with the same parameters can be merged, e.g. to combine consecutive evaluation windows.
+ *
+ * @tparam Buckets The number of buckets for each sign
+ */
+template <size_t Buckets>
+class QuantileSketch {
+public:
+	/**
+	 * The magnitude below which values are counted as zero
+	 */
+	static constexpr double MinimumMagnitude = 1e-9;
+
+private:
+	/**
+	 * Consecutive buckets of the magnitudes of one sign
+	 */
+	class Store {
+	public:
+		etl::array<uint32_t, Buckets> counts{};
+
+		/**
+		 * The bucket index of counts[0]
+		 */
+		int32_t offset = 0;
+
+		uint32_t total = 0;
+
+		void add(int32_t index, uint32_t count) {
+			if (total == 0) {
+				offset = index - static_cast<int32_t>(Buckets / 2);
+			} else if (index >= offset + static_cast<int32_t>(Buckets)) {
+				collapseLowest(index - (offset + static_cast<int32_t>(Buckets) - 1));
+			}
+			if (index < offset) {
+				index = offset;
+			}
+			counts[index - offset] += count;
+			total += count;
+		}
+
+		/**
+		 * Moves the buckets up by shift indices, merging the lowest shift + 1 buckets into the new lowest bucket
+		 */
+		void collapseLowest(int32_t shift) {
+			if (shift >= static_cast<int32_t>(Buckets)) {
+				counts.fill(0);
+				counts[0] = total;
+			} else {
+				const auto width = static_cast<size_t>(shift);
+				uint32_t collapsed = 0;
+				for (size_t bucket = 0; bucket <= width; bucket++) {
+					collapsed += counts[bucket];
+				}
+				for (size_t bucket = 1; bucket + width < Buckets; bucket++) {
+					counts[bucket] = counts[bucket + width];
+				}
+				for (size_t bucket = Buckets - width; bucket < Buckets; bucket++) {
+					counts[bucket] = 0;
+				}
+				counts[0] = collapsed;
+			}
+			offset += shift;
+		}
+
+		void merge(const Store& other) {
+			for (size_t bucket = 0; bucket < Buckets; bucket++) {
+				if (other.counts[bucket] != 0) {
+					add(other.offset + static_cast<int32_t>(bucket), other.counts[bucket]);
+				}
+			}
+		}
+	};
+
+	Store positive;
+	Store negative;
+	uint32_t zeroCount = 0;
+
+	double gamma;
+	double logGamma;
+
+	int32_t indexOf(double magnitude) const {
+		return static_cast<int32_t>(std::ceil(std::log(magnitude) / logGamma));
+	}
+
+	/**
+	 * @return The estimate of the magnitudes in a bucket, within a relative error α from all of them
+	 */
+	double valueOf(int32_t index) const {
+		return 2 * std::pow(gamma, index) / (gamma + 1);
+	}
+
+public:
+	/**
+	 * @param relativeAccuracy The relative error α of the estimated quantiles, as long as no buckets have been
+	 * collapsed
+	 */
+	explicit QuantileSketch(double relativeAccuracy)
+	    : gamma((1 + relativeAccuracy) / (1 - relativeAccuracy)), logGamma(std::log(gamma)) {}
+
+	void add(double value) {
+		if (value > MinimumMagnitude) {
+			positive.add(indexOf(value), 1);
+		} else if (value < -MinimumMagnitude) {
+			negative.add(indexOf(-value), 1);
+		} else {
+			zeroCount++;
+		}
+	}
+
+	/**
+	 * Adds all the values of another sketch, which must have the same relative accuracy.
+	 */
+	void merge(const QuantileSketch& other) {
+		positive.merge(other.positive);
+		negative.merge(other.negative);
+		zeroCount += other.zeroCount;
+	}
+
+	void reset() {
+		positive = Store();
+		negative = Store();
+		zeroCount = 0;
+	}
+
+	uint32_t count() const {
+		return positive.total + negative.total + zeroCount;
+	}
+
+	/**
+	 * Estimates the value of nearest rank round(q · (count - 1)) among the added values.
+	 *
+	 * @param quantile The quantile q, in [0, 1]
+	 * @return The estimated value, or 0 if the sketch is empty
+	 */
+	double quantile(double quantile) const {
+		if (count() == 0) {
+			return 0;
+		}
+		const auto rank = static_cast<uint32_t>(std::lround(quantile * (count() - 1)));
+
+		uint32_t cumulativeCount = 0;
+		for (size_t bucket = Buckets; bucket-- > 0;) {
+			cumulativeCount += negative.counts[bucket];
+			if (rank < cumulativeCount) {
+				return -valueOf(negative.offset + static_cast<int32_t>(bucket));
+			}
+		}
+		cumulativeCount += zeroCount;
+		if (rank < cumulativeCount) {
+			return 0;
+		}
+		for (size_t bucket = 0; bucket < Buckets; bucket++) {
+			cumulativeCount += positive.counts[bucket];
+			if (rank < cumulativeCount) {
+				return valueOf(positive.offset + static_cast<int32_t>(bucket));
+			}
+		}
+		return valueOf(positive.offset + static_cast<int32_t>(Buckets) - 1);
+	}
+};
+
+#endif // ECSS_SERVICES_QUANTILESKETCH_HPP
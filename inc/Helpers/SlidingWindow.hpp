@@ -0,0 +1,261 @@
+#ifndef ECSS_SERVICES_SLIDINGWINDOW_HPP
+#define ECSS_SERVICES_SLIDINGWINDOW_HPP
+
+#include <cmath>
+#include <cstdint>
+#include "Time/TimeStamp.hpp"
+#include "etl/deque.h"
+
+/**
+ * Statistics over the most recent samples of a parameter, e.g. "the minimum over the last 10 seconds".
+ *
+ * The samples in the window are kept in a ring buffer. The minimum and the maximum are taken from monotonic deques,
+ * which only hold the samples that can still become the extremum of the window, so that adding and expiring a sample
+ * are O(1) amortised. The mean and the variance come from running sums of the samples, shifted by a reference value
+ * to limit cancellation, which are recomputed from the buffer once every Capacity removals so that rounding errors do
+ * not accumulate.
+ *
+ * @tparam Capacity The maximum number of samples in the window. When it is reached, the oldest sample is dropped.
+ */
+template <size_t Capacity>
+class SlidingWindow {
+	struct Sample {
+		double value;
+		Time::DefaultCUC time;
+	};
+
+	etl::deque<Sample, Capacity> samples;
+
+	/**
+	 * The sequence numbers of the samples that may become the minimum of the window, with increasing values
+	 */
+	etl::deque<uint32_t, Capacity> minimumCandidates;
+
+	/**
+	 * The sequence numbers of the samples that may become the maximum of the window, with decreasing values
+	 */
+	etl::deque<uint32_t, Capacity> maximumCandidates;
+
+	/**
+	 * The sequence number of the oldest sample in the window. Sequence numbers increase by one with every sample.
+	 */
+	uint32_t firstSequence = 0;
+
+	double reference = 0;
+	double shiftedSum = 0;
+	double shiftedSumOfSquares = 0;
+	size_t removalsSinceRecomputation = 0;
+
+	const Sample& sampleAt(uint32_t sequence) const {
+		return samples[sequence - firstSequence];
+	}
+
+	void removeOldest() {
+		const double shifted = samples.front().value - reference;
+		shiftedSum -= shifted;
+		shiftedSumOfSquares -= shifted * shifted;
+
+		if (minimumCandidates.front() == firstSequence) {
+			minimumCandidates.pop_front();
+		}
+		if (maximumCandidates.front() == firstSequence) {
+			maximumCandidates.pop_front();
+		}
+		samples.pop_front();
+		firstSequence++;
+
+		if (++removalsSinceRecomputation >= Capacity) {
+			recomputeSums();
+		}
+	}
+
+	void recomputeSums() {
+		removalsSinceRecomputation = 0;
+		shiftedSum = 0;
+		shiftedSumOfSquares = 0;
+		if (samples.empty()) {
+			return;
+		}
+		reference = samples.front().value;
+		for (const Sample& sample: samples) {
+			const double shifted = sample.value - reference;
+			shiftedSum += shifted;
+			shiftedSumOfSquares += shifted * shifted;
+		}
+	}
+
+public:
+	/**
+	 * Adds the newest sample to the window, dropping the oldest one if the window is full.
+	 */
+	void add(double value, const Time::DefaultCUC& time) {
+		if (samples.full()) {
+			removeOldest();
+		}
+		if (samples.empty()) {
+			reference = value;
+		}
+
+		const uint32_t sequence = firstSequence + samples.size();
+		samples.push_back({value, time});
+		const double shifted = value - reference;
+		shiftedSum += shifted;
+		shiftedSumOfSquares += shifted * shifted;
+
+		// Equal values are kept, so that the oldest of several equal extrema is reported, as in cumulative statistics
+		while (not minimumCandidates.empty() and sampleAt(minimumCandidates.back()).value > value) {
+			minimumCandidates.pop_back();
+		}
+		minimumCandidates.push_back(sequence);
+		while (not maximumCandidates.empty() and sampleAt(maximumCandidates.back()).value < value) {
+			maximumCandidates.pop_back();
+		}
+		maximumCandidates.push_back(sequence);
+	}
+
+	/**
+	 * Drops the samples taken before oldestTime.
+	 */
+	void expire(const Time::DefaultCUC& oldestTime) {
+		while (not samples.empty() and samples.front().time < oldestTime) {
+			removeOldest();
+		}
+	}
+
+	void clear() {
+		samples.clear();
+		minimumCandidates.clear();
+		maximumCandidates.clear();
+		firstSequence = 0;
+		recomputeSums();
+	}
+
+	size_t size() const {
+		return samples.size();
+	}
+
+	static constexpr size_t capacity() {
+		return Capacity;
+	}
+
+	bool empty() const {
+		return samples.empty();
+	}
+
+	/**
+	 * @note The functions below must only be called on a non-empty window
+	 */
+	double min() const {
+		return sampleAt(minimumCandidates.front()).value;
+	}
+
+	Time::DefaultCUC timeOfMin() const {
+		return sampleAt(minimumCandidates.front()).time;
+	}
+
+	double max() const {
+		return sampleAt(maximumCandidates.front()).value;
+	}
+
+	Time::DefaultCUC timeOfMax() const {
+		return sampleAt(maximumCandidates.front()).time;
+	}
+
+	double mean() const {
+		return reference + shiftedSum / samples.size();
+	}
+
+	/**
+	 * @return The population standard deviation of the samples in the window
+	 */
+	double standardDeviation() const {
+		const double shiftedMean = shiftedSum / samples.size();
+		return std::sqrt(std::abs(shiftedSumOfSquares / samples.size() - shiftedMean * shiftedMean));
+	}
+
+	/**
+	 * @return The time of the oldest sample in the window, i.e. the start of the window
+	 */
+	Time::DefaultCUC oldestTime() const {
+		return samples.front().time;
+	}
+
+	/**
+	 * @return The time of the newest sample in the window, i.e. the end of the window
+	 */
+	Time::DefaultCUC newestTime() const {
+		return samples.back().time;
+	}
+
+	/**
+	 * Calls function(value) for every sample in the window, from the oldest to the newest.
+	 */
+	template <typename Function>
+	void forEach(Function&& function) const {
+		for (const Sample& sample: samples) {
+			function(sample.value);
+		}
+	}
+};
+
+/**
+ * A window that holds no samples, used when sliding-window statistics are not supported so that they take no memory.
+ */
+template <>
+class SlidingWindow<0> {
+public:
+	void add(double /*value*/, const Time::DefaultCUC& /*time*/) {}
+
+	void expire(const Time::DefaultCUC& /*oldestTime*/) {}
+
+	void clear() {}
+
+	size_t size() const {
+		return 0;
+	}
+
+	static constexpr size_t capacity() {
+		return 0;
+	}
+
+	bool empty() const {
+		return true;
+	}
+
+	double min() const {
+		return 0;
+	}
+
+	Time::DefaultCUC timeOfMin() const {
+		return {};
+	}
+
+	double max() const {
+		return 0;
+	}
+
+	Time::DefaultCUC timeOfMax() const {
+		return {};
+	}
+
+	double mean() const {
+		return 0;
+	}
+
+	double standardDeviation() const {
+		return 0;
+	}
+
+	Time::DefaultCUC oldestTime() const {
+		return {};
+	}
+
+	Time::DefaultCUC newestTime() const {
+		return {};
+	}
+
+	template <typename Function>
+	void forEach(Function&& /*function*/) const {}
+};
+
+#endif // ECSS_SERVICES_SLIDINGWINDOW_HPP
@@ -0,0 +1,217 @@
+#ifndef ECSS_SERVICES_SLOTPOOL_HPP
+#define ECSS_SERVICES_SLOTPOOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "etl/array.h"
+
+/**
+ * Reference to an object stored in a @ref SlotPool.
+ *
+ * A handle stays valid for as long as its object lives in the pool. Once the object is released, the generation of
+ * its slot changes, so the handle no longer resolves, even after the slot has been reused by another object.
+ *
+ * @note The generations are 32-bit counters, so an outdated handle could only resolve again after its slot has been
+ * reused 2^32 times, e.g. after about 50 days of reusing the same slot every millisecond.
+ */
+struct SlotHandle {
+	/**
+	 * Index that no slot can have, used by handles that do not refer to any object
+	 */
+	static constexpr uint16_t InvalidIndex = UINT16_MAX;
+
+	uint16_t index = InvalidIndex;
+	uint32_t generation = 0;
+
+	bool isValid() const {
+		return index != InvalidIndex;
+	}
+
+	bool operator==(const SlotHandle& other) const {
+		return index == other.index and generation == other.generation;
+	}
+
+	bool operator!=(const SlotHandle& other) const {
+		return not(*this == other);
+	}
+};
+
+/**
+ * Fixed-capacity pool of objects sharing the common base class Base, possibly of different derived types.
+ *
+ * Each slot holds the storage for one object. Free slots are linked in a free list, so that emplacing and releasing an
+ * object are O(1), and released slots are reused instead of growing the pool. Objects are accessed through
+ * @ref SlotHandle "SlotHandles", which are never invalidated by operations on other objects.
+ *
+ * @tparam Base The type through which the stored objects are accessed. It must have a virtual destructor if objects
+ * of derived types are stored.
+ * @tparam ObjectSize The storage size of each slot, i.e. the size of the largest type that will be stored
+ * @tparam Capacity The maximum number of objects that can be stored at the same time
+ */
+template <typename Base, size_t ObjectSize, size_t Capacity>
+class SlotPool {
+	static_assert(Capacity < SlotHandle::InvalidIndex, "The pool capacity must fit in a slot handle index");
+
+	struct Slot {
+		alignas(std::max_align_t) uint8_t storage[ObjectSize];
+		uint32_t generation = 0;
+		uint16_t nextFree = SlotHandle::InvalidIndex;
+		bool occupied = false;
+	};
+
+	etl::array<Slot, Capacity> slots;
+
+	/**
+	 * Index of the first free slot, or @ref SlotHandle::InvalidIndex if the pool is full
+	 */
+	uint16_t firstFree = 0;
+
+	/**
+	 * The number of stored objects
+	 */
+	uint16_t occupiedSlots = 0;
+
+	Base* objectAt(uint16_t index) {
+		return std::launder(reinterpret_cast<Base*>(slots[index].storage)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+	}
+
+	const Base* objectAt(uint16_t index) const {
+		return std::launder(reinterpret_cast<const Base*>(slots[index].storage)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+	}
+
+	bool resolves(SlotHandle handle) const {
+		if (handle.index >= Capacity) {
+			return false;
+		}
+		const Slot& slot = slots[handle.index];
+		return slot.occupied and slot.generation == handle.generation;
+	}
+
+public:
+	SlotPool() {
+		for (uint16_t index = 0; index < Capacity; index++) {
+			slots[index].nextFree = (index + 1U < Capacity) ? index + 1 : SlotHandle::InvalidIndex;
+		}
+		firstFree = (Capacity > 0) ? 0 : SlotHandle::InvalidIndex;
+	}
+
+	~SlotPool() {
+		clear();
+	}
+
+	SlotPool(const SlotPool&) = delete;
+	SlotPool& operator=(const SlotPool&) = delete;
+
+	/**
+	 * Constructs a new object of type Object in a free slot.
+	 *
+	 * @return The handle of the new object, or an invalid handle if the pool is full
+	 */
+	template <typename Object, typename... Args>
+	SlotHandle emplace(Args&&... args) {
+		static_assert(std::is_base_of_v<Base, Object>, "Only objects derived from the base type can be stored");
+		static_assert(sizeof(Object) <= ObjectSize, "The object does not fit in a slot");
+		static_assert(alignof(Object) <= alignof(std::max_align_t), "The object is over-aligned");
+
+		if (full()) {
+			return {};
+		}
+
+		const uint16_t index = firstFree;
+		Slot& slot = slots[index];
+		firstFree = slot.nextFree;
+
+		new (slot.storage) Object(std::forward<Args>(args)...);
+		slot.occupied = true;
+		occupiedSlots++;
+
+		return {index, slot.generation};
+	}
+
+	/**
+	 * Destroys the object referred to by a handle and returns its slot to the free list. Any other handle to the same
+	 * object becomes invalid.
+	 *
+	 * @return false if the handle did not refer to a stored object
+	 */
+	bool release(SlotHandle handle) {
+		if (get(handle) == nullptr) {
+			return false;
+		}
+
+		Slot& slot = slots[handle.index];
+		objectAt(handle.index)->~Base();
+		slot.occupied = false;
+		slot.generation++;
+		slot.nextFree = firstFree;
+		firstFree = handle.index;
+		occupiedSlots--;
+
+		return true;
+	}
+
+	/**
+	 * Destroys all the stored objects.
+	 */
+	void clear() {
+		for (uint16_t index = 0; index < Capacity; index++) {
+			if (slots[index].occupied) {
+				release({index, slots[index].generation});
+			}
+		}
+	}
+
+	/**
+	 * @return The object referred to by the handle, or nullptr if the handle is invalid or outdated
+	 */
+	Base* get(SlotHandle handle) {
+		return resolves(handle) ? objectAt(handle.index) : nullptr;
+	}
+
+	const Base* get(SlotHandle handle) const {
+		return resolves(handle) ? objectAt(handle.index) : nullptr;
+	}
+
+	/**
+	 * @return The handle of the object stored at a slot index, or an invalid handle if the slot is free
+	 */
+	SlotHandle handleAt(uint16_t index) const {
+		if (index >= Capacity or not slots[index].occupied) {
+			return {};
+		}
+		return {index, slots[index].generation};
+	}
+
+	/**
+	 * Calls function(handle, object) for every stored object, in slot order.
+	 */
+	template <typename Function>
+	void forEach(Function&& function) {
+		for (uint16_t index = 0; index < Capacity; index++) {
+			if (slots[index].occupied) {
+				function(SlotHandle{index, slots[index].generation}, *objectAt(index));
+			}
+		}
+	}
+
+	size_t size() const {
+		return occupiedSlots;
+	}
+
+	static constexpr size_t capacity() {
+		return Capacity;
+	}
+
+	bool empty() const {
+		return occupiedSlots == 0;
+	}
+
+	bool full() const {
+		return firstFree == SlotHandle::InvalidIndex;
+	}
+};
+
+#endif // ECSS_SERVICES_SLOTPOOL_HPP
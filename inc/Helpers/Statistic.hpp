@@ -1,12 +1,37 @@
 #ifndef ECSS_SERVICES_STATISTIC_HPP
 #define ECSS_SERVICES_STATISTIC_HPP
 
+#include <type_traits>
 #include "ECSS_Definitions.hpp"
 #include "ErrorHandler.hpp"
+#include "Helpers/QuantileSketch.hpp"
+#include "Helpers/SlidingWindow.hpp"
 #include "Service.hpp"
 #include "TimeGetter.hpp"
+#include "etl/span.h"
 #include "etl/vector.h"
 
+/**
+ * Stand-in for the quantile sketch of a @ref Statistic when @ref SupportsQuantiles is not set, so that statistics do
+ * not hold the buckets of a sketch they never use
+ */
+class NoQuantileSketch {
+public:
+	explicit NoQuantileSketch(double /*relativeAccuracy*/) {}
+
+	void add(double /*value*/) {}
+
+	void reset() {}
+
+	uint32_t count() const {
+		return 0;
+	}
+
+	double quantile(double /*quantile*/) const {
+		return 0;
+	}
+};
+
 /**
  * Class containing all the statistics for every parameter. Includes functions that calculate and append the
  * statistics to messages
@@ -19,9 +44,38 @@ public:
 	Time::DefaultCUC timeOfMinValue;
 	double max = -std::numeric_limits<double>::infinity();
 	double min = std::numeric_limits<double>::infinity();
-	double sumOfSquares = 0;
+	/**
+	 * The sum of the squared deviations of the samples from their mean, which is updated with Welford's algorithm.
+	 * Unlike a plain sum of squares, it does not lose precision when the mean is large compared to the deviation.
+	 */
+	double sumOfSquaredDeviations = 0;
 	double mean = 0;
 
+	/**
+	 * The distribution of the samples, from which the @ref ECSSStatisticsReportedQuantiles are reported. It only
+	 * takes memory if @ref SupportsQuantiles is set.
+	 */
+	std::conditional_t<SupportsQuantiles, QuantileSketch<ECSSStatisticsQuantileBuckets>, NoQuantileSketch> quantiles{
+	    ECSSStatisticsQuantileRelativeAccuracy};
+
+	/**
+	 * The length of the sliding window over which the statistics are evaluated, or 0 if they are evaluated over all
+	 * the samples since the last reset
+	 */
+	std::chrono::milliseconds windowLength{0};
+
+	/**
+	 * The samples of the sliding window, if @ref windowLength is set. In that case, the cumulative statistics above
+	 * are not updated. It only takes memory if @ref SupportsSlidingWindowStatistics is set.
+	 */
+	SlidingWindow<SupportsSlidingWindowStatistics ? ECSSStatisticsMaxWindowSamples : 0> window;
+
+	/**
+	 * The time at which the parameter is due to be sampled next by the sampling engine of ST[04], i.e. the time of
+	 * its only valid entry in the sampling schedule
+	 */
+	Time::DefaultCUC nextSampleTime;
+
 	Statistic() = default;
 
 	/**
@@ -30,6 +84,26 @@ public:
 	 */
 	void updateStatistics(double value);
 
+	/**
+	 * Updates the statistics with a sample whose timestamp is already known, without reading the current time
+	 * @param sampleTime The time at which the value was sampled
+	 */
+	void updateStatistics(double value, const Time::DefaultCUC& sampleTime);
+
+	/**
+	 * Updates the statistics with a batch of samples.
+	 *
+	 * The batch is reduced on its own, with independent accumulators that the compiler can vectorise, and the result
+	 * is merged into the existing statistics with the parallel variant of Welford's algorithm (Chan et al.). This
+	 * gives the same result as updating the samples one by one, within rounding.
+	 *
+	 * @param samples The sampled values, in sampling order
+	 * @param firstSampleTime The time at which the first sample was taken
+	 * @param samplingPeriod The time between consecutive samples, used to timestamp the minimum and the maximum
+	 */
+	void updateStatistics(etl::span<const double> samples, const Time::DefaultCUC& firstSampleTime,
+	                      std::chrono::milliseconds samplingPeriod = std::chrono::milliseconds(0));
+
 	/**
 	 * Resets all statistics calculated to default values
 	 */
@@ -46,10 +120,60 @@ public:
 	 */
 	void setSelfSamplingInterval(SamplingInterval samplingInterval);
 
+	/**
+	 * Switches between sliding-window and cumulative statistics, resetting the statistics.
+	 *
+	 * The window must be able to hold all the samples taken during its length at @ref selfSamplingInterval, so the
+	 * lengths that need more than @ref ECSSStatisticsMaxWindowSamples samples are refused, as are all the windows if
+	 * @ref SupportsSlidingWindowStatistics is not set.
+	 *
+	 * @param length The length of the sliding window, or 0 for cumulative statistics
+	 * @return false if the length was refused, in which case the statistic is not changed
+	 */
+	bool setWindowLength(std::chrono::milliseconds length);
+
+	/**
+	 * @return true if a window of the given length can hold all the samples taken during it every samplingInterval
+	 * milliseconds. A length of 0, i.e. cumulative statistics, always fits.
+	 */
+	static bool windowFits(std::chrono::milliseconds length, SamplingInterval samplingInterval);
+
+	bool isWindowed() const {
+		return windowLength.count() > 0;
+	}
+
+	/**
+	 * Drops the samples that have left the sliding window at currentTime. Does nothing for cumulative statistics.
+	 */
+	void expireWindow(const Time::DefaultCUC& currentTime);
+
+	/**
+	 * @return The number of samples the reported statistics are evaluated over
+	 */
+	ParameterSampleCount getSampleCount() const {
+		return isWindowed() ? window.size() : sampleCounter;
+	}
+
 	/**
 	 * Check if all the statistics are initialized
 	 */
 	bool statisticsAreInitialized() const;
+
+	/**
+	 * @return The population standard deviation of the samples
+	 */
+	double standardDeviation() const;
+
+private:
+	/**
+	 * Appends the statistics of the samples in the sliding window, in the same format as the cumulative ones
+	 */
+	void appendWindowStatisticsToMessage(Message& report) const;
+
+	/**
+	 * Adds a single value to the sample count, the mean and the sum of squared deviations
+	 */
+	void accumulate(double value);
 };
 
 #endif
@@ -0,0 +1,164 @@
+#ifndef ECSS_SERVICES_TCARENA_HPP
+#define ECSS_SERVICES_TCARENA_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include "Helpers/SlotPool.hpp"
+#include "etl/algorithm.h"
+#include "etl/array.h"
+#include "etl/span.h"
+
+/**
+ * Fixed-size storage of serialized telecommands of different lengths, e.g. the requests held by a schedule.
+ *
+ * Every telecommand takes only as many bytes as its packet, instead of a whole @ref Message. The packets are stored
+ * one after the other in a single byte array, and their locations are kept in a @ref SlotPool, whose handles refer to
+ * the packets. When a packet does not fit after the last one but enough bytes have been released, the stored packets
+ * are moved to the start of the array, which only changes their locations in the pool, so handles stay valid.
+ *
+ * @tparam ArenaSize The number of bytes available for the packets
+ * @tparam MaxEntries The maximum number of packets that can be stored at the same time
+ */
+template <size_t ArenaSize, size_t MaxEntries>
+class TCArena {
+	static_assert(ArenaSize <= UINT32_MAX, "The offsets in the arena must fit in 32 bits");
+
+	/**
+	 * The type of the offsets in the byte array, which takes 16 bits in an arena of at most 64 KiB
+	 */
+	using Offset = std::conditional_t<ArenaSize <= UINT16_MAX, uint16_t, uint32_t>;
+
+	/**
+	 * The location of a stored packet in the byte array
+	 */
+	struct Entry {
+		Offset offset;
+		uint16_t length;
+
+		Entry(Offset offset, uint16_t length) : offset(offset), length(length) {}
+	};
+
+	etl::array<uint8_t, ArenaSize> bytes;
+	SlotPool<Entry, sizeof(Entry), MaxEntries> entries;
+
+	/**
+	 * The offset after the last stored packet
+	 */
+	Offset end = 0;
+
+	/**
+	 * The number of bytes taken by the stored packets
+	 */
+	Offset storedBytes = 0;
+
+	/**
+	 * Moves all the stored packets to the start of the array, in their current order, so that the free bytes are all
+	 * at its end
+	 */
+	void compact() {
+		etl::array<Entry*, MaxEntries> order;
+		size_t count = 0;
+		entries.forEach([&order, &count](SlotHandle /*handle*/, Entry& entry) {
+			order[count++] = &entry;
+		});
+		etl::sort(order.begin(), order.begin() + count, [](const Entry* a, const Entry* b) {
+			return a->offset < b->offset;
+		});
+
+		end = 0;
+		for (size_t position = 0; position < count; position++) {
+			Entry& entry = *order[position];
+			etl::copy(bytes.begin() + entry.offset, bytes.begin() + entry.offset + entry.length, bytes.begin() + end);
+			entry.offset = end;
+			end += entry.length;
+		}
+	}
+
+public:
+	/**
+	 * Copies a packet into the arena.
+	 *
+	 * @return The handle of the stored packet, or an invalid handle if the packet is empty or there is not enough
+	 * space
+	 */
+	SlotHandle store(const uint8_t* packet, uint16_t length) {
+		if ((length == 0) or full() or (storedBytes + length > ArenaSize)) {
+			return {};
+		}
+		if (end + length > ArenaSize) {
+			compact();
+		}
+
+		etl::copy(packet, packet + length, bytes.begin() + end);
+		const SlotHandle handle = entries.template emplace<Entry>(end, length);
+		end += length;
+		storedBytes += length;
+
+		return handle;
+	}
+
+	/**
+	 * Releases the bytes of a stored packet. Any other handle to the same packet becomes invalid.
+	 *
+	 * @return false if the handle did not refer to a stored packet
+	 */
+	bool release(SlotHandle handle) {
+		const Entry* entry = entries.get(handle);
+		if (entry == nullptr) {
+			return false;
+		}
+
+		storedBytes -= entry->length;
+		entries.release(handle);
+		if (entries.empty()) {
+			end = 0;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @return The bytes of a stored packet, or an empty span if the handle is invalid or outdated. The bytes may move
+	 * when other packets are stored.
+	 */
+	etl::span<const uint8_t> get(SlotHandle handle) const {
+		const Entry* entry = entries.get(handle);
+		if (entry == nullptr) {
+			return {};
+		}
+		return {bytes.data() + entry->offset, entry->length};
+	}
+
+	/**
+	 * Releases all the stored packets.
+	 */
+	void clear() {
+		entries.clear();
+		storedBytes = 0;
+		end = 0;
+	}
+
+	size_t size() const {
+		return entries.size();
+	}
+
+	bool full() const {
+		return entries.full();
+	}
+
+	/**
+	 * @return The number of bytes taken by the stored packets
+	 */
+	size_t usedBytes() const {
+		return storedBytes;
+	}
+
+	/**
+	 * @return The number of bytes that are still available for new packets
+	 */
+	size_t availableBytes() const {
+		return ArenaSize - storedBytes;
+	}
+};
+
+#endif // ECSS_SERVICES_TCARENA_HPP
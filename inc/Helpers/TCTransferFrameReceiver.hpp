@@ -0,0 +1,339 @@
+#ifndef ECSS_SERVICES_TCTRANSFERFRAMERECEIVER_HPP
+#define ECSS_SERVICES_TCTRANSFERFRAMERECEIVER_HPP
+
+#include <cstdint>
+#include <cstring>
+#include "ECSS_Definitions.hpp"
+#include "Helpers/CRCHelper.hpp"
+#include "MessageParser.hpp"
+#include "etl/array.h"
+
+/**
+ * Receiver of the CCSDS TC Transfer Frames (CCSDS 232.0-B) of a virtual channel, which extracts the TC packets they
+ * carry and hands them to the parser.
+ *
+ * Every frame is checked against its length and its Frame Error Control Field, which uses the table-driven CRC of
+ * @ref CRCHelper. The sequence-controlled (Type-AD) frames go through the FARM-1 state machine of COP-1
+ * (CCSDS 232.1-B), so that only the frame with the expected sequence number is accepted, while the expedited (Type-BD)
+ * frames bypass it, and the control commands (Type-BC) unlock the FARM or set its expected sequence number. The state
+ * of the FARM is reported to the ground through the @ref clcw, e.g. in the Operational Control Field of TM frames.
+ *
+ * The data field of every frame starts with a segment header. The packets of an unsegmented frame are parsed straight
+ * from the bytes of the frame. The segments of a packet that is split over several frames are collected into a
+ * preallocated buffer, and the packet is parsed from there when its last segment arrives. Only one packet can be
+ * reassembled at a time, so a new first segment abandons an incomplete packet.
+ */
+class TCTransferFrameReceiver {
+public:
+	static constexpr uint16_t PrimaryHeaderSize = 5;
+	static constexpr uint16_t SegmentHeaderSize = 1;
+	static constexpr uint16_t ErrorControlFieldSize = 2;
+
+	/**
+	 * What happened to a received frame
+	 */
+	enum class FrameResult : uint8_t {
+		/**
+		 * The frame was accepted, and its packets or control command were processed
+		 */
+		Accepted,
+		/**
+		 * The frame does not belong to the virtual channel of the receiver, and was ignored
+		 */
+		OtherVirtualChannel,
+		/**
+		 * The frame is malformed, or its length does not match its header
+		 */
+		InvalidFrame,
+		/**
+		 * The Frame Error Control Field of the frame is wrong
+		 */
+		InvalidCRC,
+		/**
+		 * The sequence-controlled frame was discarded by the FARM
+		 */
+		Discarded,
+	};
+
+	enum class FARMState : uint8_t {
+		Open = 1,
+		Wait = 2,
+		Lockout = 3,
+	};
+
+	/**
+	 * The sequence flags of a segment header
+	 */
+	enum SequenceFlags : uint8_t {
+		ContinuingSegment = 0b00,
+		FirstSegment = 0b01,
+		LastSegment = 0b10,
+		Unsegmented = 0b11,
+	};
+
+private:
+	uint16_t spacecraftId;
+	uint8_t virtualChannel;
+
+	/**
+	 * The widths of the positive and negative parts of the sliding window, each half of its width W
+	 */
+	uint8_t positiveWindowWidth;
+	uint8_t negativeWindowWidth;
+
+	FARMState farmState = FARMState::Open;
+
+	/**
+	 * V(R), the sequence number of the next expected Type-AD frame
+	 */
+	uint8_t receiverFrameSequenceNumber = 0;
+
+	bool lockoutFlag = false;
+	bool waitFlag = false;
+	bool retransmitFlag = false;
+
+	/**
+	 * The number of accepted Type-BD and Type-BC frames, modulo 4
+	 */
+	uint8_t farmBCounter = 0;
+
+	/**
+	 * Whether the next layer can accept the packets of another frame
+	 */
+	bool bufferAvailable = true;
+
+	etl::array<uint8_t, CCSDSMaxMessageSize> reassemblyBuffer{};
+	uint16_t reassembledLength = 0;
+	uint8_t reassemblyMapId = 0;
+	bool reassembling = false;
+
+	/**
+	 * Parses the packets that fill a number of bytes, one after the other
+	 *
+	 * @return false if the bytes do not end with a whole packet
+	 */
+	template <typename Handler>
+	bool handPackets(const uint8_t* data, uint16_t length, Handler& handler) {
+		while (length > 0) {
+			const uint16_t packetLength = MessageParser::packetLength(data, length);
+			if (packetLength == 0) {
+				return false;
+			}
+			Message message = MessageParser::parseEmbeddedTC(data, packetLength);
+			handler(message);
+			data += packetLength;
+			length -= packetLength;
+		}
+		return true;
+	}
+
+	/**
+	 * Passes the data field of an accepted Type-AD or Type-BD frame, with its segment header, to the next layer
+	 */
+	template <typename Handler>
+	void handDataField(const uint8_t* data, uint16_t length, Handler& handler) {
+		if (length < SegmentHeaderSize) {
+			segmentErrors++;
+			return;
+		}
+		const auto sequenceFlags = static_cast<SequenceFlags>(data[0] >> 6U);
+		const uint8_t mapId = data[0] & 0x3FU;
+		data += SegmentHeaderSize;
+		length -= SegmentHeaderSize;
+
+		if (sequenceFlags == Unsegmented) {
+			if (not handPackets(data, length, handler)) {
+				segmentErrors++;
+			}
+			return;
+		}
+
+		if (sequenceFlags == FirstSegment) {
+			if (reassembling) {
+				segmentErrors++;
+			}
+			reassembling = true;
+			reassembledLength = 0;
+			reassemblyMapId = mapId;
+		} else if (not reassembling or mapId != reassemblyMapId) {
+			segmentErrors++;
+			return;
+		}
+
+		if (reassembledLength + length > reassemblyBuffer.size()) {
+			reassembling = false;
+			segmentErrors++;
+			return;
+		}
+		std::memcpy(reassemblyBuffer.data() + reassembledLength, data, length);
+		reassembledLength += length;
+
+		if (sequenceFlags == LastSegment) {
+			reassembling = false;
+			if (not handPackets(reassemblyBuffer.data(), reassembledLength, handler)) {
+				segmentErrors++;
+			}
+		}
+	}
+
+	/**
+	 * Runs the FARM-1 for a Type-AD frame
+	 *
+	 * @return true if the frame is accepted
+	 */
+	bool acceptSequenceControlledFrame(uint8_t sequenceNumber) {
+		if (farmState == FARMState::Lockout) {
+			return false;
+		}
+
+		const auto offset = static_cast<uint8_t>(sequenceNumber - receiverFrameSequenceNumber);
+		if (offset == 0) {
+			if (farmState == FARMState::Open and bufferAvailable) {
+				receiverFrameSequenceNumber++;
+				retransmitFlag = false;
+				return true;
+			}
+			retransmitFlag = true;
+			waitFlag = true;
+			farmState = FARMState::Wait;
+		} else if (offset < positiveWindowWidth) {
+			// A frame has been lost, so the sender has to retransmit from V(R)
+			retransmitFlag = true;
+		} else if (offset < 256 - negativeWindowWidth) {
+			lockoutFlag = true;
+			farmState = FARMState::Lockout;
+		}
+		// Frames in the negative window have already been accepted, and are discarded silently
+		return false;
+	}
+
+	/**
+	 * Executes a Type-BC frame
+	 *
+	 * @return false if it is not a valid control command
+	 */
+	bool executeControlCommand(const uint8_t* data, uint16_t length) {
+		const bool isUnlock = (length == 1) and (data[0] == 0x00);
+		const bool isSetVR = (length == 3) and (data[0] == 0x82) and (data[1] == 0x00);
+		if (not isUnlock and not isSetVR) {
+			return false;
+		}
+
+		if (isUnlock) {
+			lockoutFlag = false;
+			waitFlag = false;
+			retransmitFlag = false;
+			farmState = FARMState::Open;
+		} else if (farmState != FARMState::Lockout) {
+			receiverFrameSequenceNumber = data[2];
+			waitFlag = false;
+			retransmitFlag = false;
+			farmState = FARMState::Open;
+		}
+		farmBCounter = (farmBCounter + 1) & 0x03U;
+		return true;
+	}
+
+public:
+	/**
+	 * The number of segments that were dropped because they could not be reassembled into whole packets
+	 */
+	uint32_t segmentErrors = 0;
+
+	/**
+	 * @param spacecraftId The 10-bit spacecraft identifier of the accepted frames
+	 * @param virtualChannel The 6-bit virtual channel identifier of the accepted frames
+	 * @param windowWidth The width W of the FARM-1 sliding window
+	 */
+	explicit TCTransferFrameReceiver(uint16_t spacecraftId, uint8_t virtualChannel,
+	                                 uint8_t windowWidth = CCSDSFARMSlidingWindowWidth)
+	    : spacecraftId(spacecraftId & 0x3FFU), virtualChannel(virtualChannel & 0x3FU),
+	      positiveWindowWidth(windowWidth / 2), negativeWindowWidth(windowWidth / 2) {}
+
+	/**
+	 * Processes a received frame, and calls handler(message) for every whole packet that it completes.
+	 */
+	template <typename Handler>
+	FrameResult receiveFrame(const uint8_t* frame, uint16_t length, Handler&& handler) {
+		if (length < PrimaryHeaderSize + ErrorControlFieldSize or length > CCSDSMaxTCFrameLength) {
+			return FrameResult::InvalidFrame;
+		}
+		const uint16_t frameLength = (((frame[2] & 0x03U) << 8U) | frame[3]) + 1;
+		if ((frame[0] >> 6U) != 0 or frameLength != length) {
+			return FrameResult::InvalidFrame;
+		}
+		if (CRCHelper::validateCRC(frame, length) != 0) {
+			return FrameResult::InvalidCRC;
+		}
+
+		const uint16_t frameSpacecraftId = ((frame[0] & 0x03U) << 8U) | frame[1];
+		if (frameSpacecraftId != spacecraftId or (frame[2] >> 2U) != virtualChannel) {
+			return FrameResult::OtherVirtualChannel;
+		}
+
+		const bool bypass = (frame[0] & 0x20U) != 0;
+		const bool controlCommand = (frame[0] & 0x10U) != 0;
+		const uint8_t* data = frame + PrimaryHeaderSize;
+		const uint16_t dataLength = length - PrimaryHeaderSize - ErrorControlFieldSize;
+
+		if (controlCommand) {
+			if (not bypass or not executeControlCommand(data, dataLength)) {
+				return FrameResult::InvalidFrame;
+			}
+			return FrameResult::Accepted;
+		}
+
+		if (bypass) {
+			if (not bufferAvailable) {
+				return FrameResult::Discarded;
+			}
+			farmBCounter = (farmBCounter + 1) & 0x03U;
+		} else if (not acceptSequenceControlledFrame(frame[4])) {
+			return FrameResult::Discarded;
+		}
+		handDataField(data, dataLength, handler);
+		return FrameResult::Accepted;
+	}
+
+	/**
+	 * Processes a received frame, and executes every TC packet that it completes.
+	 */
+	FrameResult receiveFrame(const uint8_t* frame, uint16_t length) {
+		return receiveFrame(frame, length, [](Message& message) { MessageParser::execute(message); });
+	}
+
+	/**
+	 * Signals whether the next layer can accept more packets. When it cannot, the FARM enters the Wait state on the
+	 * next expected Type-AD frame, and leaves it when the buffer becomes available again.
+	 */
+	void setBufferAvailable(bool available) {
+		bufferAvailable = available;
+		if (available and farmState == FARMState::Wait) {
+			waitFlag = false;
+			farmState = FARMState::Open;
+		}
+	}
+
+	/**
+	 * @return The Communications Link Control Word that reports the state of the FARM
+	 */
+	uint32_t clcw() const {
+		// Control word type 0, version 0, no status, with COP-1 in effect
+		return (1U << 24U) | (static_cast<uint32_t>(virtualChannel) << 18U) | (lockoutFlag ? (1U << 13U) : 0U) |
+		       (waitFlag ? (1U << 12U) : 0U) | (retransmitFlag ? (1U << 11U) : 0U) |
+		       (static_cast<uint32_t>(farmBCounter) << 9U) | receiverFrameSequenceNumber;
+	}
+
+	FARMState state() const {
+		return farmState;
+	}
+
+	/**
+	 * @return V(R), the sequence number of the next expected Type-AD frame
+	 */
+	uint8_t expectedSequenceNumber() const {
+		return receiverFrameSequenceNumber;
+	}
+};
+
+#endif // ECSS_SERVICES_TCTRANSFERFRAMERECEIVER_HPP
@@ -0,0 +1,374 @@
+#ifndef ECSS_SERVICES_TMTRANSFERFRAMEGENERATOR_HPP
+#define ECSS_SERVICES_TMTRANSFERFRAMEGENERATOR_HPP
+
+#include <cstdint>
+#include <cstring>
+#include "Helpers/CRCHelper.hpp"
+#include "etl/algorithm.h"
+#include "etl/array.h"
+#include "etl/span.h"
+
+/**
+ * Generator of fixed-length CCSDS TM Transfer Frames (CCSDS 132.0-B), which multiplexes the space packets of up to
+ * eight virtual channels into a single stream of frames.
+ *
+ * Every virtual channel has a queue of packets, which refers to the bytes of the composed packets instead of copying
+ * them, so the bytes of a packet are only copied once, into the data field of a frame. A packet that does not fit in
+ * the rest of a frame continues in the next frame of its virtual channel, and the first header pointer of every frame
+ * points to the first packet that starts in it. The packets of a queue are released in order, after their last byte
+ * has been placed in a frame, and their bytes must stay valid until then.
+ *
+ * One frame is generated for every call of @ref generateFrame, as a physical channel needs a continuous stream of
+ * frames. Only the virtual channels with the highest priority among those with any data waiting are served. Between
+ * them, the ones that have a whole frame of data waiting are served first, then those with some data, whose frame is
+ * completed with an idle packet, and virtual channels that are equally ready share the frames through a weighted
+ * round-robin: every one of them is served up to 'weight' times in a round. If no virtual channel has any data, an
+ * Only Idle Data frame is generated on @ref IdleVirtualChannel.
+ *
+ * @tparam FrameLength The length of every frame, including its header and trailer
+ * @tparam PacketsPerChannel The maximum number of packets waiting in the queue of each virtual channel
+ */
+template <size_t FrameLength, size_t PacketsPerChannel>
+class TMTransferFrameGenerator {
+public:
+	static constexpr uint8_t VirtualChannels = 8;
+
+	/**
+	 * The virtual channel of the Only Idle Data frames, which does not carry any packets
+	 */
+	static constexpr uint8_t IdleVirtualChannel = 7;
+
+	static constexpr size_t PrimaryHeaderSize = 6;
+	static constexpr size_t OperationalControlFieldSize = 4;
+	static constexpr size_t ErrorControlFieldSize = 2;
+
+	/**
+	 * The first header pointer of a frame in which no packet starts
+	 */
+	static constexpr uint16_t NoPacketStart = 0x7FF;
+
+	/**
+	 * The first header pointer of an Only Idle Data frame
+	 */
+	static constexpr uint16_t OnlyIdleData = 0x7FE;
+
+	/**
+	 * The byte that fills idle packets and Only Idle Data frames
+	 */
+	static constexpr uint8_t IdlePattern = 0x55;
+
+private:
+	static_assert(FrameLength > PrimaryHeaderSize + OperationalControlFieldSize + ErrorControlFieldSize,
+	              "A frame must have space for its data field");
+	static_assert(FrameLength <= 2048, "The first header pointer must be able to address the whole data field");
+
+	/**
+	 * The smallest space packet, with a primary header and a single byte of data
+	 */
+	static constexpr uint16_t MinimumIdlePacketLength = 7;
+
+	static constexpr uint16_t IdleApplicationId = 0x7FF;
+
+	struct Channel {
+		etl::array<etl::span<const uint8_t>, PacketsPerChannel> packets;
+		size_t firstPacket = 0;
+		size_t packetCount = 0;
+
+		/**
+		 * The bytes of the first packet that have already been placed in frames
+		 */
+		size_t packetOffset = 0;
+
+		/**
+		 * The bytes of all the queued packets that have not been placed in frames yet
+		 */
+		size_t queuedBytes = 0;
+
+		/**
+		 * The length of an idle packet that did not fit in the previous frame, and the bytes of it already placed
+		 */
+		uint16_t idleLength = 0;
+		uint16_t idleOffset = 0;
+
+		uint8_t frameCount = 0;
+		uint8_t priority = 0;
+		uint8_t weight = 1;
+		uint8_t credits = 1;
+	};
+
+	etl::array<Channel, VirtualChannels> channels;
+
+	uint16_t spacecraftId;
+	bool hasOperationalControlField;
+	bool hasErrorControlField;
+	uint32_t operationalControlField = 0;
+
+	uint8_t masterFrameCount = 0;
+
+	/**
+	 * The virtual channel that was served last, where the round-robin continues from
+	 */
+	uint8_t lastChannel = VirtualChannels - 1;
+
+	size_t dataFieldLength() const {
+		return FrameLength - PrimaryHeaderSize - (hasOperationalControlField ? OperationalControlFieldSize : 0) -
+		       (hasErrorControlField ? ErrorControlFieldSize : 0);
+	}
+
+	size_t unplacedBytes(const Channel& channel) const {
+		return channel.queuedBytes + (channel.idleLength - channel.idleOffset);
+	}
+
+	/**
+	 * Writes the bytes [from, from + count) of an idle packet of some length
+	 */
+	static void writeIdlePacket(uint8_t* destination, uint16_t length, uint16_t from, uint16_t count) {
+		const uint16_t dataLength = length - PrimaryHeaderSize - 1;
+		const etl::array<uint8_t, PrimaryHeaderSize> header = {
+		    static_cast<uint8_t>(IdleApplicationId >> 8U), static_cast<uint8_t>(IdleApplicationId & 0xFFU), 0xC0, 0,
+		    static_cast<uint8_t>(dataLength >> 8U), static_cast<uint8_t>(dataLength & 0xFFU)};
+		for (uint16_t byte = from; byte < from + count; byte++) {
+			*destination++ = (byte < PrimaryHeaderSize) ? header[byte] : IdlePattern;
+		}
+	}
+
+	/**
+	 * @return The highest priority of the virtual channels with pending bytes, or -1 if no virtual channel has any
+	 */
+	int highestPendingPriority() const {
+		int highestPriority = -1;
+		for (const Channel& channel: channels) {
+			if (channel.queuedBytes > 0 and unplacedBytes(channel) > 0 and channel.priority > highestPriority) {
+				highestPriority = channel.priority;
+			}
+		}
+		return highestPriority;
+	}
+
+	/**
+	 * Chooses the next virtual channel of a priority to serve, among those with at least some pending bytes
+	 *
+	 * @return The chosen virtual channel, or VirtualChannels if no virtual channel of the priority has as many bytes
+	 */
+	uint8_t selectChannel(int priority, size_t minimumBytes) {
+		bool ready = false;
+		for (uint8_t round = 0; round < 2; round++) {
+			for (uint8_t step = 1; step <= VirtualChannels; step++) {
+				const uint8_t index = (lastChannel + step) % VirtualChannels;
+				Channel& channel = channels[index];
+				if (channel.queuedBytes == 0 or unplacedBytes(channel) < minimumBytes or channel.priority != priority) {
+					continue;
+				}
+				ready = true;
+				if (channel.credits > 0) {
+					channel.credits--;
+					lastChannel = index;
+					return index;
+				}
+			}
+			if (not ready) {
+				break;
+			}
+			// Every ready virtual channel of this priority has been served as many times as its weight
+			for (Channel& channel: channels) {
+				if (channel.priority == priority) {
+					channel.credits = channel.weight;
+				}
+			}
+		}
+		return VirtualChannels;
+	}
+
+	/**
+	 * Fills a data field with the pending bytes of a virtual channel, and completes it with an idle packet
+	 *
+	 * @return The first header pointer of the frame
+	 */
+	uint16_t fillDataField(Channel& channel, uint8_t* data, size_t length) {
+		uint16_t firstHeaderPointer = NoPacketStart;
+		size_t position = 0;
+
+		if (channel.idleLength > 0) {
+			const auto count = static_cast<uint16_t>(etl::min<size_t>(channel.idleLength - channel.idleOffset, length));
+			writeIdlePacket(data, channel.idleLength, channel.idleOffset, count);
+			position += count;
+			channel.idleOffset += count;
+			if (channel.idleOffset == channel.idleLength) {
+				channel.idleLength = 0;
+				channel.idleOffset = 0;
+			}
+		}
+
+		while (position < length and channel.packetCount > 0) {
+			const etl::span<const uint8_t>& packet = channel.packets[channel.firstPacket];
+			if (channel.packetOffset == 0 and firstHeaderPointer == NoPacketStart) {
+				firstHeaderPointer = position;
+			}
+			const size_t count = etl::min(packet.size() - channel.packetOffset, length - position);
+			std::memcpy(data + position, packet.data() + channel.packetOffset, count);
+			position += count;
+			channel.packetOffset += count;
+			channel.queuedBytes -= count;
+			if (channel.packetOffset == packet.size()) {
+				channel.firstPacket = (channel.firstPacket + 1) % PacketsPerChannel;
+				channel.packetCount--;
+				channel.packetOffset = 0;
+			}
+		}
+
+		if (position < length) {
+			// An idle packet cannot be shorter than a packet header and a byte, so it may continue in the next frame
+			const auto remaining = static_cast<uint16_t>(length - position);
+			const uint16_t idleLength = etl::max(remaining, MinimumIdlePacketLength);
+			const uint16_t count = etl::min(remaining, idleLength);
+			writeIdlePacket(data + position, idleLength, 0, count);
+			if (count < idleLength) {
+				channel.idleLength = idleLength;
+				channel.idleOffset = count;
+			}
+			if (firstHeaderPointer == NoPacketStart) {
+				firstHeaderPointer = position;
+			}
+		}
+		return firstHeaderPointer;
+	}
+
+	void writePrimaryHeader(uint8_t* frame, uint8_t virtualChannel, uint8_t virtualChannelFrameCount,
+	                        uint16_t firstHeaderPointer) const {
+		frame[0] = static_cast<uint8_t>((spacecraftId >> 4U) & 0x3FU);
+		frame[1] = static_cast<uint8_t>(((spacecraftId & 0x0FU) << 4U) | (virtualChannel << 1U) |
+		                                (hasOperationalControlField ? 1U : 0U));
+		frame[2] = masterFrameCount;
+		frame[3] = virtualChannelFrameCount;
+		// No secondary header, synchronization flag '0' for octet-synchronized and forward-ordered packets, and the
+		// segment length identifier set to '11'
+		frame[4] = static_cast<uint8_t>(0x18U | (firstHeaderPointer >> 8U));
+		frame[5] = static_cast<uint8_t>(firstHeaderPointer & 0xFFU);
+	}
+
+	void writeTrailer(uint8_t* frame) const {
+		size_t position = FrameLength - (hasErrorControlField ? ErrorControlFieldSize : 0);
+		if (hasOperationalControlField) {
+			position -= OperationalControlFieldSize;
+			frame[position] = static_cast<uint8_t>(operationalControlField >> 24U);
+			frame[position + 1] = static_cast<uint8_t>(operationalControlField >> 16U);
+			frame[position + 2] = static_cast<uint8_t>(operationalControlField >> 8U);
+			frame[position + 3] = static_cast<uint8_t>(operationalControlField);
+		}
+		if (hasErrorControlField) {
+			const uint16_t crc = CRCHelper::calculateCRC(frame, FrameLength - ErrorControlFieldSize);
+			frame[FrameLength - 2] = static_cast<uint8_t>(crc >> 8U);
+			frame[FrameLength - 1] = static_cast<uint8_t>(crc & 0xFFU);
+		}
+	}
+
+public:
+	/**
+	 * @param spacecraftId The 10-bit spacecraft identifier of the frames
+	 * @param hasOperationalControlField Whether the frames carry an Operational Control Field, e.g. a CLCW
+	 * @param hasErrorControlField Whether the frames end with a Frame Error Control Field
+	 */
+	explicit TMTransferFrameGenerator(uint16_t spacecraftId, bool hasOperationalControlField = false,
+	                                  bool hasErrorControlField = true)
+	    : spacecraftId(spacecraftId & 0x3FFU), hasOperationalControlField(hasOperationalControlField),
+	      hasErrorControlField(hasErrorControlField) {}
+
+	/**
+	 * Queues a composed space packet on a virtual channel. The packet is referred to, not copied, so its bytes must
+	 * stay valid until it has been released.
+	 *
+	 * @return false if the virtual channel is invalid, or its queue is full
+	 */
+	bool queuePacket(uint8_t virtualChannel, etl::span<const uint8_t> packet) {
+		if (virtualChannel >= VirtualChannels or virtualChannel == IdleVirtualChannel or packet.empty()) {
+			return false;
+		}
+		Channel& channel = channels[virtualChannel];
+		if (channel.packetCount == PacketsPerChannel) {
+			return false;
+		}
+		channel.packets[(channel.firstPacket + channel.packetCount) % PacketsPerChannel] = packet;
+		channel.packetCount++;
+		channel.queuedBytes += packet.size();
+		return true;
+	}
+
+	/**
+	 * Sets how a virtual channel is multiplexed with the others.
+	 *
+	 * @param priority The virtual channels with a higher priority are always served first
+	 * @param weight The number of frames of the virtual channel in every round of the virtual channels with the same
+	 * priority
+	 * @return false if the virtual channel or the weight is invalid
+	 */
+	bool setMultiplexing(uint8_t virtualChannel, uint8_t priority, uint8_t weight) {
+		if (virtualChannel >= VirtualChannels or weight == 0) {
+			return false;
+		}
+		channels[virtualChannel].priority = priority;
+		channels[virtualChannel].weight = weight;
+		channels[virtualChannel].credits = weight;
+		return true;
+	}
+
+	/**
+	 * Sets the Operational Control Field of the next frames.
+	 */
+	void setOperationalControlField(uint32_t value) {
+		operationalControlField = value;
+	}
+
+	/**
+	 * Generates the next frame.
+	 *
+	 * @param frame The destination of the frame, with space for FrameLength bytes
+	 * @return The virtual channel of the frame
+	 */
+	uint8_t generateFrame(uint8_t* frame) {
+		const size_t length = dataFieldLength();
+		uint8_t virtualChannel = VirtualChannels;
+		const int priority = highestPendingPriority();
+		if (priority >= 0) {
+			virtualChannel = selectChannel(priority, length);
+			if (virtualChannel == VirtualChannels) {
+				virtualChannel = selectChannel(priority, 1);
+			}
+		}
+
+		uint8_t* data = frame + PrimaryHeaderSize;
+		uint16_t firstHeaderPointer = OnlyIdleData;
+		if (virtualChannel == VirtualChannels) {
+			virtualChannel = IdleVirtualChannel;
+			std::memset(data, IdlePattern, length);
+		} else {
+			firstHeaderPointer = fillDataField(channels[virtualChannel], data, length);
+		}
+
+		Channel& channel = channels[virtualChannel];
+		writePrimaryHeader(frame, virtualChannel, channel.frameCount, firstHeaderPointer);
+		writeTrailer(frame);
+		channel.frameCount++;
+		masterFrameCount++;
+		return virtualChannel;
+	}
+
+	/**
+	 * @return The number of packets of a virtual channel that have not been fully placed in frames yet
+	 */
+	size_t pendingPackets(uint8_t virtualChannel) const {
+		return (virtualChannel < VirtualChannels) ? channels[virtualChannel].packetCount : 0;
+	}
+
+	/**
+	 * @return The number of packet bytes of a virtual channel that have not been placed in frames yet
+	 */
+	size_t pendingBytes(uint8_t virtualChannel) const {
+		return (virtualChannel < VirtualChannels) ? channels[virtualChannel].queuedBytes : 0;
+	}
+
+	static constexpr size_t frameLength() {
+		return FrameLength;
+	}
+};
+
+#endif // ECSS_SERVICES_TMTRANSFERFRAMEGENERATOR_HPP
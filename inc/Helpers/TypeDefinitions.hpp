@@ -37,6 +37,11 @@ using MessageTypeNum = uint8_t;
 
 using SourceId = uint16_t;
 using SequenceCount = uint16_t;
+/**
+ * The identifiers of the sub-schedules and of the groups of the ST[11] time-based schedule.
+ */
+using SubScheduleId = uint8_t;
+using SchedulingGroupId = uint8_t;
 /**
  * Filling percentages of the packet stores, either total or from the open retrieval start time tag.
  */
@@ -50,8 +55,17 @@ using ErrorCode = uint16_t;
  * The types used for the three Check Types and their variables in OnBoardMonitoringService.
  */
  using PMONRepetitionNumber = uint16_t;
+ /**
+  * The interval between two checks of a PMON definition, expressed as units of the on-board parameter minimum
+  * sampling interval (@ref ECSSMonitoringFrequency), as per 6.12.3.9.1.
+  */
+ using PMONMonitoringInterval = uint16_t;
  using PMONLimit = double;
  using PMONExpectedValue = uint64_t;
  using PMONBitMask = uint64_t;
  using NumberOfConsecutiveDeltaChecks = uint16_t;
- using DeltaThreshold = double;
\ No newline at end of file
+ using DeltaThreshold = double;
+/**
+ * The identifier of an ST[12] functional monitoring definition.
+ */
+ using FMONId = uint16_t;
\ No newline at end of file
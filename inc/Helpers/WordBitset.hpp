@@ -0,0 +1,110 @@
+#ifndef ECSS_SERVICES_WORDBITSET_HPP
+#define ECSS_SERVICES_WORDBITSET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "etl/array.h"
+
+/**
+ * Fixed-size set of bits that is updated and scanned a 32-bit word at a time, e.g. the enabled state of thousands of
+ * event definitions.
+ *
+ * Counting uses the population count of every word, and @ref forEachReset skips the words whose bits are all set,
+ * jumping from one cleared bit to the next with a count of trailing zeros. The bits after the last one in the final
+ * word are always zero, so they are never counted or reported.
+ *
+ * @tparam Bits The number of bits
+ */
+template <size_t Bits>
+class WordBitset {
+	static_assert(Bits > 0, "A bitset must have at least one bit");
+
+	using Word = uint32_t;
+	static constexpr size_t BitsPerWord = 32;
+	static constexpr size_t Words = (Bits + BitsPerWord - 1) / BitsPerWord;
+
+	/**
+	 * The bits of the final word that are part of the set
+	 */
+	static constexpr Word LastWordMask = (Bits % BitsPerWord == 0) ? ~Word{0} : (Word{1} << (Bits % BitsPerWord)) - 1;
+
+	etl::array<Word, Words> words{};
+
+	static constexpr Word mask(size_t bit) {
+		return Word{1} << (bit % BitsPerWord);
+	}
+
+public:
+	static constexpr size_t size() {
+		return Bits;
+	}
+
+	bool test(size_t bit) const {
+		return (words[bit / BitsPerWord] & mask(bit)) != 0;
+	}
+
+	bool operator[](size_t bit) const {
+		return test(bit);
+	}
+
+	/**
+	 * Changes the value of a bit.
+	 *
+	 * @return true if the value of the bit has changed
+	 */
+	bool set(size_t bit, bool value = true) {
+		Word& word = words[bit / BitsPerWord];
+		const Word previous = word;
+		word = value ? (word | mask(bit)) : (word & ~mask(bit));
+		return word != previous;
+	}
+
+	bool reset(size_t bit) {
+		return set(bit, false);
+	}
+
+	/**
+	 * Sets all the bits
+	 */
+	void set() {
+		words.fill(~Word{0});
+		words[Words - 1] = LastWordMask;
+	}
+
+	/**
+	 * Clears all the bits
+	 */
+	void reset() {
+		words.fill(0);
+	}
+
+	/**
+	 * @return The number of set bits
+	 */
+	size_t count() const {
+		size_t setBits = 0;
+		for (const Word word: words) {
+			setBits += __builtin_popcount(word);
+		}
+		return setBits;
+	}
+
+	/**
+	 * Calls function(bit) for every cleared bit, in increasing order.
+	 */
+	template <typename Function>
+	void forEachReset(Function&& function) const {
+		for (size_t index = 0; index < Words; index++) {
+			Word cleared = ~words[index];
+			if (index == Words - 1) {
+				cleared &= LastWordMask;
+			}
+			while (cleared != 0) {
+				function(index * BitsPerWord + __builtin_ctz(cleared));
+				cleared &= cleared - 1;
+			}
+		}
+	}
+};
+
+#endif // ECSS_SERVICES_WORDBITSET_HPP
@@ -2,8 +2,10 @@
 #define ECSS_SERVICES_PACKET_H
 
 #include <Time/TimeStamp.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <etl/String.hpp>
+#include <etl/span.h>
 #include <etl/wstring.h>
 #include "ECSS_Definitions.hpp"
 #include "Time/Time.hpp"
@@ -17,7 +19,22 @@
  */
 class Message {
 public:
-	Message() = default;
+	/**
+	 * Creates an empty message. Only the header is initialized, and none of the bytes of \ref Message::data are
+	 * written until something is appended.
+	 */
+	Message();
+
+	/**
+	 * Copies the header of a message and the used bytes of its data, instead of all the \ref ECSSMaxMessageSize bytes
+	 */
+	Message(const Message& message);
+
+	/**
+	 * Copies the header of a message and the used bytes of its data. Moving a message is a copy as well, since its
+	 * data is stored in place.
+	 */
+	Message& operator=(const Message& message);
 
 	/**
 	 * @brief Compare two messages
@@ -46,7 +63,7 @@ public:
 			return false;
 		}
 
-		return data == message.data;
+		return std::equal(data.begin(), data.begin() + dataSize, message.data.begin());
 	}
 
 	/**
@@ -68,7 +85,7 @@ public:
 			return false;
 		}
 
-		return data == message.data;
+		return std::equal(data.begin(), data.begin() + dataSize, message.data.begin());
 	}
 
 	enum PacketType {
@@ -92,6 +109,27 @@ public:
 
 	uint16_t sourceId = 0;
 
+	/**
+	 * The acknowledgement flags of a TC (5.4.11.2.2), i.e. which successful verification reports of ST[01] the source
+	 * of the request asked for. Failures are always reported.
+	 */
+	enum AcknowledgementFlag : uint8_t {
+		AcknowledgeCompletion = 0b0001,
+		AcknowledgeProgress = 0b0010,
+		AcknowledgeStart = 0b0100,
+		AcknowledgeAcceptance = 0b1000,
+		AcknowledgeAll = 0b1111,
+	};
+
+	uint8_t acknowledgementFlags = 0;
+
+	/**
+	 * @return true if the source of the request asked for the successful verification report of a stage
+	 */
+	bool isAcknowledgementRequested(AcknowledgementFlag flag) const {
+		return (acknowledgementFlags & flag) != 0;
+	}
+
 	//> 7.4.3.1b
 	uint16_t messageTypeCounter = 0;
 
@@ -107,10 +145,11 @@ public:
 	 * We allocate this data statically, in order to make sure there is predictability in the
 	 * handling and storage of messages
 	 *
-	 * @note This is initialized to 0 in order to prevent any mishaps with non-properly initialized values. \ref
-	 * Message::appendBits() relies on this in order to easily OR the requested bits.
+	 * @note Only the first \ref Message::dataSize bytes (and the byte that \ref Message::appendBits() is filling, if
+	 * any) hold valid values. The rest are left uninitialized, so that creating or copying a short message does not
+	 * touch the whole array.
 	 */
-	etl::array<uint8_t, ECSSMaxMessageSize> data = {};
+	etl::array<uint8_t, ECSSMaxMessageSize> data;
 
 	uint8_t currentBit = 0;
 
@@ -430,6 +469,29 @@ public:
 	 */
 	void appendMessage(const Message& message, uint16_t size);
 
+	/**
+	 * Adds a nested TC packet within the current Message, with its CCSDS primary header and its CRC
+	 *
+	 * Unlike \ref appendMessage, the packet only takes up as many bytes as it needs, since its length can be read from
+	 * its primary header.
+	 * @param message The message to append
+	 */
+	void appendPacket(const Message& message);
+
+	/**
+	 * Adds the bytes of a nested packet that has already been composed, e.g. one stored by a service
+	 * @param packet The bytes of the packet, including its headers
+	 */
+	void appendPacket(etl::span<const uint8_t> packet);
+
+	/**
+	 * Fetches a nested TC packet from the current position in the message, as added by \ref appendPacket
+	 *
+	 * @return The bytes of the packet, which can be parsed by \ref MessageParser::parseEmbeddedTC, or an empty span if
+	 * the rest of the message does not hold a whole packet
+	 */
+	etl::span<const uint8_t> readPacket();
+
 	/**
 	 * Fetches a single-byte boolean value from the current position in the message
 	 *
@@ -625,7 +687,7 @@ public:
 		if (not ASSERT_REQUEST(length <= string.max_size(), ErrorHandler::StringTooShort)) {
 			return {""};
 		}
-		if (not ASSERT_REQUEST((readPosition + length) <= ECSSMaxMessageSize, ErrorHandler::MessageTooShort)) {
+		if (not ASSERT_REQUEST((readPosition + length) <= dataSize, ErrorHandler::MessageTooShort)) {
 			return {""};
 		}
 
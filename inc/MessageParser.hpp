@@ -67,6 +67,27 @@ public:
 	 */
 	static Message parseECSSTC(const uint8_t* data);
 
+	/**
+	 * Reads the length of a packet from its CCSDS primary header, e.g. to find where a TC packet embedded in a
+	 * request ends
+	 *
+	 * @param data The start of the packet
+	 * @param availableLength The number of bytes available from the start of the packet
+	 * @return The length of the whole packet, including its headers and its CRC, or 0 if it is longer than
+	 * \p availableLength
+	 */
+	static uint16_t packetLength(const uint8_t* data, uint16_t availableLength);
+
+	/**
+	 * Parse a TC packet that is stored with its real length, including its CCSDS and ECSS headers, e.g. one that was
+	 * embedded in a TC[11,4] or a TC[19,1]
+	 *
+	 * @param data The start of the packet
+	 * @param length The length of the packet, as returned by \ref MessageParser::packetLength
+	 * @return Parsed message
+	 */
+	static Message parseEmbeddedTC(const uint8_t* data, uint16_t length);
+
 	/**
 	 * @brief Converts a TC or TM message to a message string, appending just the ECSS header
 	 * @todo (#249) Add time reference, as soon as it is available and the format has been specified
@@ -45,6 +45,17 @@ inline constexpr uint16_t ECSSSecondaryTCHeaderSize = 5U;
  */
 inline constexpr uint16_t CCSDSMaxMessageSize = ECSSMaxMessageSize + CCSDSPrimaryHeaderSize + ECSSSecondaryTMHeaderSize + 2U;
 
+/**
+ * The maximum length of a CCSDS TC Transfer Frame, including its header and its Frame Error Control Field
+ */
+inline constexpr uint16_t CCSDSMaxTCFrameLength = 1024U;
+
+/**
+ * The width W of the FARM-1 sliding window, i.e. the number of sequence numbers around the expected one that are not
+ * a reason to lock out the virtual channel. It must be an even number between 2 and 254.
+ */
+inline constexpr uint8_t CCSDSFARMSlidingWindowWidth = 10;
+
 /**
  * The maximum size of a string to be read or appended to a Message, in bytes
  *
@@ -100,7 +111,14 @@ inline constexpr uint8_t ECSSTCRequestStringSize = 64;
  * The maximum number of activities that can be in the time-based schedule
  * @see TimeBasedSchedulingService
  */
-inline constexpr uint8_t ECSSMaxNumberOfTimeSchedActivities = 10;
+inline constexpr uint16_t ECSSMaxNumberOfTimeSchedActivities = 10000;
+
+/**
+ * The number of bytes available for the telecommands held by the time-based schedule. Each telecommand takes as
+ * many bytes as its packet, and the arena allows for an average of 32 bytes per activity.
+ * @see TimeBasedSchedulingService
+ */
+inline constexpr uint32_t ECSSTimeSchedTCArenaSize = ECSSMaxNumberOfTimeSchedActivities * 32U;
 
 /**
  * @brief Time margin used in the time based command scheduling service ST[11]
@@ -110,6 +128,45 @@ inline constexpr uint8_t ECSSMaxNumberOfTimeSchedActivities = 10;
  */
 inline constexpr std::chrono::duration<uint8_t> ECSSTimeMarginForActivation(60);
 
+/**
+ * The maximum number of due activities that the time-based schedule releases in one call of
+ * TimeBasedSchedulingService::executeScheduledActivity, so that a burst of activities does not starve the rest of
+ * the main loop
+ * @see TimeBasedSchedulingService
+ */
+inline constexpr uint16_t ECSSMaxTimeSchedReleasesPerTick = 8;
+
+/**
+ * The delay after its release time beyond which an activity of the time-based schedule is counted as released late
+ * @see TimeBasedSchedulingService
+ */
+inline constexpr std::chrono::duration<uint8_t> ECSSTimeSchedLateReleaseMargin(1);
+
+/**
+ * The number of sub-schedules of the time-based schedule, whose identifiers are 0 to ECSSMaxTimeSchedSubSchedules - 1
+ * @see TimeBasedSchedulingService
+ */
+inline constexpr uint8_t ECSSMaxTimeSchedSubSchedules = 16;
+
+/**
+ * The maximum number of groups of the time-based schedule, whose identifiers are 0 to ECSSMaxTimeSchedGroups - 1
+ * @see TimeBasedSchedulingService
+ */
+inline constexpr uint8_t ECSSMaxTimeSchedGroups = 32;
+
+/**
+ * The number of event definitions of the event reporting service, whose identifiers are 1 to ECSSEventCatalogueSize - 1.
+ * Up to 65536 identifiers are supported.
+ * @see EventReportService
+ */
+inline constexpr uint32_t ECSSEventCatalogueSize = 4096;
+
+/**
+ * The maximum number of events with a rate limit
+ * @see EventReportService
+ */
+inline constexpr uint8_t ECSSMaxRateLimitedEvents = 32;
+
 /**
  * @brief Maximum size of an event's auxiliary data
  * @see EventReportService
@@ -122,6 +179,33 @@ inline constexpr uint8_t ECSSEventDataAuxiliaryMaxSize = 64;
  */
 inline constexpr uint16_t ECSSEventActionStructMapSize = 100;
 
+/**
+ * The number of bytes available for the telecommands of the event-action definitions. Each telecommand takes as many
+ * bytes as its packet.
+ * @see EventActionService
+ */
+inline constexpr uint16_t ECSSEventActionTCArenaSize = 2048;
+
+/**
+ * The maximum number of event occurrences waiting for their actions to be executed
+ * @see EventActionService
+ */
+inline constexpr uint8_t ECSSEventActionQueueSize = 32;
+
+/**
+ * The maximum number of queued event occurrences whose actions are executed in one call of
+ * EventActionService::executePendingActions, so that a cascade of events does not starve the rest of the main loop
+ * @see EventActionService
+ */
+inline constexpr uint8_t ECSSMaxEventActionDispatchesPerTick = 8;
+
+/**
+ * The maximum length of a chain of events raised by the actions of other events. An event raised deeper than that is
+ * not queued.
+ * @see EventActionService
+ */
+inline constexpr uint8_t ECSSMaxEventActionCascadeDepth = 4;
+
 /**
  * The maximum delta between the specified release time and the actual release time
  * @see TimeBasedSchedulingService
@@ -175,6 +259,55 @@ inline constexpr uint8_t ECSSMaxStatisticParameters = 4;
  */
 inline constexpr bool SupportsStandardDeviation = true;
 
+/**
+ * Whether the ST[04] statistics keep a quantile sketch of each parameter, and report the
+ * @ref ECSSStatisticsReportedQuantiles in TM[4,2]. This is not part of the standard TM[4,2] layout.
+ *
+ * @note Each sketch holds 2 * @ref ECSSStatisticsQuantileBuckets counters, so enabling it adds about 512 bytes to
+ * every statistic with the default number of buckets. It can be enabled for a build by defining
+ * ECSS_SUPPORTS_QUANTILES as true.
+ */
+#ifndef ECSS_SUPPORTS_QUANTILES
+#define ECSS_SUPPORTS_QUANTILES false
+#endif
+inline constexpr bool SupportsQuantiles = ECSS_SUPPORTS_QUANTILES;
+
+/**
+ * The number of buckets of the quantile sketch of each ST[04] statistic, for each sign of the sampled values. With
+ * the default accuracy, 64 buckets cover values within a ratio of about 600 without losing accuracy.
+ */
+inline constexpr uint8_t ECSSStatisticsQuantileBuckets = 64;
+
+/**
+ * The relative error of the quantiles estimated by the ST[04] quantile sketches
+ */
+inline constexpr double ECSSStatisticsQuantileRelativeAccuracy = 0.05;
+
+/**
+ * The quantiles appended to each parameter of TM[4,2], if @ref SupportsQuantiles is set
+ */
+inline constexpr double ECSSStatisticsReportedQuantiles[] = {0.5, 0.95, 0.99};
+
+/**
+ * Whether ST[04] statistics can be evaluated over a sliding window instead of since their last reset. If set, the
+ * evaluation start and stop times of TM[4,2] are replaced by the bounds of the evaluation window of each parameter,
+ * which is not the standard TM[4,2] layout.
+ *
+ * @note Each window holds @ref ECSSStatisticsMaxWindowSamples samples of 16 bytes, and two 4-byte indices per sample,
+ * so enabling it adds about 1.5 kB to every statistic with the default number of samples. It can be enabled for a
+ * build by defining ECSS_SUPPORTS_SLIDING_WINDOW_STATISTICS as true.
+ */
+#ifndef ECSS_SUPPORTS_SLIDING_WINDOW_STATISTICS
+#define ECSS_SUPPORTS_SLIDING_WINDOW_STATISTICS false
+#endif
+inline constexpr bool SupportsSlidingWindowStatistics = ECSS_SUPPORTS_SLIDING_WINDOW_STATISTICS;
+
+/**
+ * The maximum number of samples in the sliding window of an ST[04] statistic. A window can be at most this number of
+ * sampling intervals long, minus one.
+ */
+inline constexpr uint16_t ECSSStatisticsMaxWindowSamples = 64;
+
 /**
  * @brief the max number of bytes allowed for a packet store to handle in ST[15].
  */
@@ -190,6 +323,12 @@ inline constexpr uint16_t ECSSMaxPacketStoreSize = 10;
  */
 inline constexpr uint16_t ECSSMaxPacketStores = 4;
 
+/**
+ * @brief the number of message buffers that are shared by the services, e.g. to keep the TM packets of the ST[15]
+ * packet stores
+ */
+inline constexpr uint16_t ECSSMessagePoolSize = ECSSMaxPacketStores * ECSSMaxPacketStoreSize + 8;
+
 /**
  * @brief each packet store's id is an etl::string. So this defines the max size of a packet store ID in ST[15]
  */
@@ -248,9 +387,43 @@ inline constexpr struct {
  */
 inline constexpr uint8_t ECSSMaxMonitoringDefinitions = 4;
 
+/**
+ * Number of valid ST[12] PMON identifiers, i.e. PMON IDs range from 0 to ECSSPMONIdRange - 1. The definitions are
+ * looked up through a table with an entry for every identifier.
+ */
+inline constexpr uint16_t ECSSPMONIdRange = 256;
+
+/**
+ * Maximum number of ST[12] Functional Monitoring Definitions.
+ */
+inline constexpr uint8_t ECSSMaxFunctionalMonitoringDefinitions = 4;
+
+/**
+ * Number of valid ST[12] FMON identifiers, i.e. FMON IDs range from 0 to ECSSFMONIdRange - 1.
+ */
+inline constexpr uint16_t ECSSFMONIdRange = 64;
+
+/**
+ * Maximum number of parameter monitoring definitions that a functional monitoring definition can combine.
+ */
+inline constexpr uint8_t ECSSMaxPMONsPerFMON = 8;
+
+/**
+ * Maximum number of ST[12] check transitions that are buffered before a TM[12,12] check transition report is
+ * generated, regardless of the maximum transition reporting delay.
+ */
+inline constexpr uint8_t ECSSMaxCheckTransitions = 16;
+
+/**
+ * Default maximum number of ST[5] events raised by ST[12] check transitions in a single monitoring cycle.
+ */
+inline constexpr uint16_t ECSSMaxCheckTransitionEventsPerCycle = 16;
+
 /**
  * @brief Frequency at which the checkAll method is called
  * @details This variable specifies how often the checkAll method of ST[12] should be called.
+ * It is also the on-board parameter minimum sampling interval, in units of which the monitoring interval of each
+ * PMON definition is expressed.
  * The default value is set to 60 seconds but can be modified later.
  */
 inline constexpr std::chrono::seconds ECSSMonitoringFrequency(60);
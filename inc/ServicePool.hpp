@@ -2,6 +2,7 @@
 #define ECSS_SERVICES_SERVICEPOOL_HPP
 
 #include "ECSS_Configuration.hpp"
+#include "Helpers/MessagePool.hpp"
 #include "Services/DummyService.hpp"
 #include "Services/EventActionService.hpp"
 #include "Services/EventReportService.hpp"
@@ -48,6 +49,13 @@ class ServicePool {
 	inline static const uint8_t MaxPacketSequenceCounterBit = 14U;
 
 public:
+	/**
+	 * The buffers of the messages that are kept by the services
+	 *
+	 * @note This is declared before the services, so that it is destroyed after them and their handles.
+	 */
+	ServiceMessagePool messagePool;
+
 #ifdef SERVICE_DUMMY
 	DummyService dummyService;
 #endif
@@ -1,10 +1,13 @@
 #ifndef ECSS_SERVICES_EVENTACTIONSERVICE_HPP
 #define ECSS_SERVICES_EVENTACTIONSERVICE_HPP
 
+#include "Helpers/TCArena.hpp"
 #include "Service.hpp"
 #include "Services/EventReportService.hpp"
-#include "etl/String.hpp"
+#include "etl/array.h"
+#include "etl/deque.h"
 #include "etl/multimap.h"
+#include "etl/vector.h"
 
 /**
  * Implementation of ST[19] event-action Service
@@ -39,20 +42,146 @@ public:
 		DisableEventActionFunction = 9
 	};
 
+	/**
+	 * The request of an event-action definition, parsed and validated when the definition is added. Only its
+	 * application data is stored in the service, so dispatching it does not parse the packet again.
+	 *
+	 * @note The services execute a whole @ref Message, so a request is still rebuilt into one on the stack when it is
+	 * dispatched. Only its header fields and its application data are copied, not the rest of the message buffer.
+	 */
+	struct ParsedRequest {
+		ServiceTypeNum serviceType = 0;
+		MessageTypeNum messageType = 0;
+		ApplicationProcessId applicationID = 0;
+		SequenceCount sequenceCount = 0;
+		SourceId sourceID = 0;
+		uint8_t acknowledgementFlags = 0;
+		uint16_t dataSize = 0;
+		/**
+		 * Handle of the application data of the request, which is stored in the service
+		 */
+		SlotHandle data;
+	};
+
 	struct EventActionDefinition {
 		ApplicationProcessId applicationID = 0;
 		inline static constexpr ApplicationProcessId MaxDefinitionID = 65535;
 		EventDefinitionId eventDefinitionID = MaxDefinitionID;
-		String<ECSSTCRequestStringSize> request = "";
+		ParsedRequest request;
 		bool enabled = false;
 
-		EventActionDefinition(ApplicationProcessId applicationID, EventDefinitionId eventDefinitionID, Message& message);
+		EventActionDefinition(ApplicationProcessId applicationID, EventDefinitionId eventDefinitionID, const ParsedRequest& request);
 	};
 
 	friend EventReportService;
 
-	etl::multimap<uint16_t, EventActionDefinition, ECSSEventActionStructMapSize>
-	    eventActionDefinitionMap;
+	using EventActionDefinitionMap = etl::multimap<uint16_t, EventActionDefinition, ECSSEventActionStructMapSize>;
+
+	EventActionDefinitionMap eventActionDefinitionMap;
+
+private:
+	/**
+	 * An enabled action, ready to be dispatched when its event occurs
+	 */
+	struct EnabledAction {
+		EventDefinitionId eventDefinitionID;
+		ParsedRequest request;
+	};
+
+	/**
+	 * The application data of the requests of the event-action definitions, each taking as many bytes as the data
+	 */
+	TCArena<ECSSEventActionTCArenaSize, ECSSEventActionStructMapSize> requests;
+
+	/**
+	 * @brief Index of the enabled actions by event
+	 *
+	 * @details The actions are kept contiguous and sorted by event definition ID, so that the actions of an event are
+	 * found by a binary search and dispatched one after the other. It is rebuilt from @ref eventActionDefinitionMap
+	 * whenever the definitions change, which is much less frequent than events.
+	 */
+	etl::vector<EnabledAction, ECSSEventActionStructMapSize> enabledActions;
+
+	/**
+	 * Incremented every time that @ref enabledActions is rebuilt
+	 */
+	uint32_t enabledActionsVersion = 0;
+
+	/**
+	 * An event occurrence whose actions have not been executed yet
+	 */
+	struct PendingEvent {
+		EventDefinitionId eventDefinitionID = 0;
+
+		/**
+		 * The number of events in the chain that raised this one, i.e. 0 for an event that was not raised by an action
+		 */
+		uint8_t depth = 0;
+
+		/**
+		 * The events whose actions raised this one, from the first one of the chain
+		 */
+		etl::array<EventDefinitionId, ECSSMaxEventActionCascadeDepth> chain = {};
+	};
+
+	etl::deque<PendingEvent, ECSSEventActionQueueSize> pendingEvents;
+
+	/**
+	 * The event whose actions are being executed, if any, so that the events raised by them are queued as part of
+	 * its chain
+	 */
+	const PendingEvent* dispatchedEvent = nullptr;
+
+	/**
+	 * @return The position of the first enabled action of an event in @ref enabledActions
+	 */
+	size_t findEnabledActions(EventDefinitionId eventDefinitionID) const;
+
+	/**
+	 * Executes the enabled actions of an event.
+	 */
+	void dispatchActions(const PendingEvent& event);
+
+	/**
+	 * Removes an event-action definition from the map and releases its request
+	 */
+	void eraseDefinition(EventActionDefinitionMap::iterator definition);
+
+	/**
+	 * Parses and validates the request packet of an event-action definition, and stores its application data. The
+	 * packet is rejected if it is not a TC of the supported PUS version, if its length does not match its packet data
+	 * length, or if its CRC is wrong.
+	 *
+	 * @return false if an error has been reported for the request
+	 */
+	bool parseRequest(const Message& message, etl::span<const uint8_t> packet, ParsedRequest& request);
+
+	/**
+	 * Builds the message of a parsed request, copying only its application data into the message buffer
+	 */
+	Message buildRequest(const ParsedRequest& request) const;
+
+	/**
+	 * Rebuilds @ref enabledActions after the definitions or their status have changed
+	 */
+	void updateEnabledActions();
+
+public:
+	/**
+	 * @return The request of an event-action definition, as it is dispatched when its event occurs
+	 */
+	Message getRequest(const EventActionDefinition& definition) const {
+		return buildRequest(definition.request);
+	}
+
+	/**
+	 * Removes all the event-action definitions and their requests
+	 */
+	void clearDefinitions() {
+		eventActionDefinitionMap.clear();
+		requests.clear();
+		updateEnabledActions();
+	}
 
 	EventActionService() : eventActionFunctionStatus(true) {
 		serviceType = ServiceType;
@@ -118,12 +247,49 @@ public:
 		return eventActionFunctionStatus;
 	}
 
+	/**
+	 * The number of event occurrences whose actions were dropped because the queue was full
+	 */
+	uint32_t queueOverflowCount = 0;
+
+	/**
+	 * The number of event occurrences whose actions were dropped because they were raised, directly or not, by an
+	 * action of the same event
+	 */
+	uint32_t cycleCount = 0;
+
+	/**
+	 * The number of event occurrences whose actions were dropped because they were raised by a chain of more than
+	 * @ref ECSSMaxEventActionCascadeDepth events
+	 */
+	uint32_t cascadeDepthExceededCount = 0;
+
 	/**
 	 * Custom function that is called right after an event takes place, to initiate
-	 * the execution of the action
+	 * the execution of the action. The event is only queued if it has enabled actions, so this takes bounded time in
+	 * the context that raised the event. The actions are executed later, by @ref executePendingActions.
 	 */
 	void executeAction(EventDefinitionId eventDefinitionID);
 
+	/**
+	 * Executes the actions of the queued events, in the order that the events occurred. At most
+	 * @ref ECSSMaxEventActionDispatchesPerTick events are handled in one call, and the rest are left for the next
+	 * call. The events raised by the actions are queued behind the current ones. If an action changes the
+	 * event-action definitions, the remaining actions of its event are not dispatched, since they may have been
+	 * deleted or disabled.
+	 *
+	 * @note This should be called periodically from the main loop.
+	 * @return The number of events still waiting in the queue
+	 */
+	size_t executePendingActions();
+
+	/**
+	 * @return The number of events waiting in the queue
+	 */
+	size_t pendingEventCount() const {
+		return pendingEvents.size();
+	}
+
 	/**
 	 * It is responsible to call the suitable function that executes a telecommand packet. The source of that packet
 	 * is the ground station.
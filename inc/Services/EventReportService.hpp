@@ -1,8 +1,10 @@
 #ifndef ECSS_SERVICES_EVENTREPORTSERVICE_HPP
 #define ECSS_SERVICES_EVENTREPORTSERVICE_HPP
 
-#include <etl/bitset.h>
+#include "Helpers/WordBitset.hpp"
 #include "Service.hpp"
+#include "Time/TimeStamp.hpp"
+#include "etl/map.h"
 
 /**
  * Implementation of ST[05] event reporting service
@@ -16,10 +18,102 @@
 
 class EventReportService : public Service
 {
+public:
+    /**
+     * The number of event definition IDs in the catalogue, including the unused ID 0
+     */
+    static constexpr uint32_t NumberOfEvents = ECSSEventCatalogueSize;
+    static_assert(NumberOfEvents <= 65536U, "The event definition IDs must fit in an EventDefinitionId");
+
+    using EventBitset = WordBitset<NumberOfEvents>;
+
+    /**
+     * How the reports of an event are limited during an event storm
+     */
+    enum class RateLimitType : uint8_t
+    {
+        /**
+         * Every occurrence is reported. Setting this type removes the limit of an event.
+         */
+        None = 0,
+        /**
+         * Up to burst occurrences are reported at once, and one more every interval after that
+         */
+        TokenBucket = 1,
+        /**
+         * An occurrence is reported only if at least interval has passed since the last reported one
+         */
+        MinimumInterval = 2,
+    };
+
+    /**
+     * The time unit of @ref Time::DefaultCUC, which has no fractional part
+     */
+    using RateLimitTick = std::chrono::duration<std::chrono::milliseconds::rep, Time::DefaultCUC::Ratio>;
+
+    /**
+     * The resolution of the intervals of the rate limits, since the times of the reports are kept as
+     * @ref Time::DefaultCUC
+     */
+    static constexpr std::chrono::milliseconds RateLimitIntervalResolution =
+        std::chrono::duration_cast<std::chrono::milliseconds>(RateLimitTick(1));
+
+    /**
+     * The rate limit of an event and its suppression statistics
+     */
+    struct EventRateLimit {
+        RateLimitType type = RateLimitType::None;
+        uint16_t burst = 1;
+        std::chrono::milliseconds interval{0};
+
+        /**
+         * The reports that can still be generated, for @ref RateLimitType::TokenBucket
+         */
+        uint16_t tokens = 0;
+
+        /**
+         * The time of the last refill of the bucket, or of the last reported occurrence for
+         * @ref RateLimitType::MinimumInterval
+         */
+        Time::DefaultCUC lastTime;
+        bool hasReported = false;
+
+        /**
+         * The occurrences suppressed since the last report of the event
+         */
+        uint32_t pendingSuppressions = 0;
+
+        /**
+         * The occurrences suppressed since the limit was set
+         */
+        uint32_t totalSuppressions = 0;
+    };
+
 private:
-    static constexpr uint16_t NumberOfEvents = 5;
-    etl::bitset<NumberOfEvents> enabledEvents;
+    etl::map<EventDefinitionId, EventRateLimit, ECSSMaxRateLimitedEvents> rateLimits;
+
+    /**
+     * Decides if an occurrence of an enabled event is reported, according to its rate limit. When a report is allowed
+     * after some occurrences were suppressed, a TM[5,131] summary with their number is generated first.
+     *
+     * @return false if the occurrence is suppressed, in which case its report is not generated. The ST[19] actions of
+     * the event are still executed, since they may be needed to recover from the cause of the storm.
+     */
+    bool admitOccurrence(EventDefinitionId eventID);
+    EventBitset enabledEvents;
     static constexpr uint16_t LastElementID = std::numeric_limits<uint16_t>::max();
+
+    /**
+     * The number of event definition IDs that fit in a single TM[5,8] report
+     */
+    static constexpr uint16_t MaxDisabledEventsPerReport = (ECSSMaxMessageSize - sizeof(uint16_t)) / sizeof(EventDefinitionId);
+
+    /**
+     * Enables or disables the report generation of the event definitions listed in a TC[5,5] or TC[5,6]. The IDs are
+     * validated together first, so that a TC with no unknown ID is applied without checking each one.
+     */
+    void setReportGeneration(Message& message, bool enabled);
+
 public:
     inline static constexpr ServiceTypeNum ServiceType = 5;
 
@@ -33,6 +127,10 @@ public:
         DisableReportGenerationOfEvents = 6,
         ReportListOfDisabledEvents = 7,
         DisabledListEventReport = 8,
+        SetEventRateLimits = 128,
+        ReportEventSuppressionStatistics = 129,
+        EventSuppressionStatisticsReport = 130,
+        SuppressedEventsSummaryReport = 131,
     };
 
 
@@ -52,7 +150,12 @@ public:
     uint16_t highSeverityEventCount = 0;
 
 
-    uint16_t disabledEventsCount = 0;
+    uint32_t disabledEventsCount = 0;
+
+    /**
+     * The occurrences of all events that were suppressed by their rate limits
+     */
+    uint32_t suppressedEventsCount = 0;
 
 
     uint16_t lastLowSeverityReportID = LastElementID;
@@ -72,9 +175,9 @@ public:
      * Type of the information event
      *
      * Note: Numbers are kept in code explicitly, so that there is no uncertainty when something
-     * changes.
+     * changes. Any other ID of the catalogue can be used by casting it to an Event.
      */
-    enum Event
+    enum Event : EventDefinitionId
     {
         /**
          * An unknown event occured
@@ -173,15 +276,51 @@ public:
 
     /**
      * TM[5,8] disabled event definitions report
-     * Telemetry package of a report of the disabled event definitions
+     * Telemetry package of a report of the disabled event definitions. If they do not fit in a single
+     * report, they are split in as many reports as needed, each with its own count.
      */
     void listOfDisabledEventsReport();
 
+    /**
+     * TC[5,128] set the rate limits of events
+     * Mission-specific telecommand that sets or removes the rate limit of each listed event. The intervals are given
+     * in ms, and must be multiples of @ref RateLimitIntervalResolution.
+     */
+    void setEventRateLimits(Message& message);
+
+    /**
+     * TC[5,129] request a report of the event suppression statistics
+     */
+    void requestEventSuppressionStatistics(const Message& message);
+
+    /**
+     * TM[5,130] event suppression statistics report
+     * Mission-specific report of the pending and total suppressed occurrences of every rate-limited event
+     */
+    void eventSuppressionStatisticsReport();
+
+    /**
+     * Sets the rate limit of an event, resetting its bucket and its statistics.
+     *
+     * @param burst The reports that can be generated at once, for @ref RateLimitType::TokenBucket
+     * @param interval Rounded up to a multiple of @ref RateLimitIntervalResolution
+     * @return false if there is no space for another rate-limited event
+     */
+    bool setRateLimit(EventDefinitionId eventID, RateLimitType type, uint16_t burst, std::chrono::milliseconds interval);
+
+    /**
+     * @return The rate limit of an event, or nullptr if it has none
+     */
+    const EventRateLimit* getRateLimit(EventDefinitionId eventID) const {
+        auto rateLimit = rateLimits.find(eventID);
+        return (rateLimit == rateLimits.end()) ? nullptr : &rateLimit->second;
+    }
+
     /**
      * Getter for enabledEvents bitset
      * @return enabledEvents, just in case the whole bitset is needed
      */
-    etl::bitset<NumberOfEvents> getStateOfEvents()
+    const EventBitset& getStateOfEvents() const
     {
         return enabledEvents;
     }
@@ -191,11 +330,12 @@ public:
     */
     inline void disableAllEvents() {
         enabledEvents.reset();
+        disabledEventsCount = NumberOfEvents;
     }
 
     /**
      * Validates the parameters for an event.
-     * Ensures the event ID is within the allowable range and not 0.
+     * Ensures the event ID is within the catalogue and not 0.
      *
      * @param eventID The ID of the event to validate.
      * @return True if parameters are valid, false otherwise.
@@ -2,14 +2,16 @@
 #define ECSS_SERVICES_ONBOARDMONITORINGSERVICE_HPP
 #include <cstdint>
 #include "ECSS_Definitions.hpp"
+#include "Helpers/DueSchedule.hpp"
+#include "Helpers/FMON.hpp"
 #include "Helpers/PMON.hpp"
 #include "Helpers/Parameter.hpp"
+#include "Helpers/SlotPool.hpp"
 #include "Message.hpp"
 #include "Service.hpp"
+#include "etl/algorithm.h"
 #include "etl/array.h"
 #include "etl/functional.h"
-#include "etl/list.h"
-#include "etl/map.h"
 #include "etl/vector.h"
 
 /**
@@ -20,45 +22,186 @@
 class OnBoardMonitoringService : public Service {
 private:
 	/**
-	 * Map storing the parameter monitoring definitions.
+	 * Storage size of a parameter monitoring definition of any check type.
 	 */
-	etl::map<uint16_t, etl::reference_wrapper<PMON>, ECSSMaxMonitoringDefinitions> parameterMonitoringList;
+	static constexpr size_t PMONDefinitionSize = etl::max(sizeof(PMONLimitCheck), etl::max(sizeof(PMONExpectedValueCheck), sizeof(PMONDeltaCheck)));
 
 	/**
-	 * Maximum number of checks for each Limit Check.
+	 * The parameter monitoring definitions of all check types. Deleted definitions return their slot to the pool, so
+	 * that the definitions can be added, deleted and re-typed indefinitely within a fixed amount of memory.
 	 */
-	static constexpr uint8_t MaximumNumberOfChecksLimitCheck = 32;
+	SlotPool<PMON, PMONDefinitionSize, ECSSMaxMonitoringDefinitions> parameterMonitoringDefinitions;
 
 	/**
-	 * Maximum number of checks for each Expected Value Check.
+	 * The handle of the definition with each PMON ID, indexed by the PMON ID. IDs without a definition have an invalid
+	 * handle.
 	 */
-	static constexpr uint8_t MaximumNumberOfChecksExpectedValueCheck = 32;
+	etl::array<SlotHandle, ECSSPMONIdRange> parameterMonitoringHandles;
 
 	/**
-	 * Maximum number of checks for each Delta check.
+	 * Bookkeeping of a definition, indexed by the slot of the definition in @ref parameterMonitoringDefinitions.
 	 */
-	static constexpr uint8_t MaximumNumberOfChecksDeltaCheck = 32;
+	struct DefinitionSlotState {
+		ParameterId PMONId = 0;
+		/**
+		 * The time of the current entry of the definition in @ref monitoringSchedule.
+		 */
+		Time::DefaultCUC nextCheckTime;
+	};
+
+	etl::array<DefinitionSlotState, ECSSMaxMonitoringDefinitions> definitionSlotStates;
+
+	/**
+	 * The functional monitoring definitions, indexed by the PMONs they depend on.
+	 */
+	FMONList<ECSSMaxFunctionalMonitoringDefinitions, ECSSFMONIdRange, ECSSPMONIdRange> functionalMonitoringList;
+
+	/**
+	 * Propagates a change of the confirmed Checking Status of a PMON to the FMONs that depend on it, raising the
+	 * event of every enabled FMON that fails as a result.
+	 */
+	void updateFunctionalMonitoring(ParameterId PMONId, bool wasFailing, bool isFailing);
+
+	/**
+	 * Brings a PMON definition back to its unchecked state, updating the FMONs that depend on it.
+	 */
+	void resetPMONCheckingStatus(ParameterId PMONId, PMON& pmon);
+
+	/**
+	 * Applies a function to every FMON ID of a request of the form N, FMON ID 1, ..., FMON ID N, reporting an error
+	 * for the IDs without a definition.
+	 */
+	template <typename Function>
+	void forEachRequestedFMON(Message& message, Function&& function);
+
+	/**
+	 * A confirmed change of the Checking Status of a PMON definition, waiting to be included in a TM[12,12] check
+	 * transition report.
+	 */
+	struct CheckTransition {
+		ParameterId PMONId;
+		ParameterId monitoredParameterId;
+		PMON::CheckType checkType;
+		/**
+		 * The value of the monitored parameter when the transition was confirmed.
+		 */
+		double parameterValue;
+		/**
+		 * The expected value of an Expected Value Check, or the limit or threshold that was crossed for the other
+		 * check types.
+		 */
+		double limitCrossed;
+		PMON::CheckingStatus previousCheckingStatus;
+		PMON::CheckingStatus currentCheckingStatus;
+		Time::DefaultCUC transitionTime;
+	};
+
+	/**
+	 * The confirmed transitions that have not been reported yet. A definition occupies at most one entry; further
+	 * transitions of the same definition before the next report only update its current Checking Status, so that the
+	 * size of the reports stays bounded by the number of definitions, even if they keep flapping. An entry whose
+	 * definition returns to its previous Checking Status is removed, since there is no net transition to report.
+	 */
+	etl::vector<CheckTransition, ECSSMaxCheckTransitions> checkTransitions;
+
+	/**
+	 * The number of monitoring cycles that have passed since the oldest transition in @ref checkTransitions was
+	 * recorded.
+	 */
+	uint16_t cyclesSinceFirstPendingTransition = 0;
+
+	/**
+	 * The number of check transition events raised in the current monitoring cycle
+	 */
+	uint16_t transitionEventsInCycle = 0;
+
+	/**
+	 * The number of check transition events that were not raised because of
+	 * @ref maximumTransitionEventsPerCycle
+	 */
+	uint32_t suppressedTransitionEvents = 0;
+
+	/**
+	 * The times at which the PMON definitions are due to be checked next.
+	 *
+	 * Deleting, re-typing or rescheduling a definition only makes its current entry outdated (see
+	 * @ref isScheduledCheckCurrent).
+	 */
+	using MonitoringSchedule = DueSchedule<SlotHandle, 2 * ECSSMaxMonitoringDefinitions>;
+	using ScheduledCheck = MonitoringSchedule::Entry;
+
+	MonitoringSchedule monitoringSchedule;
+
+	/**
+	 * @return true if the entry is the current scheduled check of an existing definition
+	 */
+	bool isScheduledCheckCurrent(const ScheduledCheck& scheduledCheck);
+
+	/**
+	 * Sets the time of the next check of a definition, replacing any previously scheduled check.
+	 */
+	void scheduleCheck(SlotHandle definition, Time::DefaultCUC checkTime);
+
+	/**
+	 * @return The definition with the given PMON ID, or nullptr if there is none
+	 */
+	PMON* findPMONDefinition(ParameterId PMONId);
 
 	/**
-	 * This vector is used as a mean of storing the PMON Definitons
-	 * resulting from the addParameterMonitoringDefinitions method according to their Check Type
-	 * before they are added to the parameterMonitoringList.
+	 * Stores a copy of a definition under a new PMON ID and schedules its first check as soon as possible.
+	 *
+	 * @return false if the ID is out of range or already used, or if there is no room for the definition
 	 */
-	etl::vector<PMONLimitCheck, MaximumNumberOfChecksLimitCheck> limitChecks;
+	template <typename Check>
+	bool insertPMONDefinition(ParameterId PMONId, const Check& check);
 
 	/**
-	 * This vector is used as a mean of storing the PMON Definitons
-	 * resulting from the addParameterMonitoringDefinitions method according to their Check Type
-	 * before they are added to the parameterMonitoringList.
+	 * Replaces the definition stored under an existing PMON ID. A definition of the same check type is overwritten in
+	 * place; otherwise the old definition is released and the new one takes its place.
 	 */
-	etl::vector<PMONExpectedValueCheck, MaximumNumberOfChecksExpectedValueCheck> expectedValueChecks;
+	template <typename Check>
+	void replacePMONDefinition(ParameterId PMONId, const Check& check);
 
 	/**
-	 * This vector is used as a mean of storing the PMON Definitons
-	 * resulting from the addParameterMonitoringDefinitions method according to their Check Type
-	 * before they are added to the parameterMonitoringList.
+	 * Deletes the definition with the given PMON ID, if it exists.
 	 */
-	etl::vector<PMONDeltaCheck, MaximumNumberOfChecksDeltaCheck> deltaChecks;
+	void removePMONDefinition(ParameterId PMONId);
+
+	/**
+	 * Closes a monitoring cycle, generating the check transition report if @ref maximumTransitionReportingDelay
+	 * cycles have passed since the oldest pending transition.
+	 */
+	void finishMonitoringCycle();
+
+	/**
+	 * Records a confirmed transition of a PMON definition and raises the event linked to its new Checking Status.
+	 */
+	void processCheckTransition(ParameterId PMONId, PMON& pmon, Time::DefaultCUC checkTime);
+
+	/**
+	 * Adds a transition to the list of pending transitions, coalescing it with an already pending transition of the
+	 * same definition. If the list is full, a check transition report is generated first to make room.
+	 */
+	void recordCheckTransition(const CheckTransition& transition);
+
+	/**
+	 * Generates the ST[05] event linked to the current confirmed Checking Status of a definition, if there is one.
+	 * An event definition ID of 0 means that no event is linked to that status. At most
+	 * @ref maximumTransitionEventsPerCycle events are raised in a monitoring cycle.
+	 */
+	void raiseCheckTransitionEvent(const PMON& pmon);
+
+	/**
+	 * Generates an ST[05] event on behalf of a monitoring definition. An event definition ID of 0 means that no event
+	 * is linked, so nothing is generated.
+	 */
+	static void raiseMonitoringEvent(EventDefinitionId eventId);
+
+	/**
+	 * @return The expected value of an Expected Value Check, or the limit or threshold crossed by the last confirmed
+	 * transition of a Limit or Delta Check.
+	 */
+	static double getLimitCrossed(const PMON& pmon);
 
 public:
 	inline static constexpr ServiceTypeNum ServiceType = 12;
@@ -76,7 +219,19 @@ public:
 		OutOfLimitsReport = 11,
 		CheckTransitionReport = 12,
 		ReportStatusOfParameterMonitoringDefinition = 13,
-		ParameterMonitoringDefinitionStatusReport = 14
+		ParameterMonitoringDefinitionStatusReport = 14,
+		EnableFunctionalMonitoringFunction = 17,
+		DisableFunctionalMonitoringFunction = 18,
+		EnableFunctionalMonitoringDefinitions = 19,
+		DisableFunctionalMonitoringDefinitions = 20,
+		ProtectFunctionalMonitoringDefinitions = 21,
+		UnprotectFunctionalMonitoringDefinitions = 22,
+		AddFunctionalMonitoringDefinitions = 23,
+		DeleteFunctionalMonitoringDefinitions = 24,
+		ReportFunctionalMonitoringDefinitions = 25,
+		FunctionalMonitoringDefinitionReport = 26,
+		ReportStatusOfFunctionalMonitoringDefinitions = 27,
+		FunctionalMonitoringDefinitionStatusReport = 28
 	};
 
 	OnBoardMonitoringService() {
@@ -85,75 +240,133 @@ public:
 
 	/**
 	 * The maximum time between two transition reports.
-	 * Measured in "on-board parameter minimum sampling interval" units (see 5.4.3.2c in ECSS-E-ST-70-41C).
+	 * Measured in "on-board parameter minimum sampling interval" units (see 5.4.3.2c in ECSS-E-ST-70-41C), i.e. in
+	 * calls of @ref checkAll.
 	 */
 	uint16_t maximumTransitionReportingDelay = 0;
 
+	/**
+	 * The maximum number of events raised by check transitions in a monitoring cycle, so that flapping parameters
+	 * cannot flood ST[5] and the ST[19] actions that it triggers. The transitions are still reported in TM[12,12].
+	 */
+	uint16_t maximumTransitionEventsPerCycle = ECSSMaxCheckTransitionEventsPerCycle;
+
 	/**
 	 * If true, parameter monitoring is enabled
 	 */
 	bool parameterMonitoringFunctionStatus = false;
 
+	/**
+	 * If true, failing functional monitoring definitions raise their events
+	 */
+	bool functionalMonitoringFunctionStatus = false;
+
 	/**
 	 * Adds a new Parameter Monitoring Limit Check to the parameter monitoring list.
 	 */
-	void addPMONLimitCheck(ParameterId PMONId, PMONLimitCheck& limitCheck) {
-		limitChecks.push_back(limitCheck);
-		parameterMonitoringList.insert(etl::pair<const ParameterId, etl::reference_wrapper<PMON>>(PMONId, etl::ref(limitChecks.back())));
-	}
+	void addPMONLimitCheck(ParameterId PMONId, const PMONLimitCheck& limitCheck);
 
 
 	/**
 	 * Adds a new Parameter Monitoring Expected Value Check to the parameter monitoring list.
 	 */
-	void addPMONExpectedValueCheck(ParameterId PMONId, PMONExpectedValueCheck& expectedValueCheck) {
-		expectedValueChecks.push_back(expectedValueCheck);
-		parameterMonitoringList.insert(etl::pair<const ParameterId, etl::reference_wrapper<PMON>>(PMONId, etl::ref(expectedValueChecks.back())));
-	}
+	void addPMONExpectedValueCheck(ParameterId PMONId, const PMONExpectedValueCheck& expectedValueCheck);
 
 	/**
 	 * Adds a new Parameter Monitoring Delta Check to the parameter monitoring list.
 	 */
-	void addPMONDeltaCheck(ParameterId PMONId, PMONDeltaCheck& deltaCheck) {
-		deltaChecks.push_back(deltaCheck);
-		parameterMonitoringList.insert(etl::pair<const ParameterId, etl::reference_wrapper<PMON>>(PMONId, etl::ref(deltaChecks.back())));
-	}
+	void addPMONDeltaCheck(ParameterId PMONId, const PMONDeltaCheck& deltaCheck);
 
 	/**
-	 * This function clears the Parameter Monitoring List map.
+	 * This function deletes all the parameter monitoring definitions, together with the unprotected functional
+	 * monitoring definitions that combine them. The protected functional monitoring definitions cannot be deleted, so
+	 * they are kept, together with the parameter monitoring definitions that they combine.
 	 */
-	void clearParameterMonitoringList() {
-		parameterMonitoringList.clear();
-	}
+	void clearParameterMonitoringList();
 
 	/**
-	 * @param PMONId
+	 * @param PMONId The ID of an existing definition
 	 * @return Parameter Monitoring definition
 	 */
 	etl::reference_wrapper<PMON> getPMONDefinition(ParameterId PMONId) {
-		return parameterMonitoringList.at(PMONId);
+		return *findPMONDefinition(PMONId);
 	}
 
 	/**
 	 * @return true if PMONList is empty.
 	 */
-	bool isPMONListEmpty() {
-		return parameterMonitoringList.empty();
+	bool isPMONListEmpty() const {
+		return parameterMonitoringDefinitions.empty();
+	}
+
+	/**
+	 * @return The number of stored parameter monitoring definitions.
+	 */
+	uint16_t getPMONDefinitionCount() const {
+		return parameterMonitoringDefinitions.size();
 	}
 
 	/**
 	 * @return The number of occurrences of the specified key in the parameter monitoring list.
 	 */
-	uint16_t getCount(uint16_t key) const {
-		return parameterMonitoringList.count(key);
+	uint16_t getCount(uint16_t key) {
+		return (findPMONDefinition(key) != nullptr) ? 1 : 0;
+	}
+
+	/**
+	 * @return The functional monitoring definition with the given ID, or nullptr if there is none
+	 */
+	FMON* findFMONDefinition(FMONId id) {
+		return functionalMonitoringList.find(id);
+	}
+
+	/**
+	 * @return The number of stored functional monitoring definitions.
+	 */
+	uint16_t getFMONDefinitionCount() const {
+		return functionalMonitoringList.size();
+	}
+
+	/**
+	 * @return The number of confirmed check transitions that have not been reported yet.
+	 */
+	uint16_t getPendingCheckTransitionCount() const {
+		return checkTransitions.size();
+	}
+
+	/**
+	 * @return The number of check transition events that were not raised because of
+	 * @ref maximumTransitionEventsPerCycle
+	 */
+	uint32_t getSuppressedTransitionEventCount() const {
+		return suppressedTransitionEvents;
 	}
 
 	/**
 	 * Checks all PMON objects in the parameter monitoring list if they are enabled.
 	 * This function iterates through all PMON objects in the parameter monitoring list
 	 * and calls the performCheck method for each enabled PMON.
+	 *
+	 * Every Checking Status that is confirmed by @ref PMON::repetitionNumber consecutive checks and differs from the
+	 * previously confirmed one is recorded as a check transition, and its linked event is raised. The pending
+	 * transitions are sent in a single TM[12,12] once @ref maximumTransitionReportingDelay cycles have passed since
+	 * the first of them, or earlier if the transition buffer fills up.
+	 */
+	void checkAll();
+
+	/**
+	 * Checks the enabled PMON definitions whose monitoring interval has elapsed, and reschedules every due definition
+	 * one monitoring period after cycleTime. Definitions that are not due are not touched, so the cost of a cycle
+	 * depends on the monitoring rates rather than on the number of definitions.
+	 *
+	 * Transitions are processed and reported in the same way as in @ref checkAll, and each call counts as one cycle
+	 * of @ref maximumTransitionReportingDelay.
+	 *
+	 * @param cycleTime The time of this monitoring cycle, shared by all the checks performed in it
+	 * @return The time at which the next definition is due, or one @ref ECSSMonitoringFrequency after cycleTime if
+	 * there are no definitions
 	 */
-	void checkAll() const;
+	Time::DefaultCUC checkDueDefinitions(const Time::DefaultCUC& cycleTime);
 
 	/**
 	 * Enables the PMON definitions which correspond to the ids in TC[12,1].
@@ -214,6 +427,7 @@ public:
 
 	/**
 	 * TM[12,12]
+	 * Reports and clears all the pending check transitions. Nothing is generated if there are none.
 	 */
 	void checkTransitionReport();
 
@@ -227,6 +441,64 @@ public:
 	 */
 	void parameterMonitoringDefinitionStatusReport();
 
+	/**
+	 * TC[12,17]
+	 * Enables the raising of events by failing FMON definitions.
+	 */
+	void enableFunctionalMonitoringFunction(const Message& message);
+
+	/**
+	 * TC[12,18]
+	 * Disables the raising of events by failing FMON definitions.
+	 */
+	void disableFunctionalMonitoringFunction(const Message& message);
+
+	/**
+	 * TC[12,19]
+	 */
+	void enableFunctionalMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,20]
+	 */
+	void disableFunctionalMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,21]
+	 * Protects FMON definitions from deletion.
+	 */
+	void protectFunctionalMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,22]
+	 */
+	void unprotectFunctionalMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,23]
+	 * Each definition consists of its FMON ID, the event definition ID, the minimum number of failing PMONs, the
+	 * number of PMONs and the PMON IDs. New definitions are disabled and unprotected.
+	 */
+	void addFunctionalMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,24]
+	 * Only disabled and unprotected definitions can be deleted.
+	 */
+	void deleteFunctionalMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,25]
+	 * Responds with a TM[12,26] functional monitoring definition report of the requested definitions.
+	 */
+	void reportFunctionalMonitoringDefinitions(Message& message);
+
+	/**
+	 * TC[12,27]
+	 * Responds with a TM[12,28] functional monitoring definition status report of all the definitions.
+	 */
+	void reportStatusOfFunctionalMonitoringDefinitions(const Message& message);
+
 	void execute(Message& message);
 };
 
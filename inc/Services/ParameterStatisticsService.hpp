@@ -3,11 +3,14 @@
 
 #include "ECSS_Definitions.hpp"
 #include "ErrorHandler.hpp"
+#include "Helpers/DueSchedule.hpp"
 #include "Helpers/Statistic.hpp"
 #include "Helpers/TimeGetter.hpp"
 #include "Service.hpp"
+#include "etl/algorithm.h"
 #include "etl/deque.h"
 #include "etl/map.h"
+#include "etl/vector.h"
 
 /**
  * Implementation of the ST[04] parameter statistics reporting service, as defined in ECSS-E-ST-70-41C.
@@ -21,6 +24,12 @@ private:
 	 * Interval of reporting in milliseconds
 	 */
 	static inline constexpr uint16_t InitialReportingIntervalMs = 700;
+
+	/**
+	 * The shortest period between two samples of a parameter, or between two periodic reports, which is the resolution
+	 * of @ref Time::DefaultCUC
+	 */
+	static inline constexpr std::chrono::milliseconds MinimumSamplingPeriod{100};
 	/**
 	 * The time at which the evaluation of statistics is initialized. It is basically the time when the statistics
 	 * are reset.
@@ -37,6 +46,40 @@ private:
 	 */
 	SamplingInterval reportingIntervalMs = InitialReportingIntervalMs;
 
+	/**
+	 * The time at which the next periodic TM[4,2] is due
+	 */
+	Time::DefaultCUC nextReportTime;
+
+	/**
+	 * The times at which the statistics definitions are due to be sampled next.
+	 *
+	 * As in the PMON schedule of ST[12], deleting or rescheduling a definition only makes its current entry outdated
+	 * (see @ref isScheduledSampleCurrent).
+	 */
+	using SamplingSchedule = DueSchedule<ParameterId, 2 * ECSSMaxStatisticParameters>;
+	using ScheduledSample = SamplingSchedule::Entry;
+
+	SamplingSchedule samplingSchedule;
+
+	/**
+	 * @return true if the entry is the current scheduled sample of an existing definition
+	 */
+	bool isScheduledSampleCurrent(const ScheduledSample& scheduledSample);
+
+	/**
+	 * Sets the time of the next sample of a definition, replacing any previously scheduled sample.
+	 */
+	void scheduleSample(ParameterId parameterId, Statistic& statistic, Time::DefaultCUC sampleTime);
+
+	/**
+	 * Converts a sampling or reporting interval to a period that can be added to a @ref Time::DefaultCUC, which is
+	 * never shorter than the resolution of the timestamp.
+	 */
+	static std::chrono::milliseconds toSamplingPeriod(SamplingInterval intervalMs) {
+		return etl::max(std::chrono::milliseconds(intervalMs), MinimumSamplingPeriod);
+	}
+
 	/**
 	 * Initializer of the statistics map, so that its content can be accessed by FreeRTOS tasks.
 	 */
@@ -55,6 +98,7 @@ public:
 		DeleteParameterStatisticsDefinitions = 7,
 		ReportParameterStatisticsDefinitions = 8,
 		ParameterStatisticsDefinitionsReport = 9,
+		SetParameterStatisticsWindowLengths = 128,
 	};
 
 	ParameterStatisticsService();
@@ -94,6 +138,20 @@ public:
 		return reportingIntervalMs;
 	}
 
+	/**
+	 * Sampling engine of the service, to be called periodically by the platform.
+	 *
+	 * Every statistics definition has its own timer, expiring every selfSamplingInterval milliseconds. All the
+	 * definitions that are due at currentTime are sampled in the same call, each with a single-value update, and
+	 * rescheduled one sampling interval after their previous due time. Definitions that are not due are not touched,
+	 * so the cost of a call depends on the number of due samples rather than on the number of definitions. If periodic
+	 * reporting is enabled, a TM[4,2] is also generated every reportingIntervalMs milliseconds.
+	 *
+	 * @param currentTime The time of this sampling cycle, shared by all the samples taken in it
+	 * @return The time at which the next sample or periodic report is due
+	 */
+	Time::DefaultCUC sampleDueStatistics(const Time::DefaultCUC& currentTime);
+
 	/**
 	 * TC[4,1] report the parameter statistics, by calling parameterStatisticsReport()
 	 */
@@ -111,6 +169,11 @@ public:
 
 	/**
 	 * Constructs and stores a TM[4,2] packet containing the parameter statistics report.
+	 *
+	 * If @ref SupportsSlidingWindowStatistics is set, the evaluation start and stop times at the start of the report
+	 * are replaced by the bounds of the evaluation of each parameter, which follow its sample count: the times of the
+	 * oldest and newest samples of its window for sliding-window statistics, or the evaluation start and stop times
+	 * otherwise.
 	 */
 	void parameterStatisticsReport();
 
@@ -145,6 +208,17 @@ public:
 	 */
 	void deleteStatisticsDefinitions(Message& request);
 
+	/**
+	 * TC[4,128] set the sliding window lengths of parameter statistics definitions. This is not a standard ECSS
+	 * message, and it is only accepted if @ref SupportsSlidingWindowStatistics is set.
+	 *
+	 * The request contains the number of definitions N, followed by N pairs of a parameter ID and a uint32_t window
+	 * length in milliseconds, where 0 returns the definition to cumulative statistics. The statistics of every changed
+	 * definition are reset. Lengths that the window of a definition cannot hold at its sampling interval are rejected
+	 * with an @ref ErrorHandler::InvalidStatisticsWindowLength error.
+	 */
+	void setStatisticsWindowLengths(Message& request);
+
 	/**
 	 * TC[4,8] report the parameter statistics definitions, by calling statisticsDefinitionsReport()
 	 */
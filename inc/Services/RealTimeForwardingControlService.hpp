@@ -5,7 +5,9 @@
 #include "ErrorHandler.hpp"
 #include "Helpers/AllReportTypes.hpp"
 #include "Helpers/ForwardControlConfiguration.hpp"
+#include "Helpers/WordBitset.hpp"
 #include "Service.hpp"
+#include "etl/array.h"
 #include "etl/vector.h"
 
 /**
@@ -15,6 +17,12 @@
  * conditions for all the application processes that are controlled by the Service, which determine whether a message
  * should be forwarded to the ground station, through the corresponding virtual channel.
  *
+ * The configuration is compiled into one bitmap per configured application process, with a bit for every service and
+ * message type, whenever a TC[14,1] or TC[14,2] changes it. @ref isForwarded is then a single bit test, which
+ * @ref Service::storeMessage uses to drop the reports that are not forwarded. The housekeeping parameter reports are
+ * also thinned out by the subsampling rate of their structure, and the event reports of blocked event definitions are
+ * dropped, with the same single lookup.
+ *
  * @author Konstantinos Petridis <petridkon@gmail.com>
  */
 class RealTimeForwardingControlService : Service {
@@ -26,11 +34,19 @@ public:
 		DeleteReportTypesFromAppProcessConfiguration = 2,
 		ReportAppProcessConfigurationContent = 3,
 		AppProcessConfigurationContentReport = 4,
+		AddStructuresToHousekeepingConfiguration = 5,
+		DeleteStructuresFromHousekeepingConfiguration = 6,
+		ReportHousekeepingConfigurationContent = 7,
+		HousekeepingConfigurationContentReport = 8,
+		AddEventDefinitionsToEventReportConfiguration = 13,
+		DeleteEventDefinitionsFromEventReportConfiguration = 14,
+		ReportEventReportConfigurationContent = 15,
 		EventReportConfigurationContentReport = 16,
 	};
 
 	RealTimeForwardingControlService() {
 		serviceType = ServiceType;
+		forwardingBitmapSlots.fill(NoForwardingBitmap);
 	}
 
 	/**
@@ -44,6 +60,17 @@ public:
 	 */
 	ApplicationProcessConfiguration applicationProcessConfiguration;
 
+	/**
+	 * The Housekeeping Parameter Report configuration, containing the forwarded structures of each application
+	 * process and their subsampling rates.
+	 */
+	HousekeepingReportConfiguration housekeepingReportConfiguration;
+
+	/**
+	 * The Event Report Blocking configuration, containing the blocked event definitions of each application process.
+	 */
+	EventReportBlockingConfiguration eventReportBlockingConfiguration;
+
 	/**
 	 * Receives a TC[14,3] 'Report the application process forward control configuration content' message and
 	 * performs the necessary error checking.
@@ -54,7 +81,97 @@ public:
 	 * Creates and stores a TM[14,4] 'Application process forward control configuration content report' message.
 	 */
 	void appProcessConfigurationContentReport();
+
+	/**
+	 * TC[14,7] 'Report the housekeeping parameter report forward control configuration content'.
+	 */
+	void reportHousekeepingConfigurationContent(const Message& request);
+
+	/**
+	 * Creates and stores a TM[14,8] 'Housekeeping parameter report forward control configuration content report'
+	 * message.
+	 */
+	void housekeepingConfigurationContentReport();
+
+	/**
+	 * TC[14,15] 'Report the event report blocking forward control configuration content'.
+	 */
+	void reportEventReportConfigurationContent(const Message& request);
+
+	/**
+	 * Creates and stores a TM[14,16] 'Event report blocking forward control configuration content report' message.
+	 */
+	void eventReportConfigurationContentReport();
+
+	/**
+	 * Checks whether a report is forwarded according to the configurations of the Service. Each configuration only
+	 * filters the application processes that have definitions in it, so all the reports of any other application
+	 * process, and all telecommands, are forwarded.
+	 *
+	 * @note The configurations only control the real-time forwarding of the reports. The reports that are not forwarded
+	 * are still generated, and a platform that stores them in ST[15] packet stores has to do so regardless of this
+	 * check. The x86 platform has no such path, so its @ref Service::storeMessage simply drops them.
+	 * @note Every housekeeping parameter report that is checked counts towards the subsampling rate of its structure.
+	 * @note The application process configuration is compiled when it is changed by a TC[14,1] or TC[14,2]. Changes
+	 * made directly to @ref applicationProcessConfiguration only take effect after @ref updateForwardingBitmaps is
+	 * called.
+	 */
+	bool isForwarded(const Message& message);
+
+	/**
+	 * Compiles the application process configuration into the forwarding bitmaps.
+	 */
+	void updateForwardingBitmaps();
+
 private:
+	/**
+	 * The report types of an application process that are forwarded, with one bit per service and message type
+	 */
+	using ForwardingBitmap = WordBitset<256 * 256>;
+
+	/**
+	 * The number of application process IDs, which are 11-bit numbers
+	 */
+	static constexpr size_t NumberOfApplicationIds = 2048;
+
+	static constexpr uint8_t NoForwardingBitmap = UINT8_MAX;
+
+	static_assert(ECSSMaxControlledApplicationProcesses < NoForwardingBitmap,
+	              "The slots of the forwarding bitmaps must fit in 8 bits");
+
+	/**
+	 * The application processes whose reports are filtered, in the order of their bitmaps in @ref forwardingBitmaps
+	 */
+	etl::vector<ApplicationProcessId, ECSSMaxControlledApplicationProcesses> filteredApplications;
+
+	etl::array<ForwardingBitmap, ECSSMaxControlledApplicationProcesses> forwardingBitmaps;
+
+	/**
+	 * The slot of the bitmap of every application process in @ref forwardingBitmaps, or @ref NoForwardingBitmap if its
+	 * reports are not filtered, so that the bitmap of a report is found without searching
+	 */
+	etl::array<uint8_t, NumberOfApplicationIds> forwardingBitmapSlots;
+
+	static constexpr size_t reportIndex(ServiceTypeNum serviceType, MessageTypeNum messageType) {
+		return (static_cast<size_t>(serviceType) << 8U) | messageType;
+	}
+
+	/**
+	 * Checks whether a housekeeping parameter report is forwarded, and counts it towards the subsampling rate of its
+	 * structure.
+	 */
+	bool isHousekeepingReportForwarded(const Message& report);
+
+	/**
+	 * Checks whether the event definition of an event report is not blocked.
+	 */
+	bool isEventReportForwarded(const Message& report);
+
+	/**
+	 * Skips the rest of the definition of an application process in a request, after it has been rejected.
+	 */
+	static void skipApplicationDefinition(Message& request, uint8_t numOfItems, uint8_t itemSize);
+
 	/**
 	 * Adds all report types of the specified application process definition, to the application process configuration.
 	 */
@@ -189,6 +306,26 @@ public:
 	 */
 	void deleteReportTypesFromAppProcessConfiguration(Message& request);
 
+	/**
+	 * TC[14,5] 'Add structure identifiers to the housekeeping parameter report forward control configuration'.
+	 */
+	void addStructuresToHousekeepingConfiguration(Message& request);
+
+	/**
+	 * TC[14,6] 'Delete structure identifiers from the housekeeping parameter report forward control configuration'.
+	 */
+	void deleteStructuresFromHousekeepingConfiguration(Message& request);
+
+	/**
+	 * TC[14,13] 'Add event definition identifiers to the event report blocking forward control configuration'.
+	 */
+	void addEventDefinitionsToEventReportConfiguration(Message& request);
+
+	/**
+	 * TC[14,14] 'Delete event definition identifiers from the event report blocking forward control configuration'.
+	 */
+	void deleteEventDefinitionsFromEventReportConfiguration(Message& request);
+
 	/**
 	 * It is responsible to call the suitable function that executes a TC packet. The source of that packet
 	 * is the ground station.
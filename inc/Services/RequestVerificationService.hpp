@@ -62,12 +62,22 @@ public:
 	 */
 	inline static constexpr uint8_t SecondaryHeaderFlag = 1;
 
+	/**
+	 * The fields of the request ID (5.4.11.2.1) that are the same for every request, placed at their bits, so that a
+	 * report only needs to OR the packet type, the APID and the sequence count into them
+	 */
+	inline static constexpr uint32_t RequestIdTemplate =
+	    (static_cast<uint32_t>(CCSDSPacketVersion) << (32U - CCSDSPacketVersionBits)) |
+	    (static_cast<uint32_t>(SecondaryHeaderFlag) << (32U - CCSDSPacketVersionBits - PacketTypeBits - SecondaryHeaderFlagBits)) |
+	    (static_cast<uint32_t>(ECSSSequenceFlags) << PacketSequenceCountBits);
+
 	RequestVerificationService() {
 		serviceType = ServiceType;
 	}
 
 	/**
 	 * TM[1,1] successful acceptance verification report
+	 * It is only generated if the request has the Message::AcknowledgeAcceptance flag.
 	 *
 	 * @param request Contains the necessary data to send the report.
 	 * The data is actually some data members of Message that contain the basic info
@@ -87,6 +97,7 @@ public:
 
 	/**
 	 * TM[1,3] successful start of execution verification report
+	 * It is only generated if the request has the Message::AcknowledgeStart flag.
 	 *
 	 * @param request Contains the necessary data to send the report.
 	 * The data is actually some data members of Message that contain the basic info
@@ -106,6 +117,7 @@ public:
 
 	/**
 	 * TM[1,5] successful progress of execution verification report
+	 * It is only generated if the request has the Message::AcknowledgeProgress flag.
 	 *
 	 * @param request Contains the necessary data to send the report.
 	 * The data is actually some data members of Message that contain the basic info
@@ -134,6 +146,7 @@ public:
 
 	/**
 	 * TM[1,7] successful completion of execution verification report
+	 * It is only generated if the request has the Message::AcknowledgeCompletion flag.
 	 *
 	 * @param request Contains the necessary data to send the report.
 	 * The data is actually data members of Message that contain the basic info of the
@@ -164,7 +177,8 @@ public:
 
 
 	/**
-	 * Helper function to append the bits on the report message.
+	 * Helper function to append the request ID on the report message, filling the fields of the request into
+	 * @ref RequestIdTemplate.
 	 *
 	 * @param request Contains the necessary data to send the report.
 	 * The data is actually some data members of Message that contain the basic info of the
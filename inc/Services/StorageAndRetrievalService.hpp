@@ -223,6 +223,14 @@ public:
 	 */
 	void addTelemetryToPacketStore(const String<ECSSPacketStoreIdSize>& packetStoreId, Time::DefaultCUC timestamp);
 
+	/**
+	 * Adds a TM packet to the specified packet store, with its timestamp. The packet store shares the buffer of the
+	 * packet with the other holders of its handle, instead of copying it. An invalid handle, e.g. from a failed
+	 * acquisition, is not stored, and the packets of the store whose buffers have been dropped by the pool are removed.
+	 */
+	void addTelemetryToPacketStore(const String<ECSSPacketStoreIdSize>& packetStoreId, Time::DefaultCUC timestamp,
+	                               MessageHandle tmPacket);
+
 	/**
 	 * Deletes the content from all the packet stores.
 	 */
@@ -2,10 +2,16 @@
 #define ECSS_SERVICES_TIMEBASEDSCHEDULINGSERVICE_HPP
 
 #include "ErrorHandler.hpp"
+#include "Helpers/ActivitySchedule.hpp"
 #include "Helpers/CRCHelper.hpp"
+#include "Helpers/HashIndex.hpp"
+#include "Helpers/Journal.hpp"
+#include "Helpers/TCArena.hpp"
 #include "MessageParser.hpp"
 #include "Service.hpp"
-#include "etl/list.h"
+#include "etl/array.h"
+#include "etl/bitset.h"
+#include "etl/vector.h"
 
 // Include platform specific files
 #include "Helpers/TimeGetter.hpp"
@@ -15,15 +21,16 @@
  * @def GROUPS_ENABLED
  * @brief Indicates whether scheduling groups are enabled
  */
-#define GROUPS_ENABLED 0 // NOLINT(cppcoreguidelines-macro-usage)
+#define GROUPS_ENABLED 1 // NOLINT(cppcoreguidelines-macro-usage)
 
 /**
  * @def SUB_SCHEDULES_ENABLED
  * @brief Indicates whether sub-schedules are supported
  *
- * @details Sub-schedules are currently not implemented so this has no effect
+ * @details When enabled, TC[11,4] carries the sub-schedule of the inserted activities, and the activity reports
+ * contain the sub-schedule of every activity
  */
-#define SUB_SCHEDULES_ENABLED 0 // NOLINT(cppcoreguidelines-macro-usage)
+#define SUB_SCHEDULES_ENABLED 1 // NOLINT(cppcoreguidelines-macro-usage)
 
 /**
  * @brief Namespace to access private members during test
@@ -69,45 +76,251 @@ private:
 			return (sequenceCount != rightSide.sequenceCount) or (applicationID != rightSide.applicationID) or
 			       (sourceID != rightSide.sourceID);
 		}
+
+		bool operator==(const RequestID& rightSide) const {
+			return not(*this != rightSide);
+		}
+	};
+
+	/**
+	 * Hash of a request identifier, mixing all of its fields so that consecutive sequence counts spread over the index
+	 */
+	struct RequestIDHash {
+		uint32_t operator()(const RequestID& requestID) const {
+			const uint32_t fields = (static_cast<uint32_t>(requestID.sequenceCount) << 16U) ^
+			                        (static_cast<uint32_t>(requestID.applicationID) << 8U) ^ requestID.sourceID;
+			// The index uses the low bits of the hash, which the product only takes from the low bits of the fields
+			const uint32_t product = fields * 2654435761U;
+			return product ^ (product >> 16U);
+		}
 	};
 
 	/**
 	 * @brief Instances of activities to run in the schedule
 	 *
 	 * @details All scheduled activities must contain the request they exist for, their release
-	 * time and the corresponding request identifier.
-	 *
-	 * @todo (#228) If we decide to use sub-schedules, the ID of that has to be defined
-	 * @todo (#229) If groups are used, then the group ID has to be defined here
+	 * time and the corresponding request identifier. The request is kept as a packet in
+	 * @ref scheduledRequests, and only parsed into a Message when the activity is released.
+	 * The activity is only executed if both its sub-schedule and its group are enabled at that time.
 	 */
 	struct ScheduledActivity {
-		Message request;                         ///< Hold the received command request
+		SlotHandle request;                      ///< Handle of the received command request packet
 		RequestID requestID;                     ///< Request ID, characteristic of the definition
 		Time::DefaultCUC requestReleaseTime{0}; ///< Keep the command release time
+		SubScheduleId subScheduleID = 0;         ///< The sub-schedule that the activity belongs to
+		SchedulingGroupId groupID = DefaultGroup; ///< The group that the activity belongs to
 	};
 
+	using Schedule = ActivitySchedule<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>;
+	using ActivityIndex = Schedule::Index;
+	using ActivityIndexList = etl::vector<ActivityIndex, ECSSMaxNumberOfTimeSchedActivities>;
+
 	/**
 	 * @brief Hold the scheduled activities
 	 *
-	 * @details The scheduled activities in this list are ordered by their release time, as the
-	 * standard requests.
+	 * @details The scheduled activities are kept in a heap ordered by their release time, so that the next activity
+	 * to release is always at the front, and inserting, deleting or time-shifting one activity does not reorder the
+	 * whole schedule. Reports list the activities by ascending release time, as the standard requests.
+	 */
+	Schedule scheduledActivities;
+
+	/**
+	 * @brief Hold the request packets of the scheduled activities
+	 *
+	 * @details Each request takes as many bytes as its packet, instead of a whole Message.
+	 */
+	TCArena<ECSSTimeSchedTCArenaSize, ECSSMaxNumberOfTimeSchedActivities> scheduledRequests;
+
+	/**
+	 * @brief The enable status of every sub-schedule
+	 *
+	 * @details All the sub-schedules exist, and are enabled until TC[11,21] disables them. Enabling or disabling a
+	 * sub-schedule only flips its bit, since the status is checked when each of its activities is released.
+	 */
+	etl::bitset<ECSSMaxTimeSchedSubSchedules> enabledSubSchedules;
+
+	/**
+	 * @brief The groups that have been created by TC[11,22]
+	 *
+	 * @details The @ref DefaultGroup always exists.
+	 */
+	etl::bitset<ECSSMaxTimeSchedGroups> definedGroups;
+
+	/**
+	 * @brief The enable status of every group
+	 *
+	 * @details As with the sub-schedules, the status is checked when each activity is released, so that enabling or
+	 * disabling a group is O(1) no matter how many activities it has.
+	 */
+	etl::bitset<ECSSMaxTimeSchedGroups> enabledGroups;
+
+	/**
+	 * @brief The number of scheduled activities in every group, so that a group can only be deleted when it is empty
 	 */
-	etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> scheduledActivities;
+	etl::array<uint16_t, ECSSMaxTimeSchedGroups> activitiesPerGroup{};
 
 	/**
-	 * @brief Sort the activities by their release time
+	 * @brief Index of the scheduled activities by their request identifier
 	 *
-	 * @details The ECSS standard requires that the activities are sorted in the TM message
-	 * response. Also it is better to have the activities sorted.
+	 * @details It is kept up to date with @ref scheduledActivities, so that the TCs that refer to activities by their
+	 * request identifier find each of them in constant time instead of scanning the schedule.
+	 */
+	HashIndex<RequestID, ActivityIndex, ECSSMaxNumberOfTimeSchedActivities, RequestIDHash> requestIDIndex;
+
+	/**
+	 * The kinds of the records in the journal of the schedule
+	 */
+	enum class JournalRecordType : uint8_t {
+		ActivityInserted = 1,
+		ActivityDeleted = 2,
+		ActivityReleased = 3,
+		ActivityRetimed = 4,
+		AllActivitiesShifted = 5,
+		ScheduleReset = 6,
+		ScheduleStatus = 7,
+	};
+
+	/**
+	 * The fields of the record of an inserted activity, which are followed by its request packet
 	 */
-	inline static void
-	sortActivitiesReleaseTime(etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& schedActivities) {
-		schedActivities.sort([](ScheduledActivity const& leftSide, ScheduledActivity const& rightSide) {
-			// cppcheck-suppress
-			return leftSide.requestReleaseTime < rightSide.requestReleaseTime;
-		});
+	using InsertionRecord = Journal::RecordOf<JournalRecordType, ActivityIndex, SourceId, ApplicationProcessId,
+	                                          SequenceCount, SubScheduleId, SchedulingGroupId, uint32_t, uint16_t>;
+
+	/**
+	 * The record of the execution status and the status of the sub-schedules and groups
+	 */
+	using StatusRecord = Journal::RecordOf<JournalRecordType, bool, uint32_t, uint32_t, uint32_t>;
+
+	/**
+	 * @brief The optional write-ahead journal of the schedule
+	 *
+	 * @details Every change of the schedule is appended to it after it is applied, so that the schedule can be
+	 * rebuilt by @ref attachJournal after a restart. When the journal is full, it is compacted into a snapshot of the
+	 * current schedule.
+	 */
+	Journal journal;
+
+	/**
+	 * True while the schedule is rebuilt from the journal, so that the replayed changes are not appended to it again
+	 */
+	bool restoringJournal = false;
+
+	/**
+	 * True after a change could not be journaled because no snapshot of the schedule fits in the journal. Until a
+	 * snapshot is written, every later change is dropped as well, so that the journal is never replayed with a gap.
+	 */
+	bool journalIsStale = false;
+
+	/**
+	 * @return true if the changes of the schedule have to be appended to the journal, which is checked before a
+	 * record is built
+	 */
+	bool isJournaling() const {
+		return journal.isAttached() and not restoringJournal;
 	}
 
+	/**
+	 * Appends a record, followed by an optional payload, to the journal, compacting the journal when it is full or
+	 * stale
+	 */
+	template <size_t Capacity>
+	void writeJournalRecord(const Journal::Record<Capacity>& record, etl::span<const uint8_t> payload = {});
+
+	/**
+	 * Appends the record of an inserted, deleted or released activity to the journal
+	 */
+	void journalActivity(JournalRecordType type, ActivityIndex index);
+
+	/**
+	 * Appends the execution status and the status of the sub-schedules and groups to the journal
+	 */
+	void journalStatus();
+
+	/**
+	 * Builds the journal record of an activity with its index, request identifier, sub-schedule, group, release time
+	 * and request length, to be followed by the request packet
+	 */
+	InsertionRecord insertionRecord(ActivityIndex index, const ScheduledActivity& activity) const;
+
+	/**
+	 * Builds the journal record of the execution status and the status of the sub-schedules and groups
+	 */
+	StatusRecord statusRecord() const;
+
+	/**
+	 * Applies a record of the journal to the schedule, while the schedule is rebuilt
+	 */
+	void applyJournalRecord(etl::span<const uint8_t> record);
+
+	/**
+	 * Deletes all the scheduled activities
+	 */
+	void clearSchedule();
+
+	/**
+	 * Adds an activity to the schedule and to the index of request identifiers
+	 */
+	void addActivity(const ScheduledActivity& activity);
+
+	/**
+	 * Removes an activity from the schedule and from the index of request identifiers, and releases its request
+	 *
+	 * @param reason Whether the activity was deleted or released, as recorded in the journal
+	 */
+	void removeActivity(ActivityIndex index, JournalRecordType reason);
+
+	/**
+	 * @return true if the sub-schedule and the group of an activity are both enabled
+	 */
+	bool isEnabled(const ScheduledActivity& activity) const {
+		return enabledSubSchedules[activity.subScheduleID] and enabledGroups[activity.groupID];
+	}
+
+	/**
+	 * Deletes all the groups except the @ref DefaultGroup, and enables all the sub-schedules, as when the service is
+	 * created
+	 */
+	void resetSubSchedulesAndGroups();
+
+	/**
+	 * Reads the sub-schedule identifiers of a TC[11,20] or TC[11,21], and sets their status. If no identifiers are
+	 * given, all the sub-schedules are set.
+	 */
+	void setSubScheduleStatus(Message& request, bool status);
+
+	/**
+	 * Reads the group identifiers of a TC[11,24] or TC[11,25], and sets their status. If no identifiers are given,
+	 * all the existing groups are set.
+	 */
+	void setGroupStatus(Message& request, bool status);
+
+	/**
+	 * Deletes a group, reporting an error if it does not exist, is the @ref DefaultGroup, or still has activities
+	 */
+	void deleteGroup(const Message& request, SchedulingGroupId groupID);
+
+	/**
+	 * Reads a request identifier from a TC, in the order defined by the standard
+	 */
+	static RequestID readRequestID(Message& request);
+
+	/**
+	 * @return The index of the scheduled activity with a request identifier, or @ref Schedule::NoActivity if there
+	 * is none. If several activities share the identifier, the one released first is returned.
+	 */
+	ActivityIndex findActivity(const RequestID& requestID);
+
+	/**
+	 * Reads the request identifiers of a TC[11,9] or TC[11,12], and collects the matching activities by ascending
+	 * release time. An error is reported for every identifier that does not match a scheduled activity.
+	 */
+	void collectActivitiesByID(Message& request, ActivityIndexList& matchedActivities);
+
+	/**
+	 * Appends the sub-schedule, the group, the release time and the request of an activity to a TM[11,10]
+	 */
+	void appendActivityDetails(Message& report, const ScheduledActivity& activity) const;
+
 	/**
 	 * @brief Define a friend in order to be able to access private members during testing
 	 *
@@ -125,6 +338,11 @@ private:
 public:
 	inline static constexpr ServiceTypeNum ServiceType = 11;
 
+	/**
+	 * The group of the activities that are not assigned to any other group. It always exists, and cannot be deleted.
+	 */
+	inline static constexpr SchedulingGroupId DefaultGroup = 0;
+
 	enum MessageType : uint8_t {
 		EnableTimeBasedScheduleExecutionFunction = 1,
 		DisableTimeBasedScheduleExecutionFunction = 2,
@@ -138,8 +356,40 @@ public:
 		TimeBasedScheduledSummaryReport = 13,
 		TimeShiftALlScheduledActivities = 15,
 		DetailReportAllScheduledActivities = 16,
+		ReportSubScheduleStatus = 18,
+		SubScheduleStatusReport = 19,
+		EnableSubSchedules = 20,
+		DisableSubSchedules = 21,
+		CreateSchedulingGroups = 22,
+		DeleteSchedulingGroups = 23,
+		EnableSchedulingGroups = 24,
+		DisableSchedulingGroups = 25,
+		ReportSchedulingGroupStatus = 26,
+		SchedulingGroupStatusReport = 27,
 	};
 
+	/**
+	 * The number of activities released more than @ref ECSSTimeSchedLateReleaseMargin after their release time
+	 */
+	uint32_t lateReleaseCount = 0;
+
+	/**
+	 * The number of calls of @ref executeScheduledActivity that left due activities to the next call, because
+	 * @ref ECSSMaxTimeSchedReleasesPerTick activities had already been released
+	 */
+	uint32_t releaseBudgetExhaustedCount = 0;
+
+	/**
+	 * The largest delay between the release time of an activity and its actual release, in milliseconds
+	 */
+	uint32_t maximumReleaseDelay = 0;
+
+	/**
+	 * The number of activities that were removed at their release time without being executed, because their
+	 * sub-schedule or their group was disabled
+	 */
+	uint32_t discardedActivityCount = 0;
+
 	/**
 	 * @brief Class constructor
 	 * @details Initializes the serviceType
@@ -147,11 +397,38 @@ public:
 	TimeBasedSchedulingService();
 
 	/**
-	 * This function executes the next activity and removes it from the list.
-	 * @return the requestReleaseTime of next activity to be executed after this time
+	 * This function executes all the activities whose release time has come, in release order, and removes them
+	 * from the schedule. At most @ref ECSSMaxTimeSchedReleasesPerTick activities are released in one call, and the
+	 * rest are left for the next call.
+	 *
+	 * @return the requestReleaseTime of next activity to be executed. It is not later than currentTime if due
+	 * activities are left, and it is Time::DefaultCUC::max() if the schedule is empty.
 	 */
 	Time::DefaultCUC executeScheduledActivity(Time::DefaultCUC currentTime);
 
+	/**
+	 * Keeps a journal of the schedule in a memory region, e.g. a memory-mapped file, and rebuilds the schedule from
+	 * the journal that the region already holds. If the region holds no journal, the schedule is emptied and a new
+	 * journal is started.
+	 *
+	 * @param region The memory of the journal, which must stay valid until @ref detachJournal is called. Half of it,
+	 * minus a few bytes, must fit a snapshot of a full schedule.
+	 */
+	void attachJournal(etl::span<uint8_t> region);
+
+	/**
+	 * Stops keeping a journal of the schedule. The region keeps the journal up to this point.
+	 */
+	void detachJournal() {
+		journal.detach();
+	}
+
+	/**
+	 * Replaces the journal with a snapshot of the current schedule, so that it can be rebuilt without replaying the
+	 * changes made so far. This is done automatically when the journal is full.
+	 */
+	void compactJournal();
+
 	/**
 	 * @brief TC[11,1] enable the time-based schedule execution function
 	 *
@@ -172,7 +449,7 @@ public:
 	 * @brief TC[11,3] reset the time-based schedule
 	 *
 	 * @details Resets the time-based command execution schedule, by clearing all scheduled
-	 * activities.
+	 * activities, deleting all the groups except the default one and enabling all the sub-schedules.
 	 * @param request Provide the received message as a parameter
 	 */
 	void resetSchedule(const Message& request);
@@ -183,17 +460,113 @@ public:
 	 * @details Add activities into the schedule for future execution. The activities are inserted
 	 * by ascending order of their release time. This done to avoid confusion during the
 	 * execution of the schedule and also to make things easier whenever a release time sorted
-	 * report is requested by he corresponding service.
+	 * report is requested by he corresponding service. The TC contains the sub-schedule of all the activities once,
+	 * and the group of each activity before its release time.
 	 * @param request Provide the received message as a parameter
 	 * @todo (#230) Definition of the time format is required
 	 * @throws ExecutionStartError If there is request to be inserted and the maximum
 	 * number of activities in the current schedule has been reached, then an @ref
 	 * ErrorHandler::ExecutionStartErrorType is being issued.  Also if the release time of the
 	 * request is less than a set time margin, defined in @ref ECSS_TIME_MARGIN_FOR_ACTIVATION,
-	 * from the current time a @ref ErrorHandler::ExecutionStartErrorType is also issued.
+	 * from the current time a @ref ErrorHandler::ExecutionStartErrorType is also issued. An activity
+	 * in a group that does not exist is rejected, and so is the whole TC if the sub-schedule does not exist.
 	 */
 	void insertActivities(Message& request);
 
+	/**
+	 * @brief TC[11,18] report the status of each sub-schedule
+	 *
+	 * @details Generates a TM[11,19] response with the status of all the sub-schedules.
+	 * @param request Provide the received message as a parameter
+	 */
+	void reportSubScheduleStatus(const Message& request);
+
+	/**
+	 * @brief TM[11,19] time-based sub-schedule status report
+	 *
+	 * @details Contains the number of sub-schedules, and the identifier and the enable status of each of them.
+	 */
+	void subScheduleStatusReport();
+
+	/**
+	 * @brief TC[11,20] enable time-based sub-schedules
+	 *
+	 * @details Enables the listed sub-schedules, or all of them if the list is empty. The activities of an enabled
+	 * sub-schedule are executed at their release time, if their group is also enabled.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a sub-schedule does not exist, an @ref ErrorHandler::InvalidSubScheduleId is
+	 * issued for that instruction.
+	 */
+	void enableSubSchedules(Message& request);
+
+	/**
+	 * @brief TC[11,21] disable time-based sub-schedules
+	 *
+	 * @details Disables the listed sub-schedules, or all of them if the list is empty. The activities of a disabled
+	 * sub-schedule are discarded without being executed when their release time comes.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a sub-schedule does not exist, an @ref ErrorHandler::InvalidSubScheduleId is
+	 * issued for that instruction.
+	 */
+	void disableSubSchedules(Message& request);
+
+	/**
+	 * @brief TC[11,22] create time-based scheduling groups
+	 *
+	 * @details Creates the listed groups, each one with its initial enable status.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a group identifier is out of range, or the group already exists, an error is
+	 * issued for that instruction.
+	 */
+	void createGroups(Message& request);
+
+	/**
+	 * @brief TC[11,23] delete time-based scheduling groups
+	 *
+	 * @details Deletes the listed groups, or all of them except the default one if the list is empty. Only groups
+	 * without scheduled activities can be deleted.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a group does not exist, is the default group, or still has scheduled activities,
+	 * an error is issued for that instruction.
+	 */
+	void deleteGroups(Message& request);
+
+	/**
+	 * @brief TC[11,24] enable time-based scheduling groups
+	 *
+	 * @details Enables the listed groups, or all the existing ones if the list is empty.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a group does not exist, an @ref ErrorHandler::InvalidSchedulingGroupId is issued
+	 * for that instruction.
+	 */
+	void enableGroups(Message& request);
+
+	/**
+	 * @brief TC[11,25] disable time-based scheduling groups
+	 *
+	 * @details Disables the listed groups, or all the existing ones if the list is empty. The activities of a
+	 * disabled group are discarded without being executed when their release time comes.
+	 * @param request Provide the received message as a parameter
+	 * @throws ExecutionStartError If a group does not exist, an @ref ErrorHandler::InvalidSchedulingGroupId is issued
+	 * for that instruction.
+	 */
+	void disableGroups(Message& request);
+
+	/**
+	 * @brief TC[11,26] report the status of each time-based scheduling group
+	 *
+	 * @details Generates a TM[11,27] response with the status of all the existing groups.
+	 * @param request Provide the received message as a parameter
+	 */
+	void reportGroupStatus(const Message& request);
+
+	/**
+	 * @brief TM[11,27] time-based scheduling group status report
+	 *
+	 * @details Contains the number of existing groups, and the identifier and the enable status of each of them.
+	 */
+	void groupStatusReport();
+
 	/**
 	 * @brief TC[11,15] time-shift all scheduled activities
 	 *
@@ -222,9 +595,10 @@ public:
 	 *
 	 * @details Send a detailed report about the status of the activities listed
 	 * on the provided list. Generates a TM[11,10] response.
-	 * @param listOfActivities Provide the list of activities that need to be reported on
+	 * @param listOfActivities Provide the indices of the activities that need to be reported on, by ascending
+	 * release time
 	 */
-	void timeBasedScheduleDetailReport(const etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& listOfActivities);
+	void timeBasedScheduleDetailReport(const ActivityIndexList& listOfActivities);
 
 	/**
 	 * @brief TC[11,9] detail-report activities identified by request identifier
@@ -258,9 +632,10 @@ public:
 	 *
 	 * @details Send a summary report about the status of the activities listed
 	 * on the provided list. Generates a TM[11,13] response.
-	 * @param listOfActivities Provide the list of activities that need to be reported on
+	 * @param listOfActivities Provide the indices of the activities that need to be reported on, by ascending
+	 * release time
 	 */
-	void timeBasedScheduleSummaryReport(const etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& listOfActivities);
+	void timeBasedScheduleSummaryReport(const ActivityIndexList& listOfActivities);
 
 	/**
 	 * @brief TC[11,5] delete time-based scheduled activities identified by a request identifier
@@ -6,19 +6,8 @@ uint16_t CRCHelper::calculateCRC(const uint8_t* message, uint32_t length) {
 	CRCSize shiftReg = InitialShiftRegisterValue;
 
 	for (uint32_t i = 0; i < length; i++) {
-		// "copy" (XOR w/ existing contents) the current msg bits into the MSB of the shift register
-		shiftReg ^= (message[i] << BitNumber);
-
-		for (int j = 0; j < BitNumber; j++) {
-			// if the MSB is set, the bitwise AND gives 1
-			if ((shiftReg & MSBMask) != 0U) {
-				// toss out of the register the MSB and divide (XOR) its content with the generator
-				shiftReg = ((shiftReg << 1U) ^ Polynomial);
-			} else {
-				// just toss out the MSB and make room for a new bit
-				shiftReg <<= 1U;
-			}
-		}
+		// divide the MSB of the register, XORed with the current msg byte, by the generator in one step
+		shiftReg = static_cast<CRCSize>((shiftReg << BitNumber) ^ Table[(shiftReg >> BitNumber) ^ message[i]]);
 	}
 	return shiftReg;
 }
@@ -1,9 +1,23 @@
 #include "Helpers/PacketStore.hpp"
+#include <algorithm>
 
 uint16_t PacketStore::calculateSizeInBytes() {
 	const uint16_t size = std::accumulate(storedTelemetryPackets.begin(), storedTelemetryPackets.end(), 0, [] // NOLINT (cppcoreguidelines-init-variables)
 	                                      (uint16_t sum, const auto& tmPacket) {
-		return sum + tmPacket.second.dataSize;
+		return sum + (tmPacket.second ? tmPacket.second->dataSize : 0);
 	});
 	return size;
 }
+
+void PacketStore::removeDroppedPackets() {
+	auto droppedPackets = std::remove_if(storedTelemetryPackets.begin(), storedTelemetryPackets.end(), [](const auto& tmPacket) {
+		return not tmPacket.second;
+	});
+	storedTelemetryPackets.erase(droppedPackets, storedTelemetryPackets.end());
+}
+
+uint16_t PacketStore::countHeldPackets() const {
+	return std::count_if(storedTelemetryPackets.begin(), storedTelemetryPackets.end(), [](const auto& tmPacket) {
+		return static_cast<bool>(tmPacket.second);
+	});
+}
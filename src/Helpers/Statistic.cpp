@@ -1,7 +1,20 @@
 #include "Helpers/Statistic.hpp"
 #include <cmath>
+#include "etl/array.h"
+
+namespace {
+	/**
+	 * The number of independent accumulators used by the batch reductions. The lanes do not depend on each other, so
+	 * that the compiler can map them to SIMD registers where the target has them.
+	 */
+	constexpr size_t ReductionLanes = 4;
+} // namespace
 
 void Statistic::updateStatistics(double value) {
+	if (isWindowed()) {
+		updateStatistics(value, TimeGetter::getCurrentTimeDefaultCUC());
+		return;
+	}
 	if (value > max) {
 		max = value;
 		timeOfMaxValue = TimeGetter::getCurrentTimeDefaultCUC();
@@ -10,14 +23,148 @@ void Statistic::updateStatistics(double value) {
 		min = value;
 		timeOfMinValue = TimeGetter::getCurrentTimeDefaultCUC();
 	}
-	if (sampleCounter + 1 > 0) {  //cppcheck-suppress knownConditionTrueFalse
-		mean = (mean * sampleCounter + value) / (sampleCounter + 1);
+	accumulate(value);
+}
+
+void Statistic::updateStatistics(double value, const Time::DefaultCUC& sampleTime) {
+	if (isWindowed()) {
+		window.add(value, sampleTime);
+		expireWindow(sampleTime);
+		return;
+	}
+	if (value > max) {
+		max = value;
+		timeOfMaxValue = sampleTime;
+	}
+	if (value < min) {
+		min = value;
+		timeOfMinValue = sampleTime;
+	}
+	accumulate(value);
+}
+
+void Statistic::updateStatistics(etl::span<const double> samples, const Time::DefaultCUC& firstSampleTime,
+                                 std::chrono::milliseconds samplingPeriod) {
+	const size_t sampleCount = samples.size();
+	if (sampleCount == 0) {
+		return;
+	}
+	if (isWindowed()) {
+		for (size_t index = 0; index < sampleCount; index++) {
+			window.add(samples[index], firstSampleTime + samplingPeriod * static_cast<int64_t>(index));
+		}
+		expireWindow(firstSampleTime + samplingPeriod * static_cast<int64_t>(sampleCount - 1));
+		return;
+	}
+	const double* values = samples.data();
+	const size_t vectorisedCount = sampleCount - sampleCount % ReductionLanes;
+
+	etl::array<double, ReductionLanes> laneSums{};
+	etl::array<double, ReductionLanes> laneMin{};
+	etl::array<double, ReductionLanes> laneMax{};
+	etl::array<size_t, ReductionLanes> laneArgMin{};
+	etl::array<size_t, ReductionLanes> laneArgMax{};
+	laneMin.fill(std::numeric_limits<double>::infinity());
+	laneMax.fill(-std::numeric_limits<double>::infinity());
+
+	auto reduce = [&](size_t lane, size_t index) {
+		const double value = values[index];
+		laneSums[lane] += value;
+		const bool isLower = value < laneMin[lane];
+		const bool isHigher = value > laneMax[lane];
+		laneMin[lane] = isLower ? value : laneMin[lane];
+		laneArgMin[lane] = isLower ? index : laneArgMin[lane];
+		laneMax[lane] = isHigher ? value : laneMax[lane];
+		laneArgMax[lane] = isHigher ? index : laneArgMax[lane];
+	};
+	for (size_t index = 0; index < vectorisedCount; index += ReductionLanes) {
+		for (size_t lane = 0; lane < ReductionLanes; lane++) {
+			reduce(lane, index + lane);
+		}
+	}
+	for (size_t index = vectorisedCount; index < sampleCount; index++) {
+		reduce(index - vectorisedCount, index);
+	}
+
+	double batchSum = 0;
+	size_t argMin = laneArgMin[0];
+	size_t argMax = laneArgMax[0];
+	for (size_t lane = 0; lane < ReductionLanes; lane++) {
+		batchSum += laneSums[lane];
+		// Ties are resolved towards the earliest sample, as when the samples are added one by one
+		if (laneMin[lane] < values[argMin] or (laneMin[lane] == values[argMin] and laneArgMin[lane] < argMin)) {
+			argMin = laneArgMin[lane];
+		}
+		if (laneMax[lane] > values[argMax] or (laneMax[lane] == values[argMax] and laneArgMax[lane] < argMax)) {
+			argMax = laneArgMax[lane];
+		}
+	}
+	const double batchMean = batchSum / static_cast<double>(sampleCount);
+
+	// The sketch is updated in its own pass, so that its branches do not keep the reductions from being vectorised
+	if constexpr (SupportsQuantiles) {
+		for (size_t index = 0; index < sampleCount; index++) {
+			quantiles.add(values[index]);
+		}
+	}
+
+	etl::array<double, ReductionLanes> laneDeviations{};
+	for (size_t index = 0; index < vectorisedCount; index += ReductionLanes) {
+		for (size_t lane = 0; lane < ReductionLanes; lane++) {
+			const double deviation = values[index + lane] - batchMean;
+			laneDeviations[lane] += deviation * deviation;
+		}
+	}
+	for (size_t index = vectorisedCount; index < sampleCount; index++) {
+		const double deviation = values[index] - batchMean;
+		laneDeviations[index - vectorisedCount] += deviation * deviation;
+	}
+	double batchDeviations = 0;
+	for (const double deviations: laneDeviations) {
+		batchDeviations += deviations;
+	}
+
+	if (values[argMax] > max) {
+		max = values[argMax];
+		timeOfMaxValue = firstSampleTime + samplingPeriod * static_cast<int64_t>(argMax);
+	}
+	if (values[argMin] < min) {
+		min = values[argMin];
+		timeOfMinValue = firstSampleTime + samplingPeriod * static_cast<int64_t>(argMin);
+	}
+
+	const auto previousCount = static_cast<double>(sampleCounter);
+	const auto batchCount = static_cast<double>(sampleCount);
+	const double totalCount = previousCount + batchCount;
+	const double delta = batchMean - mean;
+	mean += delta * batchCount / totalCount;
+	sumOfSquaredDeviations += batchDeviations + delta * delta * previousCount * batchCount / totalCount;
+	sampleCounter += sampleCount;
+}
+
+void Statistic::accumulate(double value) {
+	if constexpr (SupportsQuantiles) {
+		quantiles.add(value);
 	}
-	sumOfSquares += pow(value, 2);
 	sampleCounter++;
+	const double delta = value - mean;
+	mean += delta / sampleCounter;
+	sumOfSquaredDeviations += delta * (value - mean);
+}
+
+double Statistic::standardDeviation() const {
+	if (sampleCounter == 0) {
+		return 0;
+	}
+	return sqrt(sumOfSquaredDeviations / sampleCounter);
 }
 
 void Statistic::appendStatisticsToMessage(Message& report) const {
+	if (isWindowed() and not window.empty()) {
+		appendWindowStatisticsToMessage(report);
+		return;
+	}
+
 	report.appendFloat(static_cast<float>(max));
 	report.append(timeOfMaxValue);
 	report.appendFloat(static_cast<float>(min));
@@ -25,14 +172,62 @@ void Statistic::appendStatisticsToMessage(Message& report) const {
 	report.appendFloat(static_cast<float>(mean));
 
 	if constexpr (SupportsStandardDeviation) {
-		double standardDeviation = 0;
-		if (sampleCounter == 0) {
-			standardDeviation = 0;
-		} else {
-			const double meanOfSquares = sumOfSquares / sampleCounter;
-			standardDeviation = sqrt(abs(meanOfSquares - pow(mean, 2))); // NOLINT(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions
+		report.appendFloat(static_cast<float>(standardDeviation()));
+	}
+
+	if constexpr (SupportsQuantiles) {
+		for (const double quantile: ECSSStatisticsReportedQuantiles) {
+			report.appendFloat(static_cast<float>(quantiles.quantile(quantile)));
+		}
+	}
+}
+
+void Statistic::appendWindowStatisticsToMessage(Message& report) const {
+	report.appendFloat(static_cast<float>(window.max()));
+	report.append(window.timeOfMax());
+	report.appendFloat(static_cast<float>(window.min()));
+	report.append(window.timeOfMin());
+	report.appendFloat(static_cast<float>(window.mean()));
+
+	if constexpr (SupportsStandardDeviation) {
+		report.appendFloat(static_cast<float>(window.standardDeviation()));
+	}
+
+	if constexpr (SupportsQuantiles) {
+		// Sketches cannot forget samples, so the quantiles of the window are evaluated from its samples
+		QuantileSketch<ECSSStatisticsQuantileBuckets> windowQuantiles(ECSSStatisticsQuantileRelativeAccuracy);
+		window.forEach([&windowQuantiles](double value) {
+			windowQuantiles.add(value);
+		});
+		for (const double quantile: ECSSStatisticsReportedQuantiles) {
+			report.appendFloat(static_cast<float>(windowQuantiles.quantile(quantile)));
 		}
-		report.appendFloat(static_cast<float>(standardDeviation));
+	}
+}
+
+bool Statistic::setWindowLength(std::chrono::milliseconds length) {
+	if (not windowFits(length, selfSamplingInterval)) {
+		return false;
+	}
+	windowLength = length;
+	resetStatistics();
+	return true;
+}
+
+bool Statistic::windowFits(std::chrono::milliseconds length, SamplingInterval samplingInterval) {
+	if (length.count() == 0) {
+		return true;
+	}
+	if (length.count() < 0 or samplingInterval == 0) {
+		return false;
+	}
+	const auto samplesInWindow = static_cast<uint64_t>(length.count()) / samplingInterval + 1;
+	return samplesInWindow <= decltype(window)::capacity();
+}
+
+void Statistic::expireWindow(const Time::DefaultCUC& currentTime) {
+	if (isWindowed()) {
+		window.expire(currentTime - windowLength);
 	}
 }
 
@@ -46,12 +241,15 @@ void Statistic::resetStatistics() {
 	timeOfMaxValue = Time::DefaultCUC(0);
 	timeOfMinValue = Time::DefaultCUC(0);
 	mean = 0;
-	sumOfSquares = 0;
+	sumOfSquaredDeviations = 0;
 	sampleCounter = 0;
+	quantiles.reset();
+	window.clear();
 }
 
 bool Statistic::statisticsAreInitialized() const {
-	return (sampleCounter == 0 and mean == 0 and sumOfSquares == 0 and
+	return (sampleCounter == 0 and mean == 0 and sumOfSquaredDeviations == 0 and
 	        timeOfMaxValue == Time::DefaultCUC(0) and timeOfMinValue == Time::DefaultCUC(0) and
-	        max == -std::numeric_limits<double>::infinity() and min == std::numeric_limits<double>::infinity());
+	        max == -std::numeric_limits<double>::infinity() and min == std::numeric_limits<double>::infinity() and
+	        quantiles.count() == 0 and window.empty());
 }
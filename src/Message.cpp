@@ -5,6 +5,35 @@
 #include "ServicePool.hpp"
 #include "macros.hpp"
 
+Message::Message() = default;
+
+Message::Message(const Message& message) {
+	*this = message;
+}
+
+Message& Message::operator=(const Message& message) {
+	if (this == &message) {
+		return *this;
+	}
+
+	serviceType = message.serviceType;
+	messageType = message.messageType;
+	packetType = message.packetType;
+	applicationId = message.applicationId;
+	sourceId = message.sourceId;
+	acknowledgementFlags = message.acknowledgementFlags;
+	messageTypeCounter = message.messageTypeCounter;
+	packetSequenceCount = message.packetSequenceCount;
+	dataSize = message.dataSize;
+	currentBit = message.currentBit;
+	readPosition = message.readPosition;
+
+	// A byte that is being filled by appendBits() is not counted in dataSize yet
+	const uint16_t usedBytes = ((currentBit != 0) and (dataSize < ECSSMaxMessageSize)) ? (dataSize + 1) : dataSize;
+	std::copy(message.data.begin(), message.data.begin() + usedBytes, data.begin());
+
+	return *this;
+}
 
 Message::Message(ServiceTypeNum serviceType, MessageTypeNum messageType, PacketType packetType, ApplicationProcessId applicationId)
     : serviceType(serviceType), messageType(messageType), packetType(packetType), applicationId(applicationId) {}
@@ -25,6 +54,11 @@ void Message::appendBits(uint8_t numBits, uint16_t data) {
 			return;
 		}
 
+		if (currentBit == 0) {
+			// The data are not initialized, so the byte is cleared before its bits are ORed
+			this->data[dataSize] = 0;
+		}
+
 		if ((currentBit + numBits) >= 8) { // NOLINT(cppcoreguidelines-avoid-magic-numbers)
 			// Will have to shift the bits and insert the next ones later
 			auto bitsToAddNow = static_cast<uint8_t>(8 - currentBit); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
@@ -110,14 +144,14 @@ uint16_t Message::readBits(uint8_t numBits) {
 		return 0;
 	}
 
+	// TODO(#59): Proper error handling if assert fails
+	if (not ASSERT_REQUEST((readPosition * 8U + currentBit + numBits) <= dataSize * 8U, ErrorHandler::MessageTooShort)) { // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+		return 0;
+	}
+
 	uint16_t value = 0x0;
 
 	while (numBits > 0) {
-		// TODO(#59): Proper error handling if assert fails
-		if (not ASSERT_REQUEST(readPosition < ECSSMaxMessageSize, ErrorHandler::MessageTooShort)) {
-			return 0;
-		}
-
 		if ((currentBit + numBits) >= 8) { // NOLINT(cppcoreguidelines-avoid-magic-numbers)
 			auto bitsToAddNow = static_cast<uint8_t>(8 - currentBit); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
 
@@ -140,7 +174,7 @@ uint16_t Message::readBits(uint8_t numBits) {
 
 uint8_t Message::readByte() {
 	// TODO(#59): Proper error handling if assert fails
-	if (not ASSERT_REQUEST(readPosition < ECSSMaxMessageSize, ErrorHandler::MessageTooShort)) {
+	if (not ASSERT_REQUEST(readPosition < dataSize, ErrorHandler::MessageTooShort)) {
 		return 0;
 	}
 
@@ -152,7 +186,7 @@ uint8_t Message::readByte() {
 
 uint16_t Message::readHalfword() {
 	// TODO(#59): Proper error handling if assert fails
-	if (not ASSERT_REQUEST((readPosition + 2) <= ECSSMaxMessageSize, ErrorHandler::MessageTooShort)) {
+	if (not ASSERT_REQUEST((readPosition + 2) <= dataSize, ErrorHandler::MessageTooShort)) {
 		return 0;
 	}
 
@@ -164,7 +198,7 @@ uint16_t Message::readHalfword() {
 
 uint32_t Message::readWord() {
 	// TODO(#59): Proper error handling if assert fails
-	if (not ASSERT_REQUEST((readPosition + 4) <= ECSSMaxMessageSize, ErrorHandler::MessageTooShort)) {
+	if (not ASSERT_REQUEST((readPosition + 4) <= dataSize, ErrorHandler::MessageTooShort)) {
 		return 0;
 	}
 
@@ -177,7 +211,7 @@ uint32_t Message::readWord() {
 
 void Message::readString(char* string, uint16_t size) {
 	// TODO(#59): Proper error handling if assert fails
-	if (not ASSERT_REQUEST((readPosition + size) <= ECSSMaxMessageSize, ErrorHandler::MessageTooShort)) {
+	if (not ASSERT_REQUEST((readPosition + size) <= dataSize, ErrorHandler::MessageTooShort)) {
 		return;
 	}
 	if (not ASSERT_REQUEST(size < ECSSMaxStringSize, ErrorHandler::StringTooShort)) {
@@ -189,7 +223,7 @@ void Message::readString(char* string, uint16_t size) {
 
 void Message::readString(uint8_t* string, uint16_t size) {
 	// TODO(#59): Proper error handling if assert fails
-	if (not ASSERT_REQUEST((readPosition + size) <= ECSSMaxMessageSize, ErrorHandler::MessageTooShort)) {
+	if (not ASSERT_REQUEST((readPosition + size) <= dataSize, ErrorHandler::MessageTooShort)) {
 		return;
 	}
 	if (not ASSERT_REQUEST(size < ECSSMaxStringSize, ErrorHandler::StringTooShort)) {
@@ -213,6 +247,32 @@ void Message::appendMessage(const Message& message, uint16_t size) {
 	appendString(MessageParser::composeECSS(message, size));
 }
 
+void Message::appendPacket(const Message& message) {
+	appendString(MessageParser::compose(message));
+}
+
+void Message::appendPacket(etl::span<const uint8_t> packet) {
+	// TODO(#59): Proper error handling if assert fails
+	if (not ASSERT_INTERNAL(dataSize + packet.size() <= ECSSMaxMessageSize, ErrorHandler::MessageTooLarge)) {
+		return;
+	}
+	std::copy(packet.begin(), packet.end(), data.begin() + dataSize);
+	dataSize += packet.size();
+}
+
+etl::span<const uint8_t> Message::readPacket() {
+	const uint16_t availableLength = (dataSize > readPosition) ? (dataSize - readPosition) : 0;
+	const uint16_t length = MessageParser::packetLength(data.data() + readPosition, availableLength);
+	// TODO(#59): Proper error handling if assert fails
+	if (not ASSERT_REQUEST(length != 0, ErrorHandler::MessageTooShort)) {
+		return {};
+	}
+
+	const etl::span<const uint8_t> packet(data.data() + readPosition, length);
+	readPosition += length;
+	return packet;
+}
+
 void Message::appendString(const etl::istring& string) {
 	// TODO(#59): Proper error handling if assert fails
 	if (not ASSERT_INTERNAL(dataSize + string.size() <= ECSSMaxMessageSize, ErrorHandler::MessageTooLarge)) {
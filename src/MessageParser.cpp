@@ -144,6 +144,7 @@ void MessageParser::parseECSSTCHeader(const uint8_t* data, uint16_t length, Mess
 
 	// Individual fields of the TC header
 	uint8_t const pusVersion = data[0] >> 4;
+	uint8_t const acknowledgementFlags = data[0] & 0x0fU;
 	ServiceTypeNum const serviceType = data[1];
 	MessageTypeNum const messageType = data[2];
 	SourceId const sourceId = (data[3] << 8) + data[4];
@@ -157,6 +158,7 @@ void MessageParser::parseECSSTCHeader(const uint8_t* data, uint16_t length, Mess
 	message.serviceType = serviceType;
 	message.messageType = messageType;
 	message.sourceId = sourceId;
+	message.acknowledgementFlags = acknowledgementFlags;
 	std::copy(data + ECSSSecondaryTCHeaderSize, data + ECSSSecondaryTCHeaderSize + length, message.data.begin());
 	message.dataSize = length;
 }
@@ -176,13 +178,41 @@ Message MessageParser::parseECSSTC(const uint8_t* data) {
 	return message;
 }
 
+uint16_t MessageParser::packetLength(const uint8_t* data, uint16_t availableLength) {
+	if (availableLength < CCSDSPrimaryHeaderSize) {
+		return 0;
+	}
+
+	uint16_t const packetDataLength = (data[4] << 8) | data[5];
+	uint32_t const length = CCSDSPrimaryHeaderSize + packetDataLength + 1U + (CRCHelper::EnableCRC ? CRCField : 0U);
+	return (length <= availableLength) ? static_cast<uint16_t>(length) : 0U;
+}
+
+Message MessageParser::parseEmbeddedTC(const uint8_t* data, uint16_t length) {
+	Message message;
+	// TODO(#59): Proper error handling if assert fails
+	if (not ASSERT_INTERNAL(length >= CCSDSPrimaryHeaderSize + ECSSSecondaryTCHeaderSize, ErrorHandler::UnacceptablePacket)) {
+		return message;
+	}
+
+	uint16_t const packetHeaderIdentification = (data[0] << 8) | data[1];
+	uint16_t const packetSequenceControl = (data[2] << 8) | data[3];
+	uint16_t const packetDataLength = (data[4] << 8) | data[5];
+
+	message.packetType = Message::TC;
+	message.applicationId = packetHeaderIdentification & static_cast<ApplicationProcessId>(0x07ff);
+	message.packetSequenceCount = packetSequenceControl & (~0xc000U); // keep last 14 bits
+	parseECSSTCHeader(data + CCSDSPrimaryHeaderSize, packetDataLength + 1, message);
+	return message;
+}
+
 String<CCSDSMaxMessageSize> MessageParser::composeECSS(const Message& message, uint16_t size) {
 	// Unfortunately to avoid using VLAs, we will create an array with the maximum size.
 	etl::array<uint8_t, ECSSSecondaryTMHeaderSize> header = {};
 
 	if (message.packetType == Message::TC) {
 		header[0] = ECSSPUSVersion << 4U; // Assign the pusVersion = 2
-		header[0] |= 0x00;                //ack flags
+		header[0] |= message.acknowledgementFlags & 0x0fU;
 		header[1] = message.serviceType;
 		header[2] = message.messageType;
 		header[3] = message.applicationId >> 8U;
@@ -1,6 +1,8 @@
 #include "Service.hpp"
+#include <ECSS_Configuration.hpp>
 #include <Logger.hpp>
 #include <MessageParser.hpp>
+#include <ServicePool.hpp>
 #include <iomanip>
 #include <iostream>
 #ifdef _MSC_VER
@@ -54,6 +56,15 @@ PacketSender packetSender;
 inline constexpr bool SendToYamcs = true;
 
 void Service::storeMessage(Message& message) {
+#ifdef SERVICE_REALTIMEFORWARDINGCONTROL
+	// Reports that are not forwarded to the ground in real time are dropped before they are composed. This is the only
+	// egress of this platform, so they are not kept anywhere else. A platform that also records reports in ST[15]
+	// packet stores has to do so before this check, so that the ST[14] filters do not apply to them.
+	if (not Services.realTimeForwarding.isForwarded(message)) {
+		return;
+	}
+#endif
+
 	// appends the remaining bits to complete a byte
 	message.finalize();
 
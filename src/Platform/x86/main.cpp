@@ -2,6 +2,9 @@
 #include <Platform/x86/Helpers/UTCTimestamp.hpp>
 #include <Time/UTCTimestamp.hpp>
 #include <ctime>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #include <iostream>
 #include <filesystem>
 #include "ErrorHandler.hpp"
@@ -72,6 +75,7 @@ int main() {
 	sentPacket2.appendUint32(45823);               // settings for 2nd parameter
 
 	paramService.setParameters(sentPacket2);
+	sentPacket.resetRead();
 	paramService.reportParameters(sentPacket);
 
 	// ST[06] testing
@@ -129,6 +133,7 @@ int main() {
 	Message receivedMessage =
 	    Message(RequestVerificationService::ServiceType,
 	            RequestVerificationService::MessageType::SuccessfulAcceptanceReport, Message::TC, 3);
+	receivedMessage.acknowledgementFlags = Message::AcknowledgeAll;
 	reqVerifService.successAcceptanceVerification(receivedMessage);
 
 	receivedMessage = Message(RequestVerificationService::ServiceType,
@@ -137,6 +142,7 @@ int main() {
 
 	receivedMessage = Message(RequestVerificationService::ServiceType,
 	                          RequestVerificationService::MessageType::SuccessfulStartOfExecution, Message::TC, 3);
+	receivedMessage.acknowledgementFlags = Message::AcknowledgeAll;
 	reqVerifService.successStartExecutionVerification(receivedMessage);
 
 	receivedMessage = Message(RequestVerificationService::ServiceType,
@@ -145,6 +151,7 @@ int main() {
 
 	receivedMessage = Message(RequestVerificationService::ServiceType,
 	                          RequestVerificationService::MessageType::SuccessfulProgressOfExecution, Message::TC, 3);
+	receivedMessage.acknowledgementFlags = Message::AcknowledgeAll;
 	reqVerifService.successProgressExecutionVerification(receivedMessage, 0);
 
 	receivedMessage = Message(RequestVerificationService::ServiceType,
@@ -153,6 +160,7 @@ int main() {
 
 	receivedMessage = Message(RequestVerificationService::ServiceType,
 	                          RequestVerificationService::MessageType::SuccessfulCompletionOfExecution, Message::TC, 3);
+	receivedMessage.acknowledgementFlags = Message::AcknowledgeAll;
 	reqVerifService.successCompletionExecutionVerification(receivedMessage);
 
 	receivedMessage = Message(RequestVerificationService::ServiceType,
@@ -213,8 +221,8 @@ int main() {
 	eventActionDefinition.appendEnum16(0);
 	eventActionDefinition.append<ApplicationProcessId>(2);
 	eventActionDefinition.append<EventDefinitionId>(1);
-	String<64> TCdata = "0123456789123456789123456789123456789123456789123456789123456789";
-	eventActionDefinition.appendString(TCdata);
+	Message actionRequest(17, 1, Message::TC, 1);
+	eventActionDefinition.appendPacket(actionRequest);
 	eventActionService.addEventActionDefinitions(eventActionDefinition);
 
 	Message eventActionDefinition1(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction,
@@ -222,8 +230,7 @@ int main() {
 	eventActionDefinition1.appendEnum16(0);
 	eventActionDefinition1.append<ApplicationProcessId>(2);
 	eventActionDefinition1.append<EventDefinitionId>(1);
-	TCdata = "hi1";
-	eventActionDefinition1.appendString(TCdata);
+	eventActionDefinition1.appendPacket(actionRequest);
 	std::cout << "After this message there should be a failed start of execution error \n";
 	eventActionService.addEventActionDefinitions(eventActionDefinition1);
 
@@ -232,8 +239,7 @@ int main() {
 	eventActionDefinition2.appendEnum16(0);
 	eventActionDefinition2.append<ApplicationProcessId>(4);
 	eventActionDefinition2.append<EventDefinitionId>(2);
-	TCdata = "hi2";
-	eventActionDefinition2.appendString(TCdata);
+	eventActionDefinition2.appendPacket(actionRequest);
 	eventActionService.addEventActionDefinitions(eventActionDefinition2);
 
 	Message eventActionDefinition7(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction,
@@ -241,8 +247,7 @@ int main() {
 	eventActionDefinition7.appendEnum16(0);
 	eventActionDefinition7.append<ApplicationProcessId>(4);
 	eventActionDefinition7.append<EventDefinitionId>(4);
-	TCdata = "hi2";
-	eventActionDefinition7.appendString(TCdata);
+	eventActionDefinition7.appendPacket(actionRequest);
 	eventActionService.addEventActionDefinitions(eventActionDefinition7);
 
 	std::cout << "Status should be 000:";
@@ -323,6 +328,19 @@ int main() {
 	std::cout << "\n\nST[11] service is running";
 	std::cout << "\nCurrent time in seconds (UNIX epoch): " << currentTime.asTAIseconds() << std::endl;
 
+	// Keep a journal of the schedule in a memory-mapped file. A real deployment would keep the file across restarts,
+	// so that attaching it restores the schedule.
+	constexpr size_t JournalSize = 64 * 1024;
+	const std::string journalPath = (std::filesystem::temp_directory_path() / "st11_journal").string();
+	const int journalFile = open(journalPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	void* journalRegion = MAP_FAILED;
+	if (journalFile >= 0 and ftruncate(journalFile, JournalSize) == 0) {
+		journalRegion = mmap(nullptr, JournalSize, PROT_READ | PROT_WRITE, MAP_SHARED, journalFile, 0);
+	}
+	if (journalRegion != MAP_FAILED) {
+		timeBasedSchedulingService.attachJournal(etl::span<uint8_t>(static_cast<uint8_t*>(journalRegion), JournalSize));
+	}
+
 	Message receivedMsg =
 	    Message(TimeBasedSchedulingService::ServiceType,
 	            TimeBasedSchedulingService::MessageType::EnableTimeBasedScheduleExecutionFunction, Message::TC, 1);
@@ -336,19 +354,22 @@ int main() {
 	// Insert activities in the schedule
 	receivedMsg = Message(TimeBasedSchedulingService::ServiceType,
 	                      TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
-	receivedMsg.appendUint16(2); // Total number of requests
+	receivedMsg.append<SubScheduleId>(0); // Sub-schedule of the activities
+	receivedMsg.appendUint16(2);          // Total number of requests
 
+	receivedMsg.append<SchedulingGroupId>(TimeBasedSchedulingService::DefaultGroup);
 	receivedMsg.append<Time::DefaultCUC>(Time::DefaultCUC(currentTime.asTAIseconds() + 1556435U));
-	receivedMsg.appendString(MessageParser::composeECSS(testMessage1));
+	receivedMsg.appendPacket(testMessage1);
 
+	receivedMsg.append<SchedulingGroupId>(TimeBasedSchedulingService::DefaultGroup);
 	receivedMsg.append<Time::DefaultCUC>(Time::DefaultCUC(currentTime.asTAIseconds() + 1957232U));
-	receivedMsg.appendString(MessageParser::composeECSS(testMessage2));
+	receivedMsg.appendPacket(testMessage2);
 	timeBasedSchedulingService.insertActivities(receivedMsg);
 
 	// Time shift activities
 	receivedMsg = Message(TimeBasedSchedulingService::ServiceType,
 	                      TimeBasedSchedulingService::MessageType::TimeShiftALlScheduledActivities, Message::TC, 1);
-	receivedMsg.appendSint32(-6789);
+	receivedMsg.appendRelativeTime(-6789);
 	timeBasedSchedulingService.timeShiftAllActivities(receivedMsg);
 	std::cout << "Activities should be time shifted by: " << -6789 << " seconds." << std::endl;
 
@@ -360,8 +381,20 @@ int main() {
 	// Report the activities by ID
 	receivedMsg = Message(TimeBasedSchedulingService::ServiceType,
 	                      TimeBasedSchedulingService::MessageType::ActivitiesSummaryReportById, Message::TC, 1);
+	receivedMsg.appendUint16(1); // Number of requested IDs
+	receivedMsg.append<SourceId>(testMessage1.sourceId);
+	receivedMsg.append<ApplicationProcessId>(testMessage1.applicationId);
+	receivedMsg.append<SequenceCount>(testMessage1.packetSequenceCount);
 	timeBasedSchedulingService.summaryReportActivitiesByID(receivedMsg);
 
+	timeBasedSchedulingService.detachJournal();
+	if (journalRegion != MAP_FAILED) {
+		munmap(journalRegion, JournalSize);
+	}
+	if (journalFile >= 0) {
+		close(journalFile);
+	}
+
 	//ST[23]
 	namespace fs = std::filesystem;
 	FileManagementService& fileManagementService = Services.fileManagement;
@@ -389,6 +422,8 @@ int main() {
 	String<ECSSTCRequestStringSize> file = "created_file";
 	createFileMessage.appendOctetString(fullPathToDirectory);
 	createFileMessage.appendOctetString(file);
+	createFileMessage.appendUint32(100); // Maximum file size in bytes
+	createFileMessage.appendBoolean(false); // The file is not locked
 	MessageParser::execute(createFileMessage);
 	std::cout << "Created file.\n";
 	std::cout << "fs::exists(\"st23/created_directory/created_file\") -> " << fs::exists("st23/created_directory/created_file") << "\n";
@@ -1,13 +1,85 @@
 #include "ECSS_Configuration.hpp"
 #ifdef SERVICE_EVENTACTION
 
+#include "Helpers/CRCHelper.hpp"
 #include "Message.hpp"
 #include "MessageParser.hpp"
 #include "Services/EventActionService.hpp"
 
-EventActionService::EventActionDefinition::EventActionDefinition(ApplicationProcessId applicationID, EventDefinitionId eventDefinitionID, Message& message)
-    : applicationID(applicationID), eventDefinitionID(eventDefinitionID), request(message.data.begin() + message.readPosition) {
-	message.readPosition += ECSSTCRequestStringSize;
+EventActionService::EventActionDefinition::EventActionDefinition(ApplicationProcessId applicationID, EventDefinitionId eventDefinitionID, const ParsedRequest& request)
+    : applicationID(applicationID), eventDefinitionID(eventDefinitionID), request(request) {}
+
+void EventActionService::eraseDefinition(EventActionDefinitionMap::iterator definition) {
+	requests.release(definition->second.request.data);
+	eventActionDefinitionMap.erase(definition);
+}
+
+bool EventActionService::parseRequest(const Message& message, etl::span<const uint8_t> packet, ParsedRequest& request) {
+	const uint8_t* bytes = packet.data();
+	if (packet.size() < CCSDSPrimaryHeaderSize + ECSSSecondaryTCHeaderSize) {
+		ErrorHandler::reportError(message, ErrorHandler::InvalidEventActionRequest);
+		return false;
+	}
+
+	const uint16_t packetHeaderIdentification = (bytes[0] << 8) | bytes[1];
+	const uint16_t packetSequenceControl = (bytes[2] << 8) | bytes[3];
+	const uint16_t packetDataLength = (bytes[4] << 8) | bytes[5];
+	const uint8_t* secondaryHeader = bytes + CCSDSPrimaryHeaderSize;
+	const bool isTelecommand = (bytes[0] & 0x10U) != 0;
+	const uint8_t pusVersion = secondaryHeader[0] >> 4U;
+	const uint32_t dataSize = packetDataLength + 1U - ECSSSecondaryTCHeaderSize;
+
+	if (not isTelecommand or pusVersion != ECSSPUSVersion or packetDataLength + 1U < ECSSSecondaryTCHeaderSize or
+	    CCSDSPrimaryHeaderSize + ECSSSecondaryTCHeaderSize + dataSize > packet.size() or dataSize > ECSSMaxMessageSize) {
+		ErrorHandler::reportError(message, ErrorHandler::InvalidEventActionRequest);
+		return false;
+	}
+	if constexpr (CRCHelper::EnableCRC) {
+		const uint16_t packetLength = MessageParser::packetLength(bytes, packet.size());
+		if (packetLength == 0 or CRCHelper::validateCRC(bytes, packetLength) != 0) {
+			ErrorHandler::reportError(message, ErrorHandler::InvalidEventActionRequest);
+			return false;
+		}
+	}
+
+	request.serviceType = secondaryHeader[1];
+	request.messageType = secondaryHeader[2];
+	request.sourceID = (secondaryHeader[3] << 8) | secondaryHeader[4];
+	request.acknowledgementFlags = secondaryHeader[0] & 0x0fU;
+	request.applicationID = packetHeaderIdentification & static_cast<ApplicationProcessId>(0x07ff);
+	request.sequenceCount = packetSequenceControl & (~0xc000U);
+	request.dataSize = dataSize;
+	request.data = SlotHandle();
+	if (dataSize != 0) {
+		request.data = requests.store(secondaryHeader + ECSSSecondaryTCHeaderSize, dataSize);
+		if (not request.data.isValid()) {
+			ErrorHandler::reportError(message, ErrorHandler::TelecommandStorageIsFull);
+			return false;
+		}
+	}
+	return true;
+}
+
+Message EventActionService::buildRequest(const ParsedRequest& request) const {
+	Message message(request.serviceType, request.messageType, Message::TC, request.applicationID);
+	message.sourceId = request.sourceID;
+	message.acknowledgementFlags = request.acknowledgementFlags;
+	message.packetSequenceCount = request.sequenceCount;
+	const etl::span<const uint8_t> data = requests.get(request.data);
+	std::copy(data.begin(), data.end(), message.data.begin());
+	message.dataSize = data.size();
+	return message;
+}
+
+void EventActionService::updateEnabledActions() {
+	enabledActions.clear();
+	// The map is ordered by event definition ID, so the enabled actions are added in order
+	for (const auto& element: eventActionDefinitionMap) {
+		if (element.second.enabled) {
+			enabledActions.push_back({element.first, element.second.request});
+		}
+	}
+	enabledActionsVersion++;
 }
 
 void EventActionService::addEventActionDefinitions(Message& message) {
@@ -18,29 +90,35 @@ void EventActionService::addEventActionDefinitions(Message& message) {
 	while (numberOfEventActionDefinitions-- != 0) {
 		const ApplicationProcessId applicationID = message.read<ApplicationProcessId>();
 		EventDefinitionId eventDefinitionID = message.read<EventDefinitionId>();
+		const etl::span<const uint8_t> packet = message.readPacket();
+		if (packet.empty()) {
+			return;
+		}
 		bool canBeAdded = true; // NOLINT(misc-const-correctness)
 
-		auto it = std::find_if(eventActionDefinitionMap.begin(), eventActionDefinitionMap.end(), [&](const auto& element) {
-			if (element.first == eventDefinitionID) {
-				if (element.second.enabled) {
-					canBeAdded = false;
-					ErrorHandler::reportError(message, ErrorHandler::EventActionEnabledError);
-				} else {
-					eventActionDefinitionMap.erase(eventDefinitionID);
-				}
-				return true;
+		auto it = eventActionDefinitionMap.find(eventDefinitionID);
+		if (it != eventActionDefinitionMap.end()) {
+			if (it->second.enabled) {
+				canBeAdded = false;
+				ErrorHandler::reportError(message, ErrorHandler::EventActionEnabledError);
+			} else {
+				eraseDefinition(it);
 			}
-			return false;
-		});
+		}
 		if (canBeAdded) {
 			if (eventActionDefinitionMap.size() == ECSSEventActionStructMapSize) {
 				ErrorHandler::reportError(message, ErrorHandler::EventActionDefinitionsMapIsFull);
 				continue;
 			}
-			const EventActionDefinition temporaryEventActionDefinition(applicationID, eventDefinitionID, message);
+			ParsedRequest request;
+			if (not parseRequest(message, packet, request)) {
+				continue;
+			}
+			const EventActionDefinition temporaryEventActionDefinition(applicationID, eventDefinitionID, request);
 			eventActionDefinitionMap.insert(std::make_pair(eventDefinitionID, temporaryEventActionDefinition));
 		}
 	}
+	updateEnabledActions();
 }
 
 void EventActionService::deleteEventActionDefinitions(Message& message) {
@@ -62,7 +140,7 @@ void EventActionService::deleteEventActionDefinitions(Message& message) {
 				} else if (element.second.enabled) {
 					ErrorHandler::reportError(message, ErrorHandler::EventActionDeleteEnabledDefinitionError);
 				} else {
-					eventActionDefinitionMap.erase(eventActionDefinitionMap.find(eventDefinitionID));
+					eraseDefinition(eventActionDefinitionMap.find(eventDefinitionID));
 				}
 				return true;
 			}
@@ -72,6 +150,7 @@ void EventActionService::deleteEventActionDefinitions(Message& message) {
 			ErrorHandler::reportError(message, ErrorHandler::EventActionUnknownEventActionDefinitionError);
 		}
 	}
+	updateEnabledActions();
 }
 
 void EventActionService::deleteAllEventActionDefinitions(const Message& message) {
@@ -79,7 +158,7 @@ void EventActionService::deleteAllEventActionDefinitions(const Message& message)
 		return;
 	}
 	setEventActionFunctionStatus(false);
-	eventActionDefinitionMap.clear();
+	clearDefinitions();
 }
 
 void EventActionService::enableEventActionDefinitions(Message& message) {
@@ -114,6 +193,7 @@ void EventActionService::enableEventActionDefinitions(Message& message) {
 			element.second.enabled = true;
 		}
 	}
+	updateEnabledActions();
 }
 
 void EventActionService::disableEventActionDefinitions(Message& message) {
@@ -148,6 +228,7 @@ void EventActionService::disableEventActionDefinitions(Message& message) {
 			element.second.enabled = false;
 		}
 	}
+	updateEnabledActions();
 }
 
 void EventActionService::requestEventActionDefinitionStatus(const Message& message) {
@@ -183,16 +264,73 @@ void EventActionService::disableEventActionFunction(const Message& message) {
 	setEventActionFunctionStatus(false);
 }
 
-void EventActionService::executeAction(EventDefinitionId eventDefinitionID) { // NOLINT (readability-make-member-function-const)
-	if (eventActionFunctionStatus) {
-		auto range = eventActionDefinitionMap.equal_range(eventDefinitionID);
-		for (auto& element = range.first; element != range.second; ++element) {
-			if (element->second.enabled) {
-				Message message = MessageParser::parseECSSTC(element->second.request);
-				MessageParser::execute(message);
-			}
+size_t EventActionService::findEnabledActions(EventDefinitionId eventDefinitionID) const {
+	auto action = etl::lower_bound(enabledActions.begin(), enabledActions.end(), eventDefinitionID,
+	                               [](const EnabledAction& element, EventDefinitionId id) {
+		                               return element.eventDefinitionID < id;
+	                               });
+	return action - enabledActions.begin();
+}
+
+void EventActionService::executeAction(EventDefinitionId eventDefinitionID) {
+	if (not eventActionFunctionStatus) {
+		return;
+	}
+	const size_t position = findEnabledActions(eventDefinitionID);
+	if (position == enabledActions.size() or enabledActions[position].eventDefinitionID != eventDefinitionID) {
+		return;
+	}
+
+	PendingEvent event;
+	event.eventDefinitionID = eventDefinitionID;
+	if (dispatchedEvent != nullptr) {
+		if (dispatchedEvent->depth >= ECSSMaxEventActionCascadeDepth) {
+			cascadeDepthExceededCount++;
+			return;
+		}
+		event.depth = dispatchedEvent->depth + 1;
+		event.chain = dispatchedEvent->chain;
+		event.chain[dispatchedEvent->depth] = dispatchedEvent->eventDefinitionID;
+		const auto chainEnd = event.chain.begin() + event.depth;
+		if (etl::find(event.chain.begin(), chainEnd, eventDefinitionID) != chainEnd) {
+			cycleCount++;
+			return;
+		}
+	}
+	if (pendingEvents.full()) {
+		queueOverflowCount++;
+		return;
+	}
+	pendingEvents.push_back(event);
+}
+
+void EventActionService::dispatchActions(const PendingEvent& event) {
+	const uint32_t version = enabledActionsVersion;
+	// The actions are dispatched by position, since an action may change the definitions and reallocate the index
+	for (size_t position = findEnabledActions(event.eventDefinitionID); position < enabledActions.size(); position++) {
+		if (enabledActions[position].eventDefinitionID != event.eventDefinitionID) {
+			break;
+		}
+		Message message = buildRequest(enabledActions[position].request);
+		MessageParser::execute(message);
+		if (enabledActionsVersion != version) {
+			break;
+		}
+	}
+}
+
+size_t EventActionService::executePendingActions() {
+	for (uint8_t dispatches = 0; dispatches < ECSSMaxEventActionDispatchesPerTick and not pendingEvents.empty(); dispatches++) {
+		const PendingEvent event = pendingEvents.front();
+		pendingEvents.pop_front();
+		if (not eventActionFunctionStatus) {
+			continue;
 		}
+		dispatchedEvent = &event;
+		dispatchActions(event);
+		dispatchedEvent = nullptr;
 	}
+	return pendingEvents.size();
 }
 
 void EventActionService::execute(Message& message) {
@@ -6,9 +6,12 @@
 #include "Message.hpp"
 #include "ErrorHandler.hpp"
 #include "ServicePool.hpp"
+#include "Helpers/TimeGetter.hpp"
+#include "etl/algorithm.h"
+#include "etl/array.h"
 
 bool EventReportService::validateParameters(Event eventID) {
-	if (static_cast<EventDefinitionId>(eventID) > NumberOfEvents || static_cast<EventDefinitionId>(eventID) == 0) {
+	if (static_cast<EventDefinitionId>(eventID) >= NumberOfEvents || static_cast<EventDefinitionId>(eventID) == 0) {
 		ErrorHandler::reportInternalError(ErrorHandler::InternalErrorType::InvalidEventID);
 		return false;
 	}
@@ -31,12 +34,14 @@ void EventReportService::informativeEventReport(Event eventID, const String<ECSS
 		return;
 	}
 	if (enabledEvents[static_cast<EventDefinitionId>(eventID)]) {
-		Message report = createTM(EventReportService::MessageType::InformativeEventReport);
-		report.append<EventDefinitionId>(eventID);
-		report.appendString(data);
-		Services.eventAction.executeAction(eventID);
+		if (admitOccurrence(eventID)) {
+			Message report = createTM(EventReportService::MessageType::InformativeEventReport);
+			report.append<EventDefinitionId>(eventID);
+			report.appendString(data);
 
-		storeMessage(report);
+			storeMessage(report);
+		}
+		Services.eventAction.executeAction(eventID);
 	}
 }
 
@@ -47,14 +52,16 @@ void EventReportService::lowSeverityAnomalyReport(Event eventID, const String<EC
 	}
 	lowSeverityEventCount++;
 	if (enabledEvents[static_cast<EventDefinitionId>(eventID)]) {
-		lowSeverityReportCount++;
-		Message report = createTM(EventReportService::MessageType::LowSeverityAnomalyReport);
-		report.append<EventDefinitionId>(eventID);
-		report.appendString(data);
-		lastLowSeverityReportID = static_cast<EventDefinitionId>(eventID);
-		Services.eventAction.executeAction(eventID);
+		if (admitOccurrence(eventID)) {
+			lowSeverityReportCount++;
+			Message report = createTM(EventReportService::MessageType::LowSeverityAnomalyReport);
+			report.append<EventDefinitionId>(eventID);
+			report.appendString(data);
+			lastLowSeverityReportID = static_cast<EventDefinitionId>(eventID);
 
-		storeMessage(report);
+			storeMessage(report);
+		}
+		Services.eventAction.executeAction(eventID);
 	}
 }
 
@@ -65,14 +72,16 @@ void EventReportService::mediumSeverityAnomalyReport(Event eventID, const String
 	}
 	mediumSeverityEventCount++;
 	if (enabledEvents[static_cast<EventDefinitionId>(eventID)]) {
-		mediumSeverityReportCount++;
-		Message report = createTM(EventReportService::MessageType::MediumSeverityAnomalyReport);
-		report.append<EventDefinitionId>(eventID);
-		report.appendString(data);
-		lastMediumSeverityReportID = static_cast<EventDefinitionId>(eventID);
-		Services.eventAction.executeAction(eventID);
+		if (admitOccurrence(eventID)) {
+			mediumSeverityReportCount++;
+			Message report = createTM(EventReportService::MessageType::MediumSeverityAnomalyReport);
+			report.append<EventDefinitionId>(eventID);
+			report.appendString(data);
+			lastMediumSeverityReportID = static_cast<EventDefinitionId>(eventID);
 
-		storeMessage(report);
+			storeMessage(report);
+		}
+		Services.eventAction.executeAction(eventID);
 	}
 }
 
@@ -83,46 +92,184 @@ void EventReportService::highSeverityAnomalyReport(Event eventID, const String<E
 	}
 	highSeverityEventCount++;
 	if (enabledEvents[static_cast<EventDefinitionId>(eventID)]) {
-		highSeverityReportCount++;
-		Message report = createTM(EventReportService::MessageType::HighSeverityAnomalyReport);
-		report.append<EventDefinitionId>(eventID);
-		report.appendString(data);
-		lastHighSeverityReportID = static_cast<EventDefinitionId>(eventID);
-		Services.eventAction.executeAction(eventID);
+		if (admitOccurrence(eventID)) {
+			highSeverityReportCount++;
+			Message report = createTM(EventReportService::MessageType::HighSeverityAnomalyReport);
+			report.append<EventDefinitionId>(eventID);
+			report.appendString(data);
+			lastHighSeverityReportID = static_cast<EventDefinitionId>(eventID);
 
-		storeMessage(report);
+			storeMessage(report);
+		}
+		Services.eventAction.executeAction(eventID);
 	}
 }
 
-void EventReportService::enableReportGeneration(Message& message) {
-	if (!message.assertTC(ServiceType, MessageType::EnableReportGenerationOfEvents)) {
+void EventReportService::setReportGeneration(Message& message, bool enabled) {
+	uint16_t const tcNumberOfEvents = message.readUint16();
+	if (not isNumberOfEventsValid(tcNumberOfEvents)) {
 		return;
 	}
 
-	uint16_t const tcNumberOfEvents = message.readUint16();
-	if (not isNumberOfEventsValid(tcNumberOfEvents)) {
+	etl::array<EventDefinitionId, ECSSMaxMessageSize / sizeof(EventDefinitionId)> eventIDs = {};
+	const uint16_t numberOfIDs = etl::min<uint16_t>(tcNumberOfEvents, eventIDs.size());
+	uint32_t highestID = 0;
+	for (uint16_t i = 0; i < numberOfIDs; i++) {
+		eventIDs[i] = message.read<EventDefinitionId>();
+		highestID = etl::max<uint32_t>(highestID, eventIDs[i]);
+	}
+	const bool allIDsAreKnown = highestID < NumberOfEvents;
+
+	for (uint16_t i = 0; i < numberOfIDs; i++) {
+		if (not allIDsAreKnown and eventIDs[i] >= NumberOfEvents) {
+			ErrorHandler::reportError(message, ErrorHandler::UnknownEventDefinitionId);
+			continue;
+		}
+		if (not enabledEvents.set(eventIDs[i], enabled)) {
+			continue;
+		}
+		if (enabled) {
+			disabledEventsCount--;
+		} else {
+			disabledEventsCount++;
+		}
+	}
+}
+
+bool EventReportService::admitOccurrence(EventDefinitionId eventID) {
+	if (rateLimits.empty()) {
+		return true;
+	}
+	auto rateLimit = rateLimits.find(eventID);
+	if (rateLimit == rateLimits.end()) {
+		return true;
+	}
+
+	EventRateLimit& limit = rateLimit->second;
+	const Time::DefaultCUC now = TimeGetter::getCurrentTimeDefaultCUC();
+	const auto elapsed = etl::max(std::chrono::duration_cast<std::chrono::milliseconds>(now - limit.lastTime),
+	                              std::chrono::milliseconds(0));
+	bool admitted = false;
+	if (limit.type == RateLimitType::TokenBucket) {
+		if (limit.tokens < limit.burst) {
+			const auto refills = (limit.interval.count() == 0) ? limit.burst : elapsed / limit.interval;
+			if (refills > 0) {
+				limit.tokens = etl::min<uint32_t>(limit.burst, limit.tokens + refills);
+				limit.lastTime = (limit.tokens == limit.burst) ? now : limit.lastTime + limit.interval * refills;
+			}
+		}
+		admitted = limit.tokens > 0;
+		if (admitted) {
+			if (limit.tokens == limit.burst) {
+				// The bucket starts refilling only when its first token is taken
+				limit.lastTime = now;
+			}
+			limit.tokens--;
+		}
+	} else {
+		admitted = not limit.hasReported or elapsed >= limit.interval;
+		if (admitted) {
+			limit.lastTime = now;
+			limit.hasReported = true;
+		}
+	}
+
+	if (not admitted) {
+		limit.pendingSuppressions++;
+		limit.totalSuppressions++;
+		suppressedEventsCount++;
+		return false;
+	}
+	if (limit.pendingSuppressions != 0) {
+		Message summary = createTM(EventReportService::MessageType::SuppressedEventsSummaryReport);
+		summary.append<EventDefinitionId>(eventID);
+		summary.appendUint32(limit.pendingSuppressions);
+		storeMessage(summary);
+		limit.pendingSuppressions = 0;
+	}
+	return true;
+}
+
+bool EventReportService::setRateLimit(EventDefinitionId eventID, RateLimitType type, uint16_t burst,
+                                      std::chrono::milliseconds interval) {
+	if (type == RateLimitType::None) {
+		rateLimits.erase(eventID);
+		return true;
+	}
+	if (rateLimits.find(eventID) == rateLimits.end() and rateLimits.full()) {
+		return false;
+	}
+
+	EventRateLimit limit;
+	limit.type = type;
+	limit.burst = burst;
+	limit.interval = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::ceil<RateLimitTick>(interval));
+	limit.tokens = burst;
+	limit.lastTime = TimeGetter::getCurrentTimeDefaultCUC();
+	rateLimits[eventID] = limit;
+	return true;
+}
+
+void EventReportService::setEventRateLimits(Message& message) {
+	if (!message.assertTC(ServiceType, MessageType::SetEventRateLimits)) {
 		return;
 	}
-	for (uint16_t i = 0; i < tcNumberOfEvents; i++) {
-		enabledEvents[message.read<EventDefinitionId>()] = true;
+
+	uint16_t numberOfEvents = message.readUint16();
+	while (numberOfEvents-- != 0) {
+		const EventDefinitionId eventID = message.read<EventDefinitionId>();
+		const uint8_t type = message.readUint8();
+		const uint16_t burst = message.readUint16();
+		const uint32_t interval = message.readUint32();
+
+		if (eventID == 0 or eventID >= NumberOfEvents) {
+			ErrorHandler::reportError(message, ErrorHandler::UnknownEventDefinitionId);
+			continue;
+		}
+		if (type > static_cast<uint8_t>(RateLimitType::MinimumInterval) or
+		    (type == static_cast<uint8_t>(RateLimitType::TokenBucket) and burst == 0) or
+		    (interval % RateLimitIntervalResolution.count() != 0)) {
+			ErrorHandler::reportError(message, ErrorHandler::InvalidEventRateLimit);
+			continue;
+		}
+		if (not setRateLimit(eventID, static_cast<RateLimitType>(type), burst, std::chrono::milliseconds(interval))) {
+			ErrorHandler::reportError(message, ErrorHandler::EventRateLimitsAreFull);
+		}
 	}
-	disabledEventsCount = enabledEvents.size() - enabledEvents.count();
 }
 
-void EventReportService::disableReportGeneration(Message& message) {
-	if (!message.assertTC(ServiceType, MessageType::DisableReportGenerationOfEvents)) {
+void EventReportService::requestEventSuppressionStatistics(const Message& message) {
+	if (!message.assertTC(ServiceType, MessageType::ReportEventSuppressionStatistics)) {
 		return;
 	}
+	eventSuppressionStatisticsReport();
+}
 
-	uint16_t const tcNumberOfEvents = message.readUint16();
-	if (not isNumberOfEventsValid(tcNumberOfEvents)) {
+void EventReportService::eventSuppressionStatisticsReport() {
+	Message report = createTM(EventReportService::MessageType::EventSuppressionStatisticsReport);
+	report.appendUint32(suppressedEventsCount);
+	report.appendUint16(rateLimits.size());
+	for (const auto& [eventID, limit]: rateLimits) {
+		report.append<EventDefinitionId>(eventID);
+		report.appendUint8(static_cast<uint8_t>(limit.type));
+		report.appendUint32(limit.pendingSuppressions);
+		report.appendUint32(limit.totalSuppressions);
+	}
+	storeMessage(report);
+}
+
+void EventReportService::enableReportGeneration(Message& message) {
+	if (!message.assertTC(ServiceType, MessageType::EnableReportGenerationOfEvents)) {
 		return;
 	}
+	setReportGeneration(message, true);
+}
 
-	for (uint16_t i = 0; i < tcNumberOfEvents; i++) {
-		enabledEvents[message.read<EventDefinitionId>()] = false;
+void EventReportService::disableReportGeneration(Message& message) {
+	if (!message.assertTC(ServiceType, MessageType::DisableReportGenerationOfEvents)) {
+		return;
 	}
-	disabledEventsCount = enabledEvents.size() - enabledEvents.count();
+	setReportGeneration(message, false);
 }
 
 void EventReportService::requestListOfDisabledEvents(const Message& message) {
@@ -133,16 +280,22 @@ void EventReportService::requestListOfDisabledEvents(const Message& message) {
 }
 
 void EventReportService::listOfDisabledEventsReport() {
+	uint32_t remainingEvents = disabledEventsCount;
 	Message report = createTM(EventReportService::MessageType::DisabledListEventReport);
+	uint16_t eventsInReport = etl::min<uint32_t>(remainingEvents, MaxDisabledEventsPerReport);
+	report.appendHalfword(eventsInReport);
 
-	uint16_t const numberOfDisabledEvents =
-		enabledEvents.size() - enabledEvents.count(); // NOLINT(cppcoreguidelines-init-variables)
-	report.appendHalfword(numberOfDisabledEvents);
-	for (size_t i = 0; i < enabledEvents.size(); i++) {
-		if (not enabledEvents[i]) {
-			report.append<EventDefinitionId>(i);
+	enabledEvents.forEachReset([&](size_t eventID) {
+		if (eventsInReport == 0) {
+			storeMessage(report);
+			report = createTM(EventReportService::MessageType::DisabledListEventReport);
+			eventsInReport = etl::min<uint32_t>(remainingEvents, MaxDisabledEventsPerReport);
+			report.appendHalfword(eventsInReport);
 		}
-	}
+		report.append<EventDefinitionId>(eventID);
+		eventsInReport--;
+		remainingEvents--;
+	});
 
 	storeMessage(report);
 }
@@ -155,6 +308,10 @@ void EventReportService::execute(Message& message) {
 			break;
 		case ReportListOfDisabledEvents: requestListOfDisabledEvents(message);
 			break;
+		case SetEventRateLimits: setEventRateLimits(message);
+			break;
+		case ReportEventSuppressionStatistics: requestEventSuppressionStatistics(message);
+			break;
 		default: ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
 }
@@ -13,9 +13,6 @@ void FunctionManagementService::call(Message& msg) {
 	etl::array<uint8_t, ECSSFunctionNameLength> funcName = {0};
 	etl::array<uint8_t, ECSSFunctionMaxArgLength> funcArgs = {0};
 
-	msg.readString(funcName.data(), ECSSFunctionNameLength);
-	msg.readString(funcArgs.data(), ECSSFunctionMaxArgLength);
-
 	if (msg.dataSize > (ECSSFunctionNameLength + ECSSFunctionMaxArgLength)) {
 		ErrorHandler::reportError(msg,
 		                          ErrorHandler::ExecutionStartErrorType::UnknownExecutionStartError);
@@ -23,6 +20,13 @@ void FunctionManagementService::call(Message& msg) {
 		return;
 	}
 
+	msg.readString(funcName.data(), ECSSFunctionNameLength);
+	if (msg.readPosition != ECSSFunctionNameLength) {
+		return;
+	}
+	// Only the arguments that are present are read, and the rest are left zero
+	msg.readString(funcArgs.data(), msg.dataSize - msg.readPosition);
+
 	// locate the appropriate function pointer
 	String<ECSSFunctionNameLength> const name(funcName.data());
 	FunctionMap::iterator const iter = funcPtrIndex.find(name); // NOLINT(cppcoreguidelines-init-variables)
@@ -12,14 +12,19 @@ void OnBoardMonitoringService::enableParameterMonitoringDefinitions(Message& mes
 	uint16_t const numberOfPMONDefinitions = message.readUint16();
 	for (uint16_t i = 0; i < numberOfPMONDefinitions; i++) {
 		const ParameterId currentId = message.read<ParameterId>();
-		auto definition = parameterMonitoringList.find(currentId);
-		if (definition == parameterMonitoringList.end()) {
+		PMON* definition = findPMONDefinition(currentId);
+		if (definition == nullptr) {
 			ErrorHandler::reportError(
 			    message, ErrorHandler::ExecutionStartErrorType::GetNonExistingParameterMonitoringDefinition);
 			continue;
 		}
-		definition->second.get().repetitionNumber = 0;
-		definition->second.get().monitoringEnabled = true;
+		resetPMONCheckingStatus(currentId, *definition);
+		definition->monitoringEnabled = true;
+
+		const SlotHandle handle = parameterMonitoringHandles[currentId];
+		if (definitionSlotStates[handle.index].nextCheckTime != Time::DefaultCUC()) {
+			scheduleCheck(handle, Time::DefaultCUC());
+		}
 	}
 }
 
@@ -31,14 +36,14 @@ void OnBoardMonitoringService::disableParameterMonitoringDefinitions(Message& me
 	uint16_t const numberOfPMONDefinitions = message.readUint16();
 	for (uint16_t i = 0; i < numberOfPMONDefinitions; i++) {
 		const ParameterId currentId = message.read<ParameterId>();
-		auto definition = parameterMonitoringList.find(currentId);
-		if (definition == parameterMonitoringList.end()) {
+		PMON* definition = findPMONDefinition(currentId);
+		if (definition == nullptr) {
 			ErrorHandler::reportError(
 			    message, ErrorHandler::ExecutionStartErrorType::GetNonExistingParameterMonitoringDefinition);
 			continue;
 		}
-		definition->second.get().monitoringEnabled = false;
-		definition->second.get().checkingStatus = PMON::Unchecked;
+		definition->monitoringEnabled = false;
+		resetPMONCheckingStatus(currentId, *definition);
 	}
 }
 
@@ -59,7 +64,7 @@ void OnBoardMonitoringService::deleteAllParameterMonitoringDefinitions(const Mes
 		    ErrorHandler::ExecutionStartErrorType::InvalidRequestToDeleteAllParameterMonitoringDefinitions);
 		return;
 	}
-	parameterMonitoringList.clear();
+	clearParameterMonitoringList();
 }
 
 void OnBoardMonitoringService::addParameterMonitoringDefinitions(Message& message) {
@@ -70,6 +75,7 @@ void OnBoardMonitoringService::addParameterMonitoringDefinitions(Message& messag
 	for (uint16_t i = 0; i < numberOfIds; i++) {
 		ParameterId currentPMONId = message.read<ParameterId>();
 		ParameterId currentMonitoredParameterId = message.read<ParameterId>();
+		PMONMonitoringInterval currentMonitoringInterval = message.read<PMONMonitoringInterval>();
 		PMONRepetitionNumber currentPMONRepetitionNumber = message.read<PMONRepetitionNumber>();
 		uint16_t checkTypeValue = message.readEnum8();
 		auto currentCheckType = static_cast<PMON::CheckType>(checkTypeValue);
@@ -80,12 +86,17 @@ void OnBoardMonitoringService::addParameterMonitoringDefinitions(Message& messag
 			continue;
 		}
 
-		if (parameterMonitoringList.find(currentPMONId) != parameterMonitoringList.end()) {
+		if (currentPMONId >= ECSSPMONIdRange) {
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::PMONIdOutOfRange);
+			continue;
+		}
+
+		if (findPMONDefinition(currentPMONId) != nullptr) {
 			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::AddAlreadyExistingParameter);
 			continue;
 		}
 
-		if (parameterMonitoringList.full()) {
+		if (parameterMonitoringDefinitions.full()) {
 			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::ParameterMonitoringListIsFull);
 			continue;
 		}
@@ -105,6 +116,7 @@ void OnBoardMonitoringService::addParameterMonitoringDefinitions(Message& messag
 				                          lowLimit, belowLowLimitEventId, highLimit, aboveHighLimitEventId);
 				limitCheck.checkingStatus = PMON::Unchecked;
 				limitCheck.monitoringEnabled = false;
+				limitCheck.monitoringInterval = currentMonitoringInterval;
 				addPMONLimitCheck(currentPMONId, limitCheck);
 				break;
 			}
@@ -116,6 +128,7 @@ void OnBoardMonitoringService::addParameterMonitoringDefinitions(Message& messag
 				                                          expectedValue, mask, unexpectedValueEvent);
 				expectedValueCheck.checkingStatus = PMON::Unchecked;
 				expectedValueCheck.monitoringEnabled = false;
+				expectedValueCheck.monitoringInterval = currentMonitoringInterval;
 				addPMONExpectedValueCheck(currentPMONId, expectedValueCheck);
 				break;
 			}
@@ -134,6 +147,7 @@ void OnBoardMonitoringService::addParameterMonitoringDefinitions(Message& messag
 				                          numberOfConsecutiveDeltaChecks, lowDeltaThreshold, belowLowThresholdEventId, highDeltaThreshold, aboveHighThresholdEventId);
 				deltaCheck.checkingStatus = PMON::Unchecked;
 				deltaCheck.monitoringEnabled = false;
+				deltaCheck.monitoringInterval = currentMonitoringInterval;
 				addPMONDeltaCheck(currentPMONId, deltaCheck);
 				break;
 			}
@@ -147,17 +161,18 @@ void OnBoardMonitoringService::deleteParameterMonitoringDefinitions(Message& mes
 	for (uint16_t i = 0; i < numberOfIds; i++) {
 		ParameterId currentPMONId = message.read<ParameterId>();
 
-		if (parameterMonitoringList.find(currentPMONId) == parameterMonitoringList.end()) {
+		const PMON* definition = findPMONDefinition(currentPMONId);
+		if (definition == nullptr) {
 			ErrorHandler::reportError(message, ErrorHandler::InvalidRequestToDeleteParameterMonitoringDefinition);
 			continue;
 		}
 
-		if (getPMONDefinition(currentPMONId).get().monitoringEnabled) {
+		if (definition->monitoringEnabled or functionalMonitoringList.isPMONUsed(currentPMONId)) {
 			ErrorHandler::reportError(message, ErrorHandler::InvalidRequestToDeleteParameterMonitoringDefinition);
 			continue;
 		}
 
-		parameterMonitoringList.erase(currentPMONId);
+		removePMONDefinition(currentPMONId);
 	}
 }
 
@@ -169,27 +184,25 @@ void OnBoardMonitoringService::modifyParameterMonitoringDefinitions(Message& mes
 	for (uint16_t i = 0; i < numberOfIds; i++) {
 		ParameterId currentPMONId = message.read<ParameterId>();
 		ParameterId currentMonitoredParameterId = message.read<ParameterId>();
+		PMONMonitoringInterval currentMonitoringInterval = message.read<PMONMonitoringInterval>();
 		PMONRepetitionNumber currentPMONRepetitionNumber = message.read<PMONRepetitionNumber>();
 		uint16_t currentCheckType = message.readEnum8();
 
-		auto it = parameterMonitoringList.find(currentPMONId);
+		const PMON* pmon = findPMONDefinition(currentPMONId);
 
-		if (it == parameterMonitoringList.end()) {
+		if (pmon == nullptr) {
 			ErrorHandler::reportError(
 			    message, ErrorHandler::ExecutionStartErrorType::ModifyParameterNotInTheParameterMonitoringList);
 			return;
 		}
 
-		if (getPMONDefinition(currentPMONId).get().monitoredParameterId != currentMonitoredParameterId) {
+		if (pmon->monitoredParameterId != currentMonitoredParameterId) {
 			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::
 			                                       DifferentParameterMonitoringDefinitionAndMonitoredParameter);
 			return;
 		}
 
-		PMON& pmon = it->second.get();
-		pmon.repetitionCounter = 0;
-		pmon.repetitionNumber = currentPMONRepetitionNumber;
-		pmon.checkingStatus = PMON::Unchecked;
+		const bool monitoringEnabled = pmon->monitoringEnabled;
 
 		switch (static_cast<PMON::CheckType>(currentCheckType)) {
 			case PMON::CheckType::Limit: {
@@ -204,11 +217,11 @@ void OnBoardMonitoringService::modifyParameterMonitoringDefinitions(Message& mes
 					continue;
 				}
 
-				auto& limitCheck = static_cast<PMONLimitCheck&>(pmon);
-				limitCheck.lowLimit = lowLimit;
-				limitCheck.belowLowLimitEvent = belowLowLimitEventId;
-				limitCheck.highLimit = highLimit;
-				limitCheck.aboveHighLimitEvent = aboveHighLimitEventId;
+				PMONLimitCheck limitCheck(currentMonitoredParameterId, currentPMONRepetitionNumber,
+				                          lowLimit, belowLowLimitEventId, highLimit, aboveHighLimitEventId);
+				limitCheck.monitoringInterval = currentMonitoringInterval;
+				limitCheck.monitoringEnabled = monitoringEnabled;
+				replacePMONDefinition(currentPMONId, limitCheck);
 				break;
 			}
 
@@ -218,10 +231,11 @@ void OnBoardMonitoringService::modifyParameterMonitoringDefinitions(Message& mes
 				PMONExpectedValue expectedValue = message.read<PMONExpectedValue>();
 				EventDefinitionId unexpectedValueEvent = message.read<EventDefinitionId>();
 
-				auto& expectedValueCheck = static_cast<PMONExpectedValueCheck&>(pmon);
-				expectedValueCheck.mask = mask;
-				expectedValueCheck.expectedValue = expectedValue;
-				expectedValueCheck.unexpectedValueEvent = unexpectedValueEvent;
+				PMONExpectedValueCheck expectedValueCheck(currentMonitoredParameterId, currentPMONRepetitionNumber,
+				                                          expectedValue, mask, unexpectedValueEvent);
+				expectedValueCheck.monitoringInterval = currentMonitoringInterval;
+				expectedValueCheck.monitoringEnabled = monitoringEnabled;
+				replacePMONDefinition(currentPMONId, expectedValueCheck);
 				break;
 			}
 
@@ -238,12 +252,11 @@ void OnBoardMonitoringService::modifyParameterMonitoringDefinitions(Message& mes
 					continue;
 				}
 
-				auto& deltaCheck = static_cast<PMONDeltaCheck&>(pmon);
-				deltaCheck.numberOfConsecutiveDeltaChecks = numberOfConsecutiveDeltaChecks;
-				deltaCheck.lowDeltaThreshold = lowDeltaThreshold;
-				deltaCheck.belowLowThresholdEvent = belowLowThresholdEventId;
-				deltaCheck.highDeltaThreshold = highDeltaThreshold;
-				deltaCheck.aboveHighThresholdEvent = aboveHighThresholdEventId;
+				PMONDeltaCheck deltaCheck(currentMonitoredParameterId, currentPMONRepetitionNumber,
+				                          numberOfConsecutiveDeltaChecks, lowDeltaThreshold, belowLowThresholdEventId, highDeltaThreshold, aboveHighThresholdEventId);
+				deltaCheck.monitoringInterval = currentMonitoringInterval;
+				deltaCheck.monitoringEnabled = monitoringEnabled;
+				replacePMONDefinition(currentPMONId, deltaCheck);
 				break;
 			}
 		}
@@ -260,17 +273,18 @@ void OnBoardMonitoringService::reportParameterMonitoringDefinitions(Message& mes
 	for (uint16_t i = 0; i < numberOfIds; i++) {
 		auto currentPMONId = message.read<ParameterId>();
 
-		auto it = parameterMonitoringList.find(currentPMONId);
-		if (it == parameterMonitoringList.end()) {
+		PMON* definition = findPMONDefinition(currentPMONId);
+		if (definition == nullptr) {
 			ErrorHandler::reportError(message, ErrorHandler::ReportParameterNotInTheParameterMonitoringList);
 			continue;
 		}
 
-		PMON& pmon = it->second.get();
+		PMON& pmon = *definition;
 
 		pmonDefinitionReport.append<ParameterId>(currentPMONId);
 		pmonDefinitionReport.append<ParameterId>(pmon.monitoredParameterId);
 		pmonDefinitionReport.appendBoolean(pmon.monitoringEnabled);
+		pmonDefinitionReport.append<PMONMonitoringInterval>(pmon.monitoringInterval);
 		pmonDefinitionReport.append<PMONRepetitionNumber>(pmon.repetitionNumber);
 
 		auto checkTypeValue = pmon.checkType;
@@ -309,13 +323,485 @@ void OnBoardMonitoringService::reportParameterMonitoringDefinitions(Message& mes
 	storeMessage(pmonDefinitionReport);
 }
 
-void OnBoardMonitoringService::checkAll() const {
-	for (const auto& entry : parameterMonitoringList) {
-		auto& pmon = entry.second.get();
+void OnBoardMonitoringService::checkAll() {
+	const Time::DefaultCUC checkTime = TimeGetter::getCurrentTimeDefaultCUC();
+
+	parameterMonitoringDefinitions.forEach([this, &checkTime](SlotHandle handle, PMON& pmon) {
+		if (not pmon.isMonitoringEnabled()) {
+			return;
+		}
+		pmon.performCheck(checkTime);
+		if (pmon.hasUnconfirmedTransition()) {
+			processCheckTransition(definitionSlotStates[handle.index].PMONId, pmon, checkTime);
+		}
+	});
+
+	finishMonitoringCycle();
+}
+
+Time::DefaultCUC OnBoardMonitoringService::checkDueDefinitions(const Time::DefaultCUC& cycleTime) {
+	auto isCurrent = [this](const ScheduledCheck& scheduledCheck) {
+		return isScheduledCheckCurrent(scheduledCheck);
+	};
+
+	ScheduledCheck dueCheck;
+	while (monitoringSchedule.takeDue(cycleTime, isCurrent, dueCheck)) {
+		PMON& pmon = *parameterMonitoringDefinitions.get(dueCheck.key);
 		if (pmon.isMonitoringEnabled()) {
-			pmon.performCheck();
+			pmon.performCheck(cycleTime);
+			if (pmon.hasUnconfirmedTransition()) {
+				processCheckTransition(definitionSlotStates[dueCheck.key.index].PMONId, pmon, cycleTime);
+			}
 		}
+
+		scheduleCheck(dueCheck.key, cycleTime + pmon.getMonitoringPeriod());
+	}
+
+	finishMonitoringCycle();
+
+	Time::DefaultCUC nextCheckTime;
+	if (not monitoringSchedule.nextDueTime(isCurrent, nextCheckTime)) {
+		return cycleTime + ECSSMonitoringFrequency;
+	}
+	return nextCheckTime;
+}
+
+bool OnBoardMonitoringService::isScheduledCheckCurrent(const ScheduledCheck& scheduledCheck) {
+	return parameterMonitoringDefinitions.get(scheduledCheck.key) != nullptr and
+	       definitionSlotStates[scheduledCheck.key.index].nextCheckTime == scheduledCheck.dueTime;
+}
+
+void OnBoardMonitoringService::scheduleCheck(SlotHandle definition, Time::DefaultCUC checkTime) {
+	definitionSlotStates[definition.index].nextCheckTime = checkTime;
+	monitoringSchedule.schedule(definition, checkTime, [this](const ScheduledCheck& scheduledCheck) {
+		return isScheduledCheckCurrent(scheduledCheck);
+	});
+}
+
+PMON* OnBoardMonitoringService::findPMONDefinition(ParameterId PMONId) {
+	if (PMONId >= ECSSPMONIdRange) {
+		return nullptr;
+	}
+	return parameterMonitoringDefinitions.get(parameterMonitoringHandles[PMONId]);
+}
+
+template <typename Check>
+bool OnBoardMonitoringService::insertPMONDefinition(ParameterId PMONId, const Check& check) {
+	if (PMONId >= ECSSPMONIdRange or findPMONDefinition(PMONId) != nullptr) {
+		return false;
+	}
+
+	const SlotHandle handle = parameterMonitoringDefinitions.template emplace<Check>(check);
+	if (not handle.isValid()) {
+		return false;
+	}
+
+	parameterMonitoringHandles[PMONId] = handle;
+	definitionSlotStates[handle.index].PMONId = PMONId;
+	scheduleCheck(handle, Time::DefaultCUC());
+	return true;
+}
+
+template <typename Check>
+void OnBoardMonitoringService::replacePMONDefinition(ParameterId PMONId, const Check& check) {
+	PMON* pmon = findPMONDefinition(PMONId);
+	if (pmon == nullptr) {
+		return;
+	}
+
+	updateFunctionalMonitoring(PMONId, pmon->isFailing(), false);
+
+	if (pmon->checkType == check.checkType) {
+		static_cast<Check&>(*pmon) = check;
+		return;
+	}
+
+	removePMONDefinition(PMONId);
+	insertPMONDefinition(PMONId, check);
+}
+
+void OnBoardMonitoringService::removePMONDefinition(ParameterId PMONId) {
+	if (PMONId >= ECSSPMONIdRange) {
+		return;
+	}
+	parameterMonitoringDefinitions.release(parameterMonitoringHandles[PMONId]);
+	parameterMonitoringHandles[PMONId] = {};
+}
+
+void OnBoardMonitoringService::addPMONLimitCheck(ParameterId PMONId, const PMONLimitCheck& limitCheck) {
+	insertPMONDefinition(PMONId, limitCheck);
+}
+
+void OnBoardMonitoringService::addPMONExpectedValueCheck(ParameterId PMONId, const PMONExpectedValueCheck& expectedValueCheck) {
+	insertPMONDefinition(PMONId, expectedValueCheck);
+}
+
+void OnBoardMonitoringService::addPMONDeltaCheck(ParameterId PMONId, const PMONDeltaCheck& deltaCheck) {
+	insertPMONDefinition(PMONId, deltaCheck);
+}
+
+void OnBoardMonitoringService::clearParameterMonitoringList() {
+	etl::vector<FMONId, ECSSMaxFunctionalMonitoringDefinitions> unprotectedFMONs;
+	functionalMonitoringList.forEach([&unprotectedFMONs](const FMON& fmon) {
+		if (not fmon.isProtected) {
+			unprotectedFMONs.push_back(fmon.id);
+		}
+	});
+	for (const FMONId id: unprotectedFMONs) {
+		functionalMonitoringList.remove(id);
+	}
+
+	// The PMONs combined by the protected FMONs are kept, so that these FMONs stay evaluated
+	etl::vector<ParameterId, ECSSMaxMonitoringDefinitions> unusedPMONs;
+	parameterMonitoringDefinitions.forEach([this, &unusedPMONs](SlotHandle handle, PMON& /* pmon */) {
+		const ParameterId PMONId = definitionSlotStates[handle.index].PMONId;
+		if (not functionalMonitoringList.isPMONUsed(PMONId)) {
+			unusedPMONs.push_back(PMONId);
+		}
+	});
+	for (const ParameterId PMONId: unusedPMONs) {
+		removePMONDefinition(PMONId);
+	}
+
+	if (parameterMonitoringDefinitions.empty()) {
+		monitoringSchedule.clear();
+	}
+}
+
+void OnBoardMonitoringService::finishMonitoringCycle() {
+	transitionEventsInCycle = 0;
+	if (checkTransitions.empty()) {
+		return;
+	}
+	cyclesSinceFirstPendingTransition++;
+	if (cyclesSinceFirstPendingTransition >= maximumTransitionReportingDelay) {
+		checkTransitionReport();
+	}
+}
+
+void OnBoardMonitoringService::processCheckTransition(ParameterId PMONId, PMON& pmon, Time::DefaultCUC checkTime) {
+	const bool wasFailing = pmon.isFailing();
+	pmon.confirmTransition();
+
+	recordCheckTransition({PMONId, pmon.monitoredParameterId, pmon.checkType,
+	                       pmon.monitoredParameter.get().getValueAsDouble(), getLimitCrossed(pmon),
+	                       pmon.checkTransitionList[0], pmon.checkTransitionList[1], checkTime});
+
+	raiseCheckTransitionEvent(pmon);
+	updateFunctionalMonitoring(PMONId, wasFailing, pmon.isFailing());
+}
+
+void OnBoardMonitoringService::recordCheckTransition(const CheckTransition& transition) {
+	auto pending = etl::find_if(checkTransitions.begin(), checkTransitions.end(), [&transition](const auto& pendingTransition) {
+		return pendingTransition.PMONId == transition.PMONId;
+	});
+
+	if (pending != checkTransitions.end()) {
+		if (pending->previousCheckingStatus == transition.currentCheckingStatus) {
+			checkTransitions.erase(pending);
+			if (checkTransitions.empty()) {
+				cyclesSinceFirstPendingTransition = 0;
+			}
+			return;
+		}
+		pending->parameterValue = transition.parameterValue;
+		pending->limitCrossed = transition.limitCrossed;
+		pending->currentCheckingStatus = transition.currentCheckingStatus;
+		pending->transitionTime = transition.transitionTime;
+		return;
+	}
+
+	if (checkTransitions.full()) {
+		checkTransitionReport();
+	}
+	checkTransitions.push_back(transition);
+}
+
+void OnBoardMonitoringService::raiseCheckTransitionEvent(const PMON& pmon) {
+	EventDefinitionId eventId = 0;
+
+	switch (pmon.checkType) {
+		case PMON::CheckType::Limit: {
+			const auto& limitCheck = static_cast<const PMONLimitCheck&>(pmon);
+			if (pmon.checkingStatus == PMON::BelowLowLimit) {
+				eventId = limitCheck.getBelowLowLimitEvent();
+			} else if (pmon.checkingStatus == PMON::AboveHighLimit) {
+				eventId = limitCheck.getAboveHighLimitEvent();
+			}
+			break;
+		}
+		case PMON::CheckType::ExpectedValue: {
+			const auto& expectedValueCheck = static_cast<const PMONExpectedValueCheck&>(pmon);
+			if (pmon.checkingStatus == PMON::UnexpectedValue) {
+				eventId = expectedValueCheck.getUnexpectedValueEvent();
+			}
+			break;
+		}
+		case PMON::CheckType::Delta: {
+			const auto& deltaCheck = static_cast<const PMONDeltaCheck&>(pmon);
+			if (pmon.checkingStatus == PMON::BelowLowThreshold) {
+				eventId = deltaCheck.getBelowLowThresholdEvent();
+			} else if (pmon.checkingStatus == PMON::AboveHighThreshold) {
+				eventId = deltaCheck.getAboveHighThresholdEvent();
+			}
+			break;
+		}
+	}
+
+	if (eventId == 0) {
+		return;
+	}
+	if (transitionEventsInCycle >= maximumTransitionEventsPerCycle) {
+		suppressedTransitionEvents++;
+		return;
 	}
+	transitionEventsInCycle++;
+	raiseMonitoringEvent(eventId);
+}
+
+void OnBoardMonitoringService::raiseMonitoringEvent(EventDefinitionId eventId) {
+	if (eventId != 0) {
+		Services.eventReport.lowSeverityAnomalyReport(static_cast<EventReportService::Event>(eventId), "");
+	}
+}
+
+void OnBoardMonitoringService::updateFunctionalMonitoring(ParameterId PMONId, bool wasFailing, bool isFailing) {
+	functionalMonitoringList.updatePMONStatus(PMONId, wasFailing, isFailing, [this](const FMON& fmon) {
+		if (functionalMonitoringFunctionStatus and fmon.enabled) {
+			raiseMonitoringEvent(fmon.eventDefinitionId);
+		}
+	});
+}
+
+void OnBoardMonitoringService::resetPMONCheckingStatus(ParameterId PMONId, PMON& pmon) {
+	const bool wasFailing = pmon.isFailing();
+	pmon.resetCheckingStatus();
+	updateFunctionalMonitoring(PMONId, wasFailing, false);
+}
+
+template <typename Function>
+void OnBoardMonitoringService::forEachRequestedFMON(Message& message, Function&& function) {
+	const uint16_t numberOfFMONs = message.readUint16();
+	for (uint16_t i = 0; i < numberOfFMONs; i++) {
+		const FMONId currentId = message.read<FMONId>();
+		FMON* fmon = functionalMonitoringList.find(currentId);
+		if (fmon == nullptr) {
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::GetNonExistingFunctionalMonitoringDefinition);
+			continue;
+		}
+		function(*fmon);
+	}
+}
+
+void OnBoardMonitoringService::enableFunctionalMonitoringFunction(const Message& message) {
+	if (!message.assertTC(ServiceType, EnableFunctionalMonitoringFunction)) {
+		return;
+	}
+	functionalMonitoringFunctionStatus = true;
+}
+
+void OnBoardMonitoringService::disableFunctionalMonitoringFunction(const Message& message) {
+	if (!message.assertTC(ServiceType, DisableFunctionalMonitoringFunction)) {
+		return;
+	}
+	functionalMonitoringFunctionStatus = false;
+}
+
+void OnBoardMonitoringService::enableFunctionalMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, EnableFunctionalMonitoringDefinitions)) {
+		return;
+	}
+	forEachRequestedFMON(message, [](FMON& fmon) {
+		fmon.enabled = true;
+	});
+}
+
+void OnBoardMonitoringService::disableFunctionalMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, DisableFunctionalMonitoringDefinitions)) {
+		return;
+	}
+	forEachRequestedFMON(message, [](FMON& fmon) {
+		fmon.enabled = false;
+	});
+}
+
+void OnBoardMonitoringService::protectFunctionalMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, ProtectFunctionalMonitoringDefinitions)) {
+		return;
+	}
+	forEachRequestedFMON(message, [](FMON& fmon) {
+		fmon.isProtected = true;
+	});
+}
+
+void OnBoardMonitoringService::unprotectFunctionalMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, UnprotectFunctionalMonitoringDefinitions)) {
+		return;
+	}
+	forEachRequestedFMON(message, [](FMON& fmon) {
+		fmon.isProtected = false;
+	});
+}
+
+void OnBoardMonitoringService::addFunctionalMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, AddFunctionalMonitoringDefinitions)) {
+		return;
+	}
+
+	const uint16_t numberOfFMONs = message.readUint16();
+	for (uint16_t i = 0; i < numberOfFMONs; i++) {
+		FMON fmon;
+		fmon.id = message.read<FMONId>();
+		fmon.eventDefinitionId = message.read<EventDefinitionId>();
+		fmon.minimumFailingPMONs = message.readUint16();
+		const uint16_t numberOfPMONs = message.readUint16();
+
+		bool isValid = fmon.id < ECSSFMONIdRange and numberOfPMONs <= fmon.PMONIds.capacity();
+		for (uint16_t j = 0; j < numberOfPMONs; j++) {
+			const ParameterId PMONId = message.read<ParameterId>();
+			if (not isValid) {
+				continue;
+			}
+			const bool isDuplicate = etl::find(fmon.PMONIds.begin(), fmon.PMONIds.end(), PMONId) != fmon.PMONIds.end();
+			if (isDuplicate or findPMONDefinition(PMONId) == nullptr) {
+				isValid = false;
+				continue;
+			}
+			fmon.PMONIds.push_back(PMONId);
+		}
+		isValid = isValid and fmon.minimumFailingPMONs > 0 and fmon.minimumFailingPMONs <= numberOfPMONs;
+
+		if (not isValid) {
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::InvalidFunctionalMonitoringDefinition);
+			continue;
+		}
+		if (functionalMonitoringList.find(fmon.id) != nullptr) {
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::AddAlreadyExistingFunctionalMonitoringDefinition);
+			continue;
+		}
+		if (functionalMonitoringList.full()) {
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::FunctionalMonitoringListIsFull);
+			continue;
+		}
+
+		functionalMonitoringList.add(fmon, [this](ParameterId PMONId) {
+			return findPMONDefinition(PMONId)->isFailing();
+		});
+	}
+}
+
+void OnBoardMonitoringService::deleteFunctionalMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, DeleteFunctionalMonitoringDefinitions)) {
+		return;
+	}
+
+	forEachRequestedFMON(message, [this, &message](const FMON& fmon) {
+		if (fmon.enabled or fmon.isProtected) {
+			ErrorHandler::reportError(message, ErrorHandler::ExecutionStartErrorType::InvalidRequestToDeleteFunctionalMonitoringDefinition);
+			return;
+		}
+		functionalMonitoringList.remove(fmon.id);
+	});
+}
+
+void OnBoardMonitoringService::reportFunctionalMonitoringDefinitions(Message& message) {
+	if (!message.assertTC(ServiceType, ReportFunctionalMonitoringDefinitions)) {
+		return;
+	}
+
+	etl::vector<const FMON*, ECSSMaxFunctionalMonitoringDefinitions> reportedFMONs;
+	forEachRequestedFMON(message, [&reportedFMONs](const FMON& fmon) {
+		if (not reportedFMONs.full()) {
+			reportedFMONs.push_back(&fmon);
+		}
+	});
+
+	Message report = createTM(FunctionalMonitoringDefinitionReport);
+	report.appendUint16(reportedFMONs.size());
+	for (const FMON* fmon: reportedFMONs) {
+		report.append<FMONId>(fmon->id);
+		report.appendBoolean(fmon->isProtected);
+		report.appendBoolean(fmon->enabled);
+		report.append<EventDefinitionId>(fmon->eventDefinitionId);
+		report.appendUint16(fmon->minimumFailingPMONs);
+		report.appendUint16(fmon->PMONIds.size());
+		for (const ParameterId PMONId: fmon->PMONIds) {
+			report.append<ParameterId>(PMONId);
+		}
+	}
+	storeMessage(report);
+}
+
+void OnBoardMonitoringService::reportStatusOfFunctionalMonitoringDefinitions(const Message& message) {
+	if (!message.assertTC(ServiceType, ReportStatusOfFunctionalMonitoringDefinitions)) {
+		return;
+	}
+
+	Message report = createTM(FunctionalMonitoringDefinitionStatusReport);
+	report.appendUint16(functionalMonitoringList.size());
+	functionalMonitoringList.forEach([&report](const FMON& fmon) {
+		report.append<FMONId>(fmon.id);
+		report.appendBoolean(fmon.enabled);
+		report.appendEnum8(static_cast<uint8_t>(fmon.checkingStatus));
+	});
+	storeMessage(report);
+}
+
+double OnBoardMonitoringService::getLimitCrossed(const PMON& pmon) {
+	// A transition back to nominal reports the limit that had been crossed before
+	const PMON::CheckingStatus outOfLimitsStatus =
+	    (pmon.checkTransitionList[1] == PMON::WithinLimits or pmon.checkTransitionList[1] == PMON::WithinThreshold) ? pmon.checkTransitionList[0] : pmon.checkTransitionList[1];
+
+	switch (pmon.checkType) {
+		case PMON::CheckType::Limit: {
+			const auto& limitCheck = static_cast<const PMONLimitCheck&>(pmon);
+			if (outOfLimitsStatus == PMON::BelowLowLimit) {
+				return limitCheck.getLowLimit();
+			}
+			if (outOfLimitsStatus == PMON::AboveHighLimit) {
+				return limitCheck.getHighLimit();
+			}
+			break;
+		}
+		case PMON::CheckType::ExpectedValue:
+			return static_cast<double>(static_cast<const PMONExpectedValueCheck&>(pmon).getExpectedValue());
+		case PMON::CheckType::Delta: {
+			const auto& deltaCheck = static_cast<const PMONDeltaCheck&>(pmon);
+			if (outOfLimitsStatus == PMON::BelowLowThreshold) {
+				return deltaCheck.getLowDeltaThreshold();
+			}
+			if (outOfLimitsStatus == PMON::AboveHighThreshold) {
+				return deltaCheck.getHighDeltaThreshold();
+			}
+			break;
+		}
+	}
+
+	return 0;
+}
+
+void OnBoardMonitoringService::checkTransitionReport() {
+	cyclesSinceFirstPendingTransition = 0;
+	if (checkTransitions.empty()) {
+		return;
+	}
+
+	Message report = createTM(CheckTransitionReport);
+	report.appendUint16(checkTransitions.size());
+
+	for (const auto& transition: checkTransitions) {
+		report.append<ParameterId>(transition.PMONId);
+		report.append<ParameterId>(transition.monitoredParameterId);
+		report.append<PMON::CheckType>(transition.checkType);
+		report.appendDouble(transition.parameterValue);
+		report.appendDouble(transition.limitCrossed);
+		report.append<PMON::CheckingStatus>(transition.previousCheckingStatus);
+		report.append<PMON::CheckingStatus>(transition.currentCheckingStatus);
+		report.append(transition.transitionTime);
+	}
+
+	checkTransitions.clear();
+	storeMessage(report);
 }
 
 void OnBoardMonitoringService::execute(Message& message) {
@@ -344,6 +830,36 @@ void OnBoardMonitoringService::execute(Message& message) {
 		case ReportParameterMonitoringDefinitions:
 			reportParameterMonitoringDefinitions(message);
 			break;
+		case EnableFunctionalMonitoringFunction:
+			enableFunctionalMonitoringFunction(message);
+			break;
+		case DisableFunctionalMonitoringFunction:
+			disableFunctionalMonitoringFunction(message);
+			break;
+		case EnableFunctionalMonitoringDefinitions:
+			enableFunctionalMonitoringDefinitions(message);
+			break;
+		case DisableFunctionalMonitoringDefinitions:
+			disableFunctionalMonitoringDefinitions(message);
+			break;
+		case ProtectFunctionalMonitoringDefinitions:
+			protectFunctionalMonitoringDefinitions(message);
+			break;
+		case UnprotectFunctionalMonitoringDefinitions:
+			unprotectFunctionalMonitoringDefinitions(message);
+			break;
+		case AddFunctionalMonitoringDefinitions:
+			addFunctionalMonitoringDefinitions(message);
+			break;
+		case DeleteFunctionalMonitoringDefinitions:
+			deleteFunctionalMonitoringDefinitions(message);
+			break;
+		case ReportFunctionalMonitoringDefinitions:
+			reportFunctionalMonitoringDefinitions(message);
+			break;
+		case ReportStatusOfFunctionalMonitoringDefinitions:
+			reportStatusOfFunctionalMonitoringDefinitions(message);
+			break;
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
@@ -5,9 +5,60 @@
 
 ParameterStatisticsService::ParameterStatisticsService() : evaluationStartTime(TimeGetter::getCurrentTimeDefaultCUC()) {
 	initializeStatisticsMap();
+	nextReportTime = evaluationStartTime + toSamplingPeriod(reportingIntervalMs);
 	serviceType = ServiceType;
 }
 
+Time::DefaultCUC ParameterStatisticsService::sampleDueStatistics(const Time::DefaultCUC& currentTime) {
+	auto isCurrent = [this](const ScheduledSample& scheduledSample) {
+		return isScheduledSampleCurrent(scheduledSample);
+	};
+
+	ScheduledSample dueSample;
+	while (samplingSchedule.takeDue(currentTime, isCurrent, dueSample)) {
+		Statistic& statistic = statisticsMap.at(dueSample.key);
+		auto parameter = Services.parameterManagement.getParameter(dueSample.key);
+		if (parameter) {
+			statistic.updateStatistics(parameter->get().getValueAsDouble(), currentTime);
+		}
+
+		const auto samplingPeriod = toSamplingPeriod(statistic.selfSamplingInterval);
+		Time::DefaultCUC nextSampleTime = dueSample.dueTime + samplingPeriod;
+		if (nextSampleTime <= currentTime) {
+			nextSampleTime = currentTime + samplingPeriod;
+		}
+		scheduleSample(dueSample.key, statistic, nextSampleTime);
+	}
+
+	const bool isReportingPeriodic = periodicStatisticsReportingStatus and reportingIntervalMs > 0;
+	if (isReportingPeriodic and nextReportTime <= currentTime) {
+		reportParameterStatistics(false);
+		const auto reportingPeriod = toSamplingPeriod(reportingIntervalMs);
+		nextReportTime += reportingPeriod;
+		if (nextReportTime <= currentTime) {
+			nextReportTime = currentTime + reportingPeriod;
+		}
+	}
+
+	Time::DefaultCUC nextSampleTime;
+	if (not samplingSchedule.nextDueTime(isCurrent, nextSampleTime)) {
+		return isReportingPeriodic ? nextReportTime : currentTime + toSamplingPeriod(InitialReportingIntervalMs);
+	}
+	return (isReportingPeriodic and nextReportTime < nextSampleTime) ? nextReportTime : nextSampleTime;
+}
+
+bool ParameterStatisticsService::isScheduledSampleCurrent(const ScheduledSample& scheduledSample) {
+	auto statistic = statisticsMap.find(scheduledSample.key);
+	return statistic != statisticsMap.end() and statistic->second.nextSampleTime == scheduledSample.dueTime;
+}
+
+void ParameterStatisticsService::scheduleSample(ParameterId parameterId, Statistic& statistic, Time::DefaultCUC sampleTime) {
+	statistic.nextSampleTime = sampleTime;
+	samplingSchedule.schedule(parameterId, sampleTime, [this](const ScheduledSample& scheduledSample) {
+		return isScheduledSampleCurrent(scheduledSample);
+	});
+}
+
 void ParameterStatisticsService::reportParameterStatistics(Message& request) {
 	if (!request.assertTC(ServiceType, MessageType::ReportParameterStatistics)) {
 		return;
@@ -29,13 +80,16 @@ void ParameterStatisticsService::reportParameterStatistics(bool reset) {
 
 void ParameterStatisticsService::parameterStatisticsReport() {
 	Message report = createTM(ParameterStatisticsReport);
-	report.append(evaluationStartTime);
 	auto evaluationStopTime = TimeGetter::getCurrentTimeDefaultCUC();
-	report.append(evaluationStopTime);
+	if constexpr (not SupportsSlidingWindowStatistics) {
+		report.append(evaluationStartTime);
+		report.append(evaluationStopTime);
+	}
 
 	uint16_t numOfValidParameters = 0; // NOLINT(misc-const-correctness)
-	for (const auto& currentStatistic: statisticsMap) {
-		const ParameterSampleCount numOfSamples = currentStatistic.second.sampleCounter;
+	for (auto& currentStatistic: statisticsMap) {
+		currentStatistic.second.expireWindow(evaluationStopTime);
+		const ParameterSampleCount numOfSamples = currentStatistic.second.getSampleCount();
 		if (numOfSamples == 0) {
 			continue;
 		}
@@ -45,13 +99,23 @@ void ParameterStatisticsService::parameterStatisticsReport() {
 
 	for (auto& currentStatistic: statisticsMap) {
 		const ParameterId currentId = currentStatistic.first;
-		const ParameterSampleCount numOfSamples = currentStatistic.second.sampleCounter;
+		const Statistic& statistic = currentStatistic.second;
+		const ParameterSampleCount numOfSamples = statistic.getSampleCount();
 		if (numOfSamples == 0) {
 			continue;
 		}
 		report.append<ParameterId>(currentId);
 		report.append<ParameterSampleCount>(numOfSamples);
-		currentStatistic.second.appendStatisticsToMessage(report);
+		if constexpr (SupportsSlidingWindowStatistics) {
+			if (statistic.isWindowed()) {
+				report.append(statistic.window.oldestTime());
+				report.append(statistic.window.newestTime());
+			} else {
+				report.append(evaluationStartTime);
+				report.append(evaluationStopTime);
+			}
+		}
+		statistic.appendStatisticsToMessage(report);
 	}
 	storeMessage(report);
 }
@@ -86,6 +150,7 @@ void ParameterStatisticsService::enablePeriodicStatisticsReporting(Message& requ
 
 	periodicStatisticsReportingStatus = true;
 	reportingIntervalMs = timeInterval;
+	nextReportTime = TimeGetter::getCurrentTimeDefaultCUC() + toSamplingPeriod(reportingIntervalMs);
 }
 
 void ParameterStatisticsService::disablePeriodicStatisticsReporting(const Message& request) {
@@ -120,6 +185,10 @@ void ParameterStatisticsService::addOrUpdateStatisticsDefinitions(Message& reque
 				ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::InvalidSamplingRateError);
 				continue;
 			}
+			if (exists and not Statistic::windowFits(statisticsMap.at(currentId).windowLength, interval)) {
+				ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::InvalidStatisticsWindowLength);
+				continue;
+			}
 		}
 		if (not exists) {
 			if (statisticsMap.size() >= ECSSMaxStatisticParameters) {
@@ -132,13 +201,13 @@ void ParameterStatisticsService::addOrUpdateStatisticsDefinitions(Message& reque
 				newStatistic.setSelfSamplingInterval(interval);
 			}
 			statisticsMap.insert({currentId, newStatistic});
-			// TODO(#260): start the evaluation of statistics for this parameter.
 		} else {
 			if (SupportsSamplingInterval) {
 				statisticsMap.at(currentId).setSelfSamplingInterval(interval);
 			}
 			statisticsMap.at(currentId).resetStatistics();
 		}
+		scheduleSample(currentId, statisticsMap.at(currentId), TimeGetter::getCurrentTimeDefaultCUC());
 	}
 }
 
@@ -150,6 +219,7 @@ void ParameterStatisticsService::deleteStatisticsDefinitions(Message& request) {
 	uint16_t const numOfIds = request.readUint16();
 	if (numOfIds == 0) {
 		statisticsMap.clear();
+		samplingSchedule.clear();
 		periodicStatisticsReportingStatus = false;
 		return;
 	}
@@ -166,6 +236,26 @@ void ParameterStatisticsService::deleteStatisticsDefinitions(Message& request) {
 	}
 }
 
+void ParameterStatisticsService::setStatisticsWindowLengths(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::SetParameterStatisticsWindowLengths)) {
+		return;
+	}
+
+	uint16_t const numOfIds = request.readUint16();
+	for (uint16_t i = 0; i < numOfIds; i++) {
+		const ParameterId currentId = request.read<ParameterId>();
+		const std::chrono::milliseconds windowLength(request.readUint32());
+		auto statistic = statisticsMap.find(currentId);
+		if (statistic == statisticsMap.end()) {
+			ErrorHandler::reportError(request, ErrorHandler::GetNonExistingParameter);
+			continue;
+		}
+		if (not statistic->second.setWindowLength(windowLength)) {
+			ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::InvalidStatisticsWindowLength);
+		}
+	}
+}
+
 void ParameterStatisticsService::reportStatisticsDefinitions(const Message& request) {
 	if (!request.assertTC(ServiceType, MessageType::ReportParameterStatisticsDefinitions)) {
 		return;
@@ -221,6 +311,9 @@ void ParameterStatisticsService::execute(Message& message) {
 			currentTime = getCurrentTime();
 			reportStatisticsDefinitions(message);
 			break;
+		case SetParameterStatisticsWindowLengths:
+			setStatisticsWindowLengths(message);
+			break;
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
@@ -18,12 +18,12 @@ void RealTimeForwardingControlService::addAllReportsOfService(ApplicationProcess
 }
 
 uint8_t RealTimeForwardingControlService::countServicesOfApplication(ApplicationProcessId applicationID) {
+	// The definitions are sorted by application first, so the services of an application are next to each other
+	const auto& definitions = applicationProcessConfiguration.definitions;
 	uint8_t serviceCounter = 0; // NOLINT(misc-const-correctness)
-	for (const auto& definition: applicationProcessConfiguration.definitions) {
-		const auto& pair = definition.first;
-		if (pair.first == applicationID) {
-			serviceCounter++;
-		}
+	for (auto iter = definitions.lower_bound(ApplicationProcessConfiguration::AppServiceKey(applicationID, 0));
+	     iter != definitions.end() and iter->first.first == applicationID; iter++) {
+		serviceCounter++;
 	}
 	return serviceCounter;
 }
@@ -96,9 +96,7 @@ bool RealTimeForwardingControlService::checkMessage(const Message& request, Appl
 
 bool RealTimeForwardingControlService::reportExistsInAppProcessConfiguration(ApplicationProcessId applicationID, ServiceTypeNum serviceType,
                                                                              MessageTypeNum messageType) {
-	auto key = std::make_pair(applicationID, serviceType);
-	auto& messages = applicationProcessConfiguration.definitions[key];
-	return std::find(messages.begin(), messages.end(), messageType) != messages.end();
+	return isReportTypeEnabled(messageType, applicationID, serviceType);
 }
 
 void RealTimeForwardingControlService::addReportTypesToAppProcessConfiguration(Message& request) {
@@ -145,6 +143,7 @@ void RealTimeForwardingControlService::addReportTypesToAppProcessConfiguration(M
 			}
 		}
 	}
+	updateForwardingBitmaps();
 }
 
 bool RealTimeForwardingControlService::isApplicationEnabled(ApplicationProcessId targetAppID) const {
@@ -169,11 +168,9 @@ bool RealTimeForwardingControlService::isReportTypeEnabled(ServiceTypeNum target
 
 void RealTimeForwardingControlService::deleteApplicationProcess(ApplicationProcessId applicationID) {
 	auto& definitions = applicationProcessConfiguration.definitions;
-	auto iter = std::begin(definitions);
-	while (iter != definitions.end()) {
-		iter = std::find_if(
-		    std::begin(definitions), std::end(definitions), [applicationID](const auto& definition) { return applicationID == definition.first.first; });
-		definitions.erase(iter);
+	auto iter = definitions.lower_bound(ApplicationProcessConfiguration::AppServiceKey(applicationID, 0));
+	while (iter != definitions.end() and iter->first.first == applicationID) {
+		iter = definitions.erase(iter);
 	}
 }
 
@@ -237,6 +234,7 @@ void RealTimeForwardingControlService::deleteReportTypesFromAppProcessConfigurat
 	uint8_t const numOfApplications = request.readUint8();
 	if (numOfApplications == 0) {
 		applicationProcessConfiguration.definitions.clear();
+		updateForwardingBitmaps();
 		return;
 	}
 
@@ -274,6 +272,263 @@ void RealTimeForwardingControlService::deleteReportTypesFromAppProcessConfigurat
 			}
 		}
 	}
+	updateForwardingBitmaps();
+}
+
+void RealTimeForwardingControlService::updateForwardingBitmaps() {
+	for (const auto applicationID: filteredApplications) {
+		forwardingBitmapSlots[applicationID] = NoForwardingBitmap;
+	}
+	filteredApplications.clear();
+	for (const auto& definition: applicationProcessConfiguration.definitions) {
+		const auto applicationID = definition.first.first;
+		if (filteredApplications.empty() or filteredApplications.back() != applicationID) {
+			if (filteredApplications.full() or applicationID >= NumberOfApplicationIds) {
+				break;
+			}
+			forwardingBitmapSlots[applicationID] = filteredApplications.size();
+			filteredApplications.push_back(applicationID);
+			forwardingBitmaps[filteredApplications.size() - 1].reset();
+		}
+		auto& bitmap = forwardingBitmaps[filteredApplications.size() - 1];
+		for (const auto messageType: definition.second) {
+			bitmap.set(reportIndex(definition.first.second, messageType));
+		}
+	}
+}
+
+bool RealTimeForwardingControlService::isForwarded(const Message& message) {
+	if (message.packetType != Message::TM) {
+		return true;
+	}
+	if (message.applicationId < NumberOfApplicationIds) {
+		const uint8_t slot = forwardingBitmapSlots[message.applicationId];
+		if (slot != NoForwardingBitmap and
+		    not forwardingBitmaps[slot].test(reportIndex(message.serviceType, message.messageType))) {
+			return false;
+		}
+	}
+
+	if (message.serviceType == HousekeepingService::ServiceType and
+	    message.messageType == HousekeepingService::MessageType::HousekeepingParametersReport) {
+		return isHousekeepingReportForwarded(message);
+	}
+	if (message.serviceType == EventReportService::ServiceType and
+	    message.messageType >= EventReportService::MessageType::InformativeEventReport and
+	    message.messageType <= EventReportService::MessageType::HighSeverityAnomalyReport) {
+		return isEventReportForwarded(message);
+	}
+	return true;
+}
+
+bool RealTimeForwardingControlService::isHousekeepingReportForwarded(const Message& report) {
+	auto* definition = housekeepingReportConfiguration.find(report.applicationId);
+	if (definition == nullptr or report.dataSize < sizeof(ParameterReportStructureId)) {
+		return true;
+	}
+
+	// The structure ID is the first field of the report
+	const ParameterReportStructureId structureId = report.data[0];
+	const uint16_t subsamplingRate = definition->subsamplingRates[structureId];
+	if (subsamplingRate == 0) {
+		return false;
+	}
+	uint16_t& reportCounter = definition->reportCounters[structureId];
+	const bool forwarded = reportCounter == 0;
+	reportCounter = (reportCounter + 1) % subsamplingRate;
+	return forwarded;
+}
+
+bool RealTimeForwardingControlService::isEventReportForwarded(const Message& report) {
+	auto* definition = eventReportBlockingConfiguration.find(report.applicationId);
+	if (definition == nullptr or report.dataSize < sizeof(EventDefinitionId)) {
+		return true;
+	}
+
+	// The event definition ID is the first field of the report
+	const EventDefinitionId eventID = (report.data[0] << 8U) | report.data[1];
+	return eventID >= definition->blockedEvents.size() or not definition->blockedEvents.test(eventID);
+}
+
+void RealTimeForwardingControlService::skipApplicationDefinition(Message& request, uint8_t numOfItems, uint8_t itemSize) {
+	request.skipBytes(numOfItems * itemSize);
+}
+
+void RealTimeForwardingControlService::addStructuresToHousekeepingConfiguration(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::AddStructuresToHousekeepingConfiguration)) {
+		return;
+	}
+	auto& definitions = housekeepingReportConfiguration.definitions;
+	uint8_t const numOfApplications = request.readUint8();
+
+	for (uint8_t currentApplicationNumber = 0; currentApplicationNumber < numOfApplications; currentApplicationNumber++) {
+		const ApplicationProcessId applicationID = request.read<ApplicationProcessId>();
+		uint8_t const numOfStructures = request.readUint8();
+
+		if (not checkAppControlled(request, applicationID)) {
+			skipApplicationDefinition(request, numOfStructures, sizeof(ParameterReportStructureId) + sizeof(uint16_t));
+			continue;
+		}
+
+		auto* definition = housekeepingReportConfiguration.find(applicationID);
+		for (uint8_t currentStructureNumber = 0; currentStructureNumber < numOfStructures; currentStructureNumber++) {
+			const ParameterReportStructureId structureId = request.read<ParameterReportStructureId>();
+			const uint16_t subsamplingRate = request.readUint16();
+
+			if (subsamplingRate == 0) {
+				ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::InvalidSubsamplingRate);
+				continue;
+			}
+			if (definition == nullptr) {
+				if (definitions.full()) {
+					ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::MaxHousekeepingStructuresReached);
+					continue;
+				}
+				definitions.emplace_back();
+				definition = &definitions.back();
+				definition->applicationID = applicationID;
+			}
+
+			uint16_t& currentRate = definition->subsamplingRates[structureId];
+			if (currentRate == 0) {
+				if (definition->numberOfStructures >= ECSSMaxHousekeepingStructures) {
+					ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::MaxHousekeepingStructuresReached);
+					continue;
+				}
+				definition->numberOfStructures++;
+			}
+			currentRate = subsamplingRate;
+			definition->reportCounters[structureId] = 0;
+		}
+	}
+}
+
+void RealTimeForwardingControlService::deleteStructuresFromHousekeepingConfiguration(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DeleteStructuresFromHousekeepingConfiguration)) {
+		return;
+	}
+	uint8_t const numOfApplications = request.readUint8();
+	if (numOfApplications == 0) {
+		housekeepingReportConfiguration.definitions.clear();
+		return;
+	}
+
+	for (uint8_t currentApplicationNumber = 0; currentApplicationNumber < numOfApplications; currentApplicationNumber++) {
+		const ApplicationProcessId applicationID = request.read<ApplicationProcessId>();
+		uint8_t const numOfStructures = request.readUint8();
+
+		auto* definition = housekeepingReportConfiguration.find(applicationID);
+		if (definition == nullptr) {
+			ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::NonExistentApplicationProcess);
+			skipApplicationDefinition(request, numOfStructures, sizeof(ParameterReportStructureId));
+			continue;
+		}
+		if (numOfStructures == 0) {
+			housekeepingReportConfiguration.erase(applicationID);
+			continue;
+		}
+
+		for (uint8_t currentStructureNumber = 0; currentStructureNumber < numOfStructures; currentStructureNumber++) {
+			const ParameterReportStructureId structureId = request.read<ParameterReportStructureId>();
+
+			if (definition->subsamplingRates[structureId] == 0) {
+				ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::NonExistentHousekeepingStructureDefinition);
+				continue;
+			}
+			definition->subsamplingRates[structureId] = 0;
+			definition->reportCounters[structureId] = 0;
+			definition->numberOfStructures--;
+		}
+		if (definition->numberOfStructures == 0) {
+			housekeepingReportConfiguration.erase(applicationID);
+		}
+	}
+}
+
+void RealTimeForwardingControlService::addEventDefinitionsToEventReportConfiguration(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::AddEventDefinitionsToEventReportConfiguration)) {
+		return;
+	}
+	auto& definitions = eventReportBlockingConfiguration.definitions;
+	uint8_t const numOfApplications = request.readUint8();
+
+	for (uint8_t currentApplicationNumber = 0; currentApplicationNumber < numOfApplications; currentApplicationNumber++) {
+		const ApplicationProcessId applicationID = request.read<ApplicationProcessId>();
+		uint8_t const numOfEvents = request.readUint8();
+
+		if (not checkAppControlled(request, applicationID)) {
+			skipApplicationDefinition(request, numOfEvents, sizeof(EventDefinitionId));
+			continue;
+		}
+
+		auto* definition = eventReportBlockingConfiguration.find(applicationID);
+		for (uint8_t currentEventNumber = 0; currentEventNumber < numOfEvents; currentEventNumber++) {
+			const EventDefinitionId eventID = request.read<EventDefinitionId>();
+
+			if (eventID == 0 or eventID >= ECSSEventCatalogueSize) {
+				ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::UnknownEventDefinitionId);
+				continue;
+			}
+			if (definition == nullptr) {
+				if (definitions.full()) {
+					ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::MaxEventDefinitionsReached);
+					continue;
+				}
+				definitions.emplace_back();
+				definition = &definitions.back();
+				definition->applicationID = applicationID;
+			}
+			if (definition->blockedEvents.test(eventID)) {
+				continue;
+			}
+			if (definition->numberOfEvents >= ECSSMaxEventDefinitionIDs) {
+				ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::MaxEventDefinitionsReached);
+				continue;
+			}
+			definition->blockedEvents.set(eventID);
+			definition->numberOfEvents++;
+		}
+	}
+}
+
+void RealTimeForwardingControlService::deleteEventDefinitionsFromEventReportConfiguration(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DeleteEventDefinitionsFromEventReportConfiguration)) {
+		return;
+	}
+	uint8_t const numOfApplications = request.readUint8();
+	if (numOfApplications == 0) {
+		eventReportBlockingConfiguration.definitions.clear();
+		return;
+	}
+
+	for (uint8_t currentApplicationNumber = 0; currentApplicationNumber < numOfApplications; currentApplicationNumber++) {
+		const ApplicationProcessId applicationID = request.read<ApplicationProcessId>();
+		uint8_t const numOfEvents = request.readUint8();
+
+		auto* definition = eventReportBlockingConfiguration.find(applicationID);
+		if (definition == nullptr) {
+			ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::NonExistentApplicationProcess);
+			skipApplicationDefinition(request, numOfEvents, sizeof(EventDefinitionId));
+			continue;
+		}
+		if (numOfEvents == 0) {
+			eventReportBlockingConfiguration.erase(applicationID);
+			continue;
+		}
+
+		for (uint8_t currentEventNumber = 0; currentEventNumber < numOfEvents; currentEventNumber++) {
+			const EventDefinitionId eventID = request.read<EventDefinitionId>();
+
+			if (eventID >= ECSSEventCatalogueSize or not definition->blockedEvents.reset(eventID)) {
+				ErrorHandler::reportError(request, ErrorHandler::ExecutionStartErrorType::NonExistentEventDefinition);
+				continue;
+			}
+			definition->numberOfEvents--;
+		}
+		if (definition->numberOfEvents == 0) {
+			eventReportBlockingConfiguration.erase(applicationID);
+		}
+	}
 }
 
 void RealTimeForwardingControlService::reportAppProcessConfigurationContent(const Message& request) {
@@ -327,6 +582,55 @@ void RealTimeForwardingControlService::appProcessConfigurationContentReport() {
 	storeMessage(report);
 }
 
+void RealTimeForwardingControlService::reportHousekeepingConfigurationContent(const Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::ReportHousekeepingConfigurationContent)) {
+		return;
+	}
+	housekeepingConfigurationContentReport();
+}
+
+void RealTimeForwardingControlService::housekeepingConfigurationContentReport() {
+	Message report(ServiceType, MessageType::HousekeepingConfigurationContentReport, Message::TM, ApplicationId);
+
+	const auto& definitions = housekeepingReportConfiguration.definitions;
+	report.appendUint8(definitions.size());
+	for (const auto& definition: definitions) {
+		report.append<ApplicationProcessId>(definition.applicationID);
+		report.appendUint8(definition.numberOfStructures);
+		for (size_t structureId = 0; structureId < HousekeepingReportConfiguration::NumberOfStructureIds; structureId++) {
+			if (definition.subsamplingRates[structureId] != 0) {
+				report.append<ParameterReportStructureId>(structureId);
+				report.appendUint16(definition.subsamplingRates[structureId]);
+			}
+		}
+	}
+	storeMessage(report);
+}
+
+void RealTimeForwardingControlService::reportEventReportConfigurationContent(const Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::ReportEventReportConfigurationContent)) {
+		return;
+	}
+	eventReportConfigurationContentReport();
+}
+
+void RealTimeForwardingControlService::eventReportConfigurationContentReport() {
+	Message report(ServiceType, MessageType::EventReportConfigurationContentReport, Message::TM, ApplicationId);
+
+	const auto& definitions = eventReportBlockingConfiguration.definitions;
+	report.appendUint8(definitions.size());
+	for (const auto& definition: definitions) {
+		report.append<ApplicationProcessId>(definition.applicationID);
+		report.appendUint8(definition.numberOfEvents);
+		for (size_t eventID = 1; eventID < definition.blockedEvents.size(); eventID++) {
+			if (definition.blockedEvents.test(eventID)) {
+				report.append<EventDefinitionId>(eventID);
+			}
+		}
+	}
+	storeMessage(report);
+}
+
 void RealTimeForwardingControlService::execute(Message& message) {
 	switch (message.messageType) {
 		case AddReportTypesToAppProcessConfiguration:
@@ -338,6 +642,24 @@ void RealTimeForwardingControlService::execute(Message& message) {
 		case ReportAppProcessConfigurationContent:
 			reportAppProcessConfigurationContent(message);
 			break;
+		case AddStructuresToHousekeepingConfiguration:
+			addStructuresToHousekeepingConfiguration(message);
+			break;
+		case DeleteStructuresFromHousekeepingConfiguration:
+			deleteStructuresFromHousekeepingConfiguration(message);
+			break;
+		case ReportHousekeepingConfigurationContent:
+			reportHousekeepingConfigurationContent(message);
+			break;
+		case AddEventDefinitionsToEventReportConfiguration:
+			addEventDefinitionsToEventReportConfiguration(message);
+			break;
+		case DeleteEventDefinitionsFromEventReportConfiguration:
+			deleteEventDefinitionsFromEventReportConfiguration(message);
+			break;
+		case ReportEventReportConfigurationContent:
+			reportEventReportConfigurationContent(message);
+			break;
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
@@ -6,16 +6,18 @@
 
 void RequestVerificationService::assembleReportMessage(const Message& request, Message& report) {
 
-	report.appendEnumerated(CCSDSPacketVersionBits, CCSDSPacketVersion);
-	report.appendEnumerated(PacketTypeBits, request.packetType);
-	report.appendBits(SecondaryHeaderFlagBits, SecondaryHeaderFlag);
-	report.appendEnumerated(ApplicationIdBits, request.applicationId);
-	report.appendEnumerated(ECSSSequenceFlagsBits, ECSSSequenceFlags);
-	report.appendBits(PacketSequenceCountBits, request.packetSequenceCount);
+	uint32_t requestId = RequestIdTemplate;
+	requestId |= static_cast<uint32_t>(request.packetType) << (32U - CCSDSPacketVersionBits - PacketTypeBits);
+	requestId |= static_cast<uint32_t>(request.applicationId & 0x07ffU) << (ECSSSequenceFlagsBits + PacketSequenceCountBits);
+	requestId |= request.packetSequenceCount & 0x3fffU;
+	report.appendUint32(requestId);
 }
 
 void RequestVerificationService::successAcceptanceVerification(const Message& request) {
 	// TM[1,1] successful acceptance verification report
+	if (not request.isAcknowledgementRequested(Message::AcknowledgeAcceptance)) {
+		return;
+	}
 
 	Message report = createTM(RequestVerificationService::MessageType::SuccessfulAcceptanceReport);
 
@@ -37,6 +39,9 @@ void RequestVerificationService::failAcceptanceVerification(const Message& reque
 
 void RequestVerificationService::successStartExecutionVerification(const Message& request) {
 	// TM[1,3] successful start of execution verification report
+	if (not request.isAcknowledgementRequested(Message::AcknowledgeStart)) {
+		return;
+	}
 
 	Message report = createTM(RequestVerificationService::MessageType::SuccessfulStartOfExecution);
 
@@ -60,6 +65,9 @@ void RequestVerificationService::failStartExecutionVerification(const Message& r
 
 void RequestVerificationService::successProgressExecutionVerification(const Message& request, StepId stepID) {
 	// TM[1,5] successful progress of execution verification report
+	if (not request.isAcknowledgementRequested(Message::AcknowledgeProgress)) {
+		return;
+	}
 
 	Message report = createTM(RequestVerificationService::MessageType::SuccessfulProgressOfExecution);
 
@@ -85,6 +93,9 @@ void RequestVerificationService::failProgressExecutionVerification(const Message
 
 void RequestVerificationService::successCompletionExecutionVerification(const Message& request) {
 	// TM[1,7] successful completion of execution verification report
+	if (not request.isAcknowledgementRequested(Message::AcknowledgeCompletion)) {
+		return;
+	}
 
 	Message report = createTM(RequestVerificationService::MessageType::SuccessfulCompletionOfExecution);
 
@@ -1,4 +1,5 @@
 #include "Services/StorageAndRetrievalService.hpp"
+#include "ServicePool.hpp"
 
 String<ECSSPacketStoreIdSize> StorageAndRetrievalService::readPacketStoreId(Message& message) {
 	etl::array<uint8_t, ECSSPacketStoreIdSize> packetStoreId = {};
@@ -158,14 +159,15 @@ void StorageAndRetrievalService::createContentSummary(Message& report,
 
 	report.append<Time::DefaultCUC>(packetStores[packetStoreId].openRetrievalStartTimeTag);
 
-	auto filledPercentage1 = static_cast<uint16_t>(static_cast<float>(packetStores[packetStoreId].storedTelemetryPackets.size()) * 100 / // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+	// The packets whose buffers have been dropped by the message pool do not count towards the fill level
+	auto filledPercentage1 = static_cast<uint16_t>(static_cast<float>(packetStores[packetStoreId].countHeldPackets()) * 100 / // NOLINT(cppcoreguidelines-avoid-magic-numbers)
 	                                               ECSSMaxPacketStoreSize);
 	report.append<PercentageFilled>(filledPercentage1);
 
 	const uint16_t numOfPacketsToBeTransferred = std::count_if( // NOLINT(cppcoreguidelines-init-variables)
 	    std::begin(packetStores[packetStoreId].storedTelemetryPackets),
-	    std::end(packetStores[packetStoreId].storedTelemetryPackets), [this, &packetStoreId](auto packet) {
-		    return packet.first >= packetStores[packetStoreId].openRetrievalStartTimeTag;
+	    std::end(packetStores[packetStoreId].storedTelemetryPackets), [this, &packetStoreId](const auto& packet) {
+		    return packet.second and packet.first >= packetStores[packetStoreId].openRetrievalStartTimeTag;
 	    });
 	auto filledPercentage2 = static_cast<uint16_t>(static_cast<float>(numOfPacketsToBeTransferred) * 100 / ECSSMaxPacketStoreSize); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
 	report.append<PercentageFilled>(filledPercentage2);
@@ -201,8 +203,18 @@ void StorageAndRetrievalService::addPacketStore(const String<ECSSPacketStoreIdSi
 
 void StorageAndRetrievalService::addTelemetryToPacketStore(const String<ECSSPacketStoreIdSize>& packetStoreId,
                                                            Time::DefaultCUC timestamp) {
-	Message tmPacket; // NOLINT(misc-const-correctness) as we might need to change
-	packetStores[packetStoreId].storedTelemetryPackets.push_back({timestamp, tmPacket});
+	addTelemetryToPacketStore(packetStoreId, timestamp, Services.messagePool.acquire());
+}
+
+void StorageAndRetrievalService::addTelemetryToPacketStore(const String<ECSSPacketStoreIdSize>& packetStoreId,
+                                                           Time::DefaultCUC timestamp, MessageHandle tmPacket) {
+	// The pool has already reported a failed acquisition, so there is no packet to store
+	if (not tmPacket) {
+		return;
+	}
+	PacketStore& packetStore = packetStores[packetStoreId];
+	packetStore.removeDroppedPackets();
+	packetStore.storedTelemetryPackets.push_back({timestamp, std::move(tmPacket)});
 }
 
 void StorageAndRetrievalService::resetPacketStores() {
@@ -5,19 +5,42 @@
 
 TimeBasedSchedulingService::TimeBasedSchedulingService() {
 	serviceType = TimeBasedSchedulingService::ServiceType;
+	resetSubSchedulesAndGroups();
 }
 
 Time::DefaultCUC TimeBasedSchedulingService::executeScheduledActivity(Time::DefaultCUC currentTime) {
+	uint16_t releasedActivities = 0;
+	while (not scheduledActivities.empty()) {
+		const ActivityIndex nextActivity = scheduledActivities.front();
+		ScheduledActivity& activity = *scheduledActivities.get(nextActivity);
+		if (currentTime < activity.requestReleaseTime) {
+			break;
+		}
+		if (releasedActivities == ECSSMaxTimeSchedReleasesPerTick) {
+			releaseBudgetExhaustedCount++;
+			break;
+		}
 
-	if (currentTime >= scheduledActivities.front().requestReleaseTime && !scheduledActivities.empty()) {
-		if (scheduledActivities.front().requestID.applicationID == ApplicationId) {
-			MessageParser::execute(scheduledActivities.front().request);
+		const auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(
+		    currentTime - activity.requestReleaseTime);
+		maximumReleaseDelay = etl::max(maximumReleaseDelay, static_cast<uint32_t>(delay.count()));
+		if (delay > ECSSTimeSchedLateReleaseMargin) {
+			lateReleaseCount++;
 		}
-		scheduledActivities.pop_front();
+
+		if (not isEnabled(activity)) {
+			discardedActivityCount++;
+		} else if (activity.requestID.applicationID == ApplicationId) {
+			const etl::span<const uint8_t> packet = scheduledRequests.get(activity.request);
+			Message request = MessageParser::parseEmbeddedTC(packet.data(), packet.size());
+			MessageParser::execute(request);
+		}
+		removeActivity(nextActivity, JournalRecordType::ActivityReleased);
+		releasedActivities++;
 	}
 
-	if (!scheduledActivities.empty()) {
-		return scheduledActivities.front().requestReleaseTime;
+	if (not scheduledActivities.empty()) {
+		return scheduledActivities.get(scheduledActivities.front())->requestReleaseTime;
 	}
 	return Time::DefaultCUC::max();
 }
@@ -27,6 +50,7 @@ void TimeBasedSchedulingService::enableScheduleExecution(const Message& request)
 		return;
 	}
 	executionFunctionStatus = true;
+	journalStatus();
 }
 
 void TimeBasedSchedulingService::disableScheduleExecution(const Message& request) {
@@ -34,6 +58,7 @@ void TimeBasedSchedulingService::disableScheduleExecution(const Message& request
 		return;
 	}
 	executionFunctionStatus = false;
+	journalStatus();
 }
 
 void TimeBasedSchedulingService::resetSchedule(const Message& request) {
@@ -41,8 +66,29 @@ void TimeBasedSchedulingService::resetSchedule(const Message& request) {
 		return;
 	}
 	executionFunctionStatus = false;
+	clearSchedule();
+	resetSubSchedulesAndGroups();
+
+	if (isJournaling()) {
+		Journal::RecordOf<JournalRecordType> record;
+		record.append(JournalRecordType::ScheduleReset);
+		writeJournalRecord(record);
+	}
+}
+
+void TimeBasedSchedulingService::clearSchedule() {
 	scheduledActivities.clear();
-	// todo (#264): Add resetting for sub-schedules and groups, if defined
+	requestIDIndex.clear();
+	scheduledRequests.clear();
+	activitiesPerGroup.fill(0);
+}
+
+void TimeBasedSchedulingService::resetSubSchedulesAndGroups() {
+	enabledSubSchedules.set();
+	definedGroups.reset();
+	enabledGroups.reset();
+	definedGroups.set(DefaultGroup);
+	enabledGroups.set(DefaultGroup);
 }
 
 void TimeBasedSchedulingService::insertActivities(Message& request) {
@@ -50,33 +96,54 @@ void TimeBasedSchedulingService::insertActivities(Message& request) {
 		return;
 	}
 
-	// todo (#228): Get the sub-schedule ID if they are implemented
+	SubScheduleId subScheduleID = 0;
+#if SUB_SCHEDULES_ENABLED
+	subScheduleID = request.read<SubScheduleId>();
+	if (subScheduleID >= ECSSMaxTimeSchedSubSchedules) {
+		ErrorHandler::reportError(request, ErrorHandler::InvalidSubScheduleId);
+		return;
+	}
+#endif
+
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		// todo (#229): Get the group ID first, if groups are used
+		SchedulingGroupId groupID = DefaultGroup;
+#if GROUPS_ENABLED
+		groupID = request.read<SchedulingGroupId>();
+#endif
 		const Time::DefaultCUC currentTime(TimeGetter::getCurrentTimeDefaultCUC());
 
 		const Time::DefaultCUC releaseTime(request.readDefaultCUCTimeStamp());
-		if ((scheduledActivities.available() == 0) || (releaseTime < (currentTime + ECSSTimeMarginForActivation))) {
+		const etl::span<const uint8_t> packet = request.readPacket();
+		if (packet.empty()) {
+			break;
+		}
+
+		if (scheduledActivities.full() || (releaseTime < (currentTime + ECSSTimeMarginForActivation))) {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
-			request.skipBytes(ECSSTCRequestStringSize);
-		} else {
-			etl::array<uint8_t, ECSSTCRequestStringSize> requestData = {0};
-			request.readString(requestData.data(), ECSSTCRequestStringSize);
-			const Message receivedTCPacket = MessageParser::parseECSSTC(requestData.data());
-			ScheduledActivity newActivity;
+			continue;
+		}
+		if (groupID >= ECSSMaxTimeSchedGroups or not definedGroups[groupID]) {
+			ErrorHandler::reportError(request, ErrorHandler::InvalidSchedulingGroupId);
+			continue;
+		}
 
-			newActivity.request = receivedTCPacket;
-			newActivity.requestReleaseTime = releaseTime;
+		ScheduledActivity newActivity;
+		newActivity.request = scheduledRequests.store(packet.data(), packet.size());
+		if (not newActivity.request.isValid()) {
+			ErrorHandler::reportError(request, ErrorHandler::TelecommandStorageIsFull);
+			continue;
+		}
+		newActivity.requestReleaseTime = releaseTime;
+		newActivity.subScheduleID = subScheduleID;
+		newActivity.groupID = groupID;
 
-			newActivity.requestID.sourceID = request.sourceId;
-			newActivity.requestID.applicationID = request.applicationId;
-			newActivity.requestID.sequenceCount = request.packetSequenceCount;
+		newActivity.requestID.sourceID = request.sourceId;
+		newActivity.requestID.applicationID = request.applicationId;
+		newActivity.requestID.sequenceCount = request.packetSequenceCount;
 
-			scheduledActivities.push_back(newActivity);
-		}
+		addActivity(newActivity);
 	}
-	sortActivitiesReleaseTime(scheduledActivities);
 	notifyNewActivityAddition();
 }
 
@@ -87,19 +154,23 @@ void TimeBasedSchedulingService::timeShiftAllActivities(Message& request) {
 
 	const Time::DefaultCUC current_time(TimeGetter::getCurrentTimeDefaultCUC());
 
-	const auto releaseTimes =
-	    etl::minmax_element(scheduledActivities.begin(), scheduledActivities.end(),
-	                        [](ScheduledActivity const& leftSide, ScheduledActivity const& rightSide) {
-		                        return leftSide.requestReleaseTime < rightSide.requestReleaseTime;
-	                        });
 	// todo (#267): Define what the time format is going to be
 	const Time::RelativeTime relativeOffset = request.readRelativeTime();
-	if ((releaseTimes.first->requestReleaseTime + std::chrono::seconds(relativeOffset)) < (current_time + ECSSTimeMarginForActivation)) {
+	if (scheduledActivities.empty()) {
+		return;
+	}
+	const ScheduledActivity& earliestActivity = *scheduledActivities.get(scheduledActivities.front());
+	if ((earliestActivity.requestReleaseTime + std::chrono::seconds(relativeOffset)) < (current_time + ECSSTimeMarginForActivation)) {
 		ErrorHandler::reportError(request, ErrorHandler::SubServiceExecutionStartError);
 		return;
 	}
-	for (auto& activity: scheduledActivities) {
-		activity.requestReleaseTime += std::chrono::seconds(relativeOffset);
+	scheduledActivities.shiftAll(std::chrono::seconds(relativeOffset));
+
+	if (isJournaling()) {
+		Journal::RecordOf<JournalRecordType, Time::RelativeTime> record;
+		record.append(JournalRecordType::AllActivitiesShifted);
+		record.append(relativeOffset);
+		writeJournalRecord(record);
 	}
 }
 
@@ -113,28 +184,27 @@ void TimeBasedSchedulingService::timeShiftActivitiesByID(Message& request) {
 	auto relativeOffset = std::chrono::seconds(request.readRelativeTime());
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.read<SourceId>();
-		receivedRequestID.applicationID = request.read<ApplicationProcessId>();
-		receivedRequestID.sequenceCount = request.read<SequenceCount>();
-
-		auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                       [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                       return receivedRequestID != currentElement.requestID;
-		                                       });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			if ((requestIDMatch->requestReleaseTime + relativeOffset) <
-			    (current_time + ECSSTimeMarginForActivation)) {
+		const ActivityIndex requestIDMatch = findActivity(readRequestID(request));
+
+		if (requestIDMatch != Schedule::NoActivity) {
+			const Time::DefaultCUC releaseTime = scheduledActivities.get(requestIDMatch)->requestReleaseTime + relativeOffset;
+			if (releaseTime < (current_time + ECSSTimeMarginForActivation)) {
 				ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 			} else {
-				requestIDMatch->requestReleaseTime += relativeOffset;
+				scheduledActivities.retime(requestIDMatch, releaseTime);
+
+				if (isJournaling()) {
+					Journal::RecordOf<JournalRecordType, ActivityIndex, uint32_t> record;
+					record.append(JournalRecordType::ActivityRetimed);
+					record.append(requestIDMatch);
+					record.append(releaseTime.formatAsBytes());
+					writeJournalRecord(record);
+				}
 			}
 		} else {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 		}
 	}
-	sortActivitiesReleaseTime(scheduledActivities);
 }
 
 void TimeBasedSchedulingService::deleteActivitiesByID(Message& request) {
@@ -144,18 +214,10 @@ void TimeBasedSchedulingService::deleteActivitiesByID(Message& request) {
 
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.read<SourceId>();
-		receivedRequestID.applicationID = request.read<ApplicationProcessId>();
-		receivedRequestID.sequenceCount = request.read<SequenceCount>();
-
-		const auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                             [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                             return receivedRequestID != currentElement.requestID;
-		                                             });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			scheduledActivities.erase(requestIDMatch);
+		const ActivityIndex requestIDMatch = findActivity(readRequestID(request));
+
+		if (requestIDMatch != Schedule::NoActivity) {
+			removeActivity(requestIDMatch, JournalRecordType::ActivityDeleted);
 		} else {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 		}
@@ -167,89 +229,282 @@ void TimeBasedSchedulingService::detailReportAllActivities(const Message& reques
 		return;
 	}
 
-	timeBasedScheduleDetailReport(scheduledActivities);
+	Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduleReportById);
+	report.appendUint16(static_cast<uint16_t>(scheduledActivities.size()));
+	scheduledActivities.forEachInReleaseOrder([this, &report](ActivityIndex /* index */, const ScheduledActivity& activity) {
+		appendActivityDetails(report, activity);
+	});
+	storeMessage(report);
+}
+
+void TimeBasedSchedulingService::appendActivityDetails(Message& report, const ScheduledActivity& activity) const {
+#if SUB_SCHEDULES_ENABLED
+	report.append<SubScheduleId>(activity.subScheduleID);
+#endif
+#if GROUPS_ENABLED
+	report.append<SchedulingGroupId>(activity.groupID);
+#endif
+	report.appendDefaultCUCTimeStamp(activity.requestReleaseTime); // todo (#267): Replace with the time parser
+	report.appendPacket(scheduledRequests.get(activity.request));
 }
 
-void TimeBasedSchedulingService::timeBasedScheduleDetailReport(const etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& listOfActivities) {
-	// todo (#228): (#229) append sub-schedule and group ID if they are defined
+void TimeBasedSchedulingService::timeBasedScheduleDetailReport(const ActivityIndexList& listOfActivities) {
 	Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduleReportById);
 	report.appendUint16(static_cast<uint16_t>(listOfActivities.size()));
 
-	for (const auto& activity: listOfActivities) {
-		report.appendDefaultCUCTimeStamp(activity.requestReleaseTime); // todo (#267): Replace with the time parser
-		report.appendString(MessageParser::composeECSS(activity.request));
+	for (const ActivityIndex index: listOfActivities) {
+		appendActivityDetails(report, *scheduledActivities.get(index));
 	}
 	storeMessage(report);
 }
 
-void TimeBasedSchedulingService::detailReportActivitiesByID(Message& request) {
-	if (!request.assertTC(ServiceType, MessageType::DetailReportActivitiesById)) {
+TimeBasedSchedulingService::RequestID TimeBasedSchedulingService::readRequestID(Message& request) {
+	RequestID requestID;
+	requestID.sourceID = request.read<SourceId>();
+	requestID.applicationID = request.read<ApplicationProcessId>();
+	requestID.sequenceCount = request.read<SequenceCount>();
+	return requestID;
+}
+
+TimeBasedSchedulingService::ActivityIndex TimeBasedSchedulingService::findActivity(const RequestID& requestID) {
+	ActivityIndex match = Schedule::NoActivity;
+	requestIDIndex.forEachMatch(requestID, [this, &match](ActivityIndex index) {
+		if (match == Schedule::NoActivity or scheduledActivities.isReleasedBefore(index, match)) {
+			match = index;
+		}
+	});
+	return match;
+}
+
+void TimeBasedSchedulingService::addActivity(const ScheduledActivity& activity) {
+	const ActivityIndex index = scheduledActivities.insert(activity);
+	if (index != Schedule::NoActivity) {
+		requestIDIndex.insert(activity.requestID, index);
+		activitiesPerGroup[activity.groupID]++;
+		journalActivity(JournalRecordType::ActivityInserted, index);
+	}
+}
+
+void TimeBasedSchedulingService::removeActivity(ActivityIndex index, JournalRecordType reason) {
+	const ScheduledActivity* activity = scheduledActivities.get(index);
+	if (activity == nullptr) {
+		return;
+	}
+	requestIDIndex.erase(activity->requestID, index);
+	activitiesPerGroup[activity->groupID]--;
+	scheduledRequests.release(activity->request);
+	scheduledActivities.remove(index);
+	journalActivity(reason, index);
+}
+
+template <size_t Capacity>
+void TimeBasedSchedulingService::writeJournalRecord(const Journal::Record<Capacity>& record,
+                                                    etl::span<const uint8_t> payload) {
+	if (not isJournaling()) {
 		return;
 	}
+	// The change is already applied, so when the journal is full, the snapshot contains it
+	if (journalIsStale or not journal.append(record, payload)) {
+		compactJournal();
+	}
+}
 
-	etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> matchedActivities;
+void TimeBasedSchedulingService::journalActivity(JournalRecordType type, ActivityIndex index) {
+	if (not isJournaling()) {
+		return;
+	}
 
-	uint16_t iterationCount = request.readUint16();
-	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.read<SourceId>();
-		receivedRequestID.applicationID = request.read<ApplicationProcessId>();
-		receivedRequestID.sequenceCount = request.read<SequenceCount>();
-
-		const auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                             [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                             return receivedRequestID != currentElement.requestID;
-		                                             });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			matchedActivities.push_back(*requestIDMatch);
-		} else {
-			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
-		}
+	if (type == JournalRecordType::ActivityInserted) {
+		const ScheduledActivity& activity = *scheduledActivities.get(index);
+		writeJournalRecord(insertionRecord(index, activity), scheduledRequests.get(activity.request));
+	} else {
+		Journal::RecordOf<JournalRecordType, ActivityIndex> record;
+		record.append(type);
+		record.append(index);
+		writeJournalRecord(record);
 	}
+}
 
-	sortActivitiesReleaseTime(matchedActivities);
+TimeBasedSchedulingService::InsertionRecord TimeBasedSchedulingService::insertionRecord(ActivityIndex index,
+                                                                                        const ScheduledActivity& activity) const {
+	const etl::span<const uint8_t> packet = scheduledRequests.get(activity.request);
+	InsertionRecord record;
+	record.append(JournalRecordType::ActivityInserted);
+	record.append(index);
+	record.append(activity.requestID.sourceID);
+	record.append(activity.requestID.applicationID);
+	record.append(activity.requestID.sequenceCount);
+	record.append(activity.subScheduleID);
+	record.append(activity.groupID);
+	record.append(activity.requestReleaseTime.formatAsBytes());
+	record.append(static_cast<uint16_t>(packet.size()));
+	return record;
+}
 
-	timeBasedScheduleDetailReport(matchedActivities);
+TimeBasedSchedulingService::StatusRecord TimeBasedSchedulingService::statusRecord() const {
+	static_assert(ECSSMaxTimeSchedSubSchedules <= 32 and ECSSMaxTimeSchedGroups <= 32,
+	              "The status of the sub-schedules and groups is journaled as 32-bit masks");
+	StatusRecord record;
+	record.append(JournalRecordType::ScheduleStatus);
+	record.append(executionFunctionStatus);
+	record.append(static_cast<uint32_t>(enabledSubSchedules.to_ulong()));
+	record.append(static_cast<uint32_t>(definedGroups.to_ulong()));
+	record.append(static_cast<uint32_t>(enabledGroups.to_ulong()));
+	return record;
 }
 
-void TimeBasedSchedulingService::summaryReportActivitiesByID(Message& request) {
-	if (!request.assertTC(ServiceType, MessageType::ActivitiesSummaryReportById)) {
+void TimeBasedSchedulingService::journalStatus() {
+	if (isJournaling()) {
+		writeJournalRecord(statusRecord());
+	}
+}
+
+void TimeBasedSchedulingService::attachJournal(etl::span<uint8_t> region) {
+	restoringJournal = true;
+	journalIsStale = false;
+	executionFunctionStatus = false;
+	clearSchedule();
+	resetSubSchedulesAndGroups();
+	journal.attach(region, [this](etl::span<const uint8_t> record) {
+		applyJournalRecord(record);
+	});
+	scheduledActivities.rebuildFreeList();
+	restoringJournal = false;
+}
+
+void TimeBasedSchedulingService::applyJournalRecord(etl::span<const uint8_t> record) {
+	Journal::RecordReader reader(record);
+	const auto readReleaseTime = [&reader]() {
+		return Time::DefaultCUC(std::chrono::duration<uint32_t, Time::DefaultCUC::Ratio>(reader.read<uint32_t>()));
+	};
+
+	switch (reader.read<JournalRecordType>()) {
+		case JournalRecordType::ActivityInserted: {
+			const auto index = reader.read<ActivityIndex>();
+			ScheduledActivity activity;
+			activity.requestID.sourceID = reader.read<SourceId>();
+			activity.requestID.applicationID = reader.read<ApplicationProcessId>();
+			activity.requestID.sequenceCount = reader.read<SequenceCount>();
+			activity.subScheduleID = reader.read<SubScheduleId>();
+			activity.groupID = reader.read<SchedulingGroupId>();
+			activity.requestReleaseTime = readReleaseTime();
+			const etl::span<const uint8_t> packet = reader.readBytes(reader.read<uint16_t>());
+			if (activity.subScheduleID >= ECSSMaxTimeSchedSubSchedules or activity.groupID >= ECSSMaxTimeSchedGroups) {
+				break;
+			}
+
+			activity.request = scheduledRequests.store(packet.data(), packet.size());
+			if (not activity.request.isValid()) {
+				break;
+			}
+			if (not scheduledActivities.insertAt(index, activity)) {
+				scheduledRequests.release(activity.request);
+				break;
+			}
+			requestIDIndex.insert(activity.requestID, index);
+			activitiesPerGroup[activity.groupID]++;
+			break;
+		}
+		case JournalRecordType::ActivityDeleted:
+		case JournalRecordType::ActivityReleased:
+			removeActivity(reader.read<ActivityIndex>(), JournalRecordType::ActivityDeleted);
+			break;
+		case JournalRecordType::ActivityRetimed: {
+			const auto index = reader.read<ActivityIndex>();
+			scheduledActivities.retime(index, readReleaseTime());
+			break;
+		}
+		case JournalRecordType::AllActivitiesShifted:
+			scheduledActivities.shiftAll(std::chrono::seconds(reader.read<Time::RelativeTime>()));
+			break;
+		case JournalRecordType::ScheduleReset:
+			executionFunctionStatus = false;
+			clearSchedule();
+			resetSubSchedulesAndGroups();
+			break;
+		case JournalRecordType::ScheduleStatus:
+			executionFunctionStatus = reader.read<bool>();
+			enabledSubSchedules = decltype(enabledSubSchedules)(reader.read<uint32_t>());
+			definedGroups = decltype(definedGroups)(reader.read<uint32_t>());
+			enabledGroups = decltype(enabledGroups)(reader.read<uint32_t>());
+			definedGroups.set(DefaultGroup);
+			break;
+	}
+}
+
+void TimeBasedSchedulingService::compactJournal() {
+	if (not journal.isAttached()) {
 		return;
 	}
 
-	etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities> matchedActivities;
+	journal.beginSnapshot();
+	bool complete = journal.append(statusRecord());
+
+	// The activities are written in release order, so that activities with equal release times keep their order
+	scheduledActivities.forEachInReleaseOrder([this, &complete](ActivityIndex index, const ScheduledActivity& activity) {
+		if (complete) {
+			complete = journal.append(insertionRecord(index, activity), scheduledRequests.get(activity.request));
+		}
+	});
+
+	journalIsStale = not complete;
+	if (complete) {
+		journal.commitSnapshot();
+	} else {
+		journal.abortSnapshot();
+		ErrorHandler::reportInternalError(ErrorHandler::ScheduleJournalIsFull);
+	}
+}
 
+void TimeBasedSchedulingService::collectActivitiesByID(Message& request, ActivityIndexList& matchedActivities) {
 	uint16_t iterationCount = request.readUint16();
 	while (iterationCount-- != 0) {
-		RequestID receivedRequestID;
-		receivedRequestID.sourceID = request.read<SourceId>();
-		receivedRequestID.applicationID = request.read<ApplicationProcessId>();
-		receivedRequestID.sequenceCount = request.read<SequenceCount>();
-
-		auto requestIDMatch = etl::find_if_not(scheduledActivities.begin(), scheduledActivities.end(),
-		                                       [&receivedRequestID](ScheduledActivity const& currentElement) {
-			                                       return receivedRequestID != currentElement.requestID;
-		                                       });
-
-		if (requestIDMatch != scheduledActivities.end()) {
-			matchedActivities.push_back(*requestIDMatch);
+		const ActivityIndex requestIDMatch = findActivity(readRequestID(request));
+
+		if (requestIDMatch != Schedule::NoActivity and not matchedActivities.full()) {
+			matchedActivities.push_back(requestIDMatch);
 		} else {
 			ErrorHandler::reportError(request, ErrorHandler::InstructionExecutionStartError);
 		}
 	}
-	sortActivitiesReleaseTime(matchedActivities);
 
+	etl::sort(matchedActivities.begin(), matchedActivities.end(), [this](ActivityIndex leftSide, ActivityIndex rightSide) {
+		return scheduledActivities.isReleasedBefore(leftSide, rightSide);
+	});
+}
+
+void TimeBasedSchedulingService::detailReportActivitiesByID(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DetailReportActivitiesById)) {
+		return;
+	}
+
+	ActivityIndexList matchedActivities;
+	collectActivitiesByID(request, matchedActivities);
+	timeBasedScheduleDetailReport(matchedActivities);
+}
+
+void TimeBasedSchedulingService::summaryReportActivitiesByID(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::ActivitiesSummaryReportById)) {
+		return;
+	}
+
+	ActivityIndexList matchedActivities;
+	collectActivitiesByID(request, matchedActivities);
 	timeBasedScheduleSummaryReport(matchedActivities);
 }
 
-void TimeBasedSchedulingService::timeBasedScheduleSummaryReport(const etl::list<ScheduledActivity, ECSSMaxNumberOfTimeSchedActivities>& listOfActivities) {
+void TimeBasedSchedulingService::timeBasedScheduleSummaryReport(const ActivityIndexList& listOfActivities) {
 	Message report = createTM(TimeBasedSchedulingService::MessageType::TimeBasedScheduledSummaryReport);
 
-	// todo (#228): append sub-schedule and group ID if they are defined
 	report.appendUint16(static_cast<uint16_t>(listOfActivities.size()));
-	for (const auto& match: listOfActivities) {
-		// todo (#229): append sub-schedule and group ID if they are defined
+	for (const ActivityIndex index: listOfActivities) {
+		const ScheduledActivity& match = *scheduledActivities.get(index);
+#if SUB_SCHEDULES_ENABLED
+		report.append<SubScheduleId>(match.subScheduleID);
+#endif
+#if GROUPS_ENABLED
+		report.append<SchedulingGroupId>(match.groupID);
+#endif
 		report.appendDefaultCUCTimeStamp(match.requestReleaseTime);
 		report.append<SourceId>(match.requestID.sourceID);
 		report.append<ApplicationProcessId>(match.requestID.applicationID);
@@ -258,6 +513,169 @@ void TimeBasedSchedulingService::timeBasedScheduleSummaryReport(const etl::list<
 	storeMessage(report);
 }
 
+void TimeBasedSchedulingService::reportSubScheduleStatus(const Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::ReportSubScheduleStatus)) {
+		return;
+	}
+	subScheduleStatusReport();
+}
+
+void TimeBasedSchedulingService::subScheduleStatusReport() {
+	Message report = createTM(TimeBasedSchedulingService::MessageType::SubScheduleStatusReport);
+	report.appendUint16(ECSSMaxTimeSchedSubSchedules);
+	for (SubScheduleId subScheduleID = 0; subScheduleID < ECSSMaxTimeSchedSubSchedules; subScheduleID++) {
+		report.append<SubScheduleId>(subScheduleID);
+		report.appendBoolean(enabledSubSchedules[subScheduleID]);
+	}
+	storeMessage(report);
+}
+
+void TimeBasedSchedulingService::setSubScheduleStatus(Message& request, bool status) {
+	uint16_t iterationCount = request.readUint16();
+	if (iterationCount == 0) {
+		if (status) {
+			enabledSubSchedules.set();
+		} else {
+			enabledSubSchedules.reset();
+		}
+		return;
+	}
+	while (iterationCount-- != 0) {
+		const SubScheduleId subScheduleID = request.read<SubScheduleId>();
+		if (subScheduleID >= ECSSMaxTimeSchedSubSchedules) {
+			ErrorHandler::reportError(request, ErrorHandler::InvalidSubScheduleId);
+			continue;
+		}
+		enabledSubSchedules.set(subScheduleID, status);
+	}
+}
+
+void TimeBasedSchedulingService::enableSubSchedules(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::EnableSubSchedules)) {
+		return;
+	}
+	setSubScheduleStatus(request, true);
+	journalStatus();
+}
+
+void TimeBasedSchedulingService::disableSubSchedules(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DisableSubSchedules)) {
+		return;
+	}
+	setSubScheduleStatus(request, false);
+	journalStatus();
+}
+
+void TimeBasedSchedulingService::createGroups(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::CreateSchedulingGroups)) {
+		return;
+	}
+
+	uint16_t iterationCount = request.readUint16();
+	while (iterationCount-- != 0) {
+		const SchedulingGroupId groupID = request.read<SchedulingGroupId>();
+		const bool status = request.readBoolean();
+		if (groupID >= ECSSMaxTimeSchedGroups) {
+			ErrorHandler::reportError(request, ErrorHandler::InvalidSchedulingGroupId);
+			continue;
+		}
+		if (definedGroups[groupID]) {
+			ErrorHandler::reportError(request, ErrorHandler::SchedulingGroupAlreadyExists);
+			continue;
+		}
+		definedGroups.set(groupID);
+		enabledGroups.set(groupID, status);
+	}
+	journalStatus();
+}
+
+void TimeBasedSchedulingService::deleteGroup(const Message& request, SchedulingGroupId groupID) {
+	if (groupID >= ECSSMaxTimeSchedGroups or groupID == DefaultGroup or not definedGroups[groupID]) {
+		ErrorHandler::reportError(request, ErrorHandler::InvalidSchedulingGroupId);
+		return;
+	}
+	if (activitiesPerGroup[groupID] != 0) {
+		ErrorHandler::reportError(request, ErrorHandler::SchedulingGroupIsNotEmpty);
+		return;
+	}
+	definedGroups.reset(groupID);
+	enabledGroups.reset(groupID);
+}
+
+void TimeBasedSchedulingService::deleteGroups(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DeleteSchedulingGroups)) {
+		return;
+	}
+
+	uint16_t iterationCount = request.readUint16();
+	if (iterationCount == 0) {
+		for (SchedulingGroupId groupID = 0; groupID < ECSSMaxTimeSchedGroups; groupID++) {
+			if (groupID != DefaultGroup and definedGroups[groupID]) {
+				deleteGroup(request, groupID);
+			}
+		}
+	}
+	while (iterationCount-- != 0) {
+		deleteGroup(request, request.read<SchedulingGroupId>());
+	}
+	journalStatus();
+}
+
+void TimeBasedSchedulingService::setGroupStatus(Message& request, bool status) {
+	uint16_t iterationCount = request.readUint16();
+	if (iterationCount == 0) {
+		if (status) {
+			enabledGroups = definedGroups;
+		} else {
+			enabledGroups.reset();
+		}
+		return;
+	}
+	while (iterationCount-- != 0) {
+		const SchedulingGroupId groupID = request.read<SchedulingGroupId>();
+		if (groupID >= ECSSMaxTimeSchedGroups or not definedGroups[groupID]) {
+			ErrorHandler::reportError(request, ErrorHandler::InvalidSchedulingGroupId);
+			continue;
+		}
+		enabledGroups.set(groupID, status);
+	}
+}
+
+void TimeBasedSchedulingService::enableGroups(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::EnableSchedulingGroups)) {
+		return;
+	}
+	setGroupStatus(request, true);
+	journalStatus();
+}
+
+void TimeBasedSchedulingService::disableGroups(Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::DisableSchedulingGroups)) {
+		return;
+	}
+	setGroupStatus(request, false);
+	journalStatus();
+}
+
+void TimeBasedSchedulingService::reportGroupStatus(const Message& request) {
+	if (!request.assertTC(ServiceType, MessageType::ReportSchedulingGroupStatus)) {
+		return;
+	}
+	groupStatusReport();
+}
+
+void TimeBasedSchedulingService::groupStatusReport() {
+	Message report = createTM(TimeBasedSchedulingService::MessageType::SchedulingGroupStatusReport);
+	report.appendUint16(static_cast<uint16_t>(definedGroups.count()));
+	for (SchedulingGroupId groupID = 0; groupID < ECSSMaxTimeSchedGroups; groupID++) {
+		if (definedGroups[groupID]) {
+			report.append<SchedulingGroupId>(groupID);
+			report.appendBoolean(enabledGroups[groupID]);
+		}
+	}
+	storeMessage(report);
+}
+
 void TimeBasedSchedulingService::execute(Message& message) {
 	switch (message.messageType) {
 		case EnableTimeBasedScheduleExecutionFunction:
@@ -290,6 +708,30 @@ void TimeBasedSchedulingService::execute(Message& message) {
 		case DetailReportAllScheduledActivities:
 			detailReportAllActivities(message);
 			break;
+		case ReportSubScheduleStatus:
+			reportSubScheduleStatus(message);
+			break;
+		case EnableSubSchedules:
+			enableSubSchedules(message);
+			break;
+		case DisableSubSchedules:
+			disableSubSchedules(message);
+			break;
+		case CreateSchedulingGroups:
+			createGroups(message);
+			break;
+		case DeleteSchedulingGroups:
+			deleteGroups(message);
+			break;
+		case EnableSchedulingGroups:
+			enableGroups(message);
+			break;
+		case DisableSchedulingGroups:
+			disableGroups(message);
+			break;
+		case ReportSchedulingGroupStatus:
+			reportGroupStatus(message);
+			break;
 		default:
 			ErrorHandler::reportInternalError(ErrorHandler::OtherMessageType);
 	}
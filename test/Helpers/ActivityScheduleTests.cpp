@@ -0,0 +1,116 @@
+#include <memory>
+#include "Helpers/ActivitySchedule.hpp"
+#include "Time/TimeStamp.hpp"
+#include "catch2/catch_all.hpp"
+#include "etl/vector.h"
+
+namespace {
+	struct TestActivity {
+		Time::DefaultCUC requestReleaseTime;
+		uint32_t id = 0;
+	};
+
+	template <size_t Capacity>
+	etl::vector<uint32_t, Capacity> releaseOrder(ActivitySchedule<TestActivity, Capacity>& schedule) {
+		etl::vector<uint32_t, Capacity> ids;
+		schedule.forEachInReleaseOrder([&ids](auto /* index */, const TestActivity& activity) {
+			ids.push_back(activity.id);
+		});
+		return ids;
+	}
+
+	TestActivity activityAt(uint32_t seconds, uint32_t id) {
+		return {Time::DefaultCUC(0) + std::chrono::seconds(seconds), id};
+	}
+} // namespace
+
+TEST_CASE("Activity schedule insertion and removal") {
+	ActivitySchedule<TestActivity, 4> schedule;
+	CHECK(schedule.empty());
+	CHECK(schedule.front() == ActivitySchedule<TestActivity, 4>::NoActivity);
+
+	schedule.insert(activityAt(30, 1));
+	const auto second = schedule.insert(activityAt(10, 2));
+	schedule.insert(activityAt(20, 3));
+	schedule.insert(activityAt(10, 4));
+	CHECK(schedule.full());
+	CHECK(schedule.insert(activityAt(5, 5)) == ActivitySchedule<TestActivity, 4>::NoActivity);
+
+	CHECK(schedule.get(schedule.front())->id == 2);
+	CHECK(releaseOrder(schedule) == etl::vector<uint32_t, 4>{2, 4, 3, 1});
+
+	schedule.remove(second);
+	CHECK(schedule.get(second) == nullptr);
+	CHECK(schedule.size() == 3);
+	CHECK(schedule.get(schedule.front())->id == 4);
+
+	schedule.insert(activityAt(15, 6));
+	CHECK(releaseOrder(schedule) == etl::vector<uint32_t, 4>{4, 6, 3, 1});
+
+	schedule.popFront();
+	schedule.popFront();
+	CHECK(releaseOrder(schedule) == etl::vector<uint32_t, 4>{3, 1});
+
+	schedule.clear();
+	CHECK(schedule.empty());
+	CHECK(schedule.available() == 4);
+}
+
+TEST_CASE("Activity schedule retiming") {
+	ActivitySchedule<TestActivity, 8> schedule;
+	etl::vector<ActivitySchedule<TestActivity, 8>::Index, 8> indices;
+	for (uint32_t id = 0; id < 8; id++) {
+		indices.push_back(schedule.insert(activityAt(10 * id, id)));
+	}
+
+	schedule.retime(indices[0], Time::DefaultCUC(0) + std::chrono::seconds(75));
+	schedule.retime(indices[6], Time::DefaultCUC(0) + std::chrono::seconds(5));
+	CHECK(releaseOrder(schedule) == etl::vector<uint32_t, 8>{6, 1, 2, 3, 4, 5, 7, 0});
+
+	schedule.shiftAll(std::chrono::seconds(100));
+	CHECK(schedule.get(schedule.front())->requestReleaseTime == Time::DefaultCUC(0) + std::chrono::seconds(105));
+	CHECK(releaseOrder(schedule) == etl::vector<uint32_t, 8>{6, 1, 2, 3, 4, 5, 7, 0});
+
+	Time::DefaultCUC previousReleaseTime(0);
+	while (not schedule.empty()) {
+		const TestActivity& activity = *schedule.get(schedule.front());
+		CHECK(previousReleaseTime <= activity.requestReleaseTime);
+		previousReleaseTime = activity.requestReleaseTime;
+		schedule.popFront();
+	}
+}
+
+TEST_CASE("Activity schedule benchmark", "[.][benchmark]") {
+	constexpr uint32_t NumberOfActivities = 100000;
+	using LargeSchedule = ActivitySchedule<TestActivity, NumberOfActivities>;
+	auto schedule = std::make_unique<LargeSchedule>();
+
+	BENCHMARK("Insert and release 100000 activities") {
+		for (uint32_t id = 0; id < NumberOfActivities; id++) {
+			schedule->insert(activityAt((id * 7919) % NumberOfActivities, id));
+		}
+		uint32_t released = 0;
+		while (not schedule->empty()) {
+			released += schedule->get(schedule->front())->id & 1U;
+			schedule->popFront();
+		}
+		return released;
+	};
+}
+
+TEST_CASE("Activity schedule insertion at given indices") {
+	ActivitySchedule<TestActivity, 4> schedule;
+
+	CHECK(schedule.insertAt(2, activityAt(30, 1)));
+	CHECK(schedule.insertAt(0, activityAt(10, 2)));
+	CHECK(not schedule.insertAt(2, activityAt(20, 3)));
+	CHECK(not schedule.insertAt(4, activityAt(20, 3)));
+	schedule.rebuildFreeList();
+
+	CHECK(schedule.size() == 2);
+	CHECK(schedule.front() == 0);
+	CHECK(schedule.insert(activityAt(20, 3)) == 1);
+	CHECK(schedule.insert(activityAt(40, 4)) == 3);
+	CHECK(schedule.full());
+	CHECK(releaseOrder(schedule) == etl::vector<uint32_t, 4>{2, 3, 1, 4});
+}
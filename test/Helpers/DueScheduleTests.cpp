@@ -0,0 +1,83 @@
+#include "Helpers/DueSchedule.hpp"
+#include "catch2/catch_all.hpp"
+#include "etl/array.h"
+
+namespace {
+	using Schedule = DueSchedule<uint8_t, 8>;
+
+	/**
+	 * The current due time of each job, as kept by the owner of a schedule
+	 */
+	struct Jobs {
+		etl::array<Time::DefaultCUC, 4> dueTimes{};
+		etl::array<bool, 4> exists{};
+
+		bool isCurrent(const Schedule::Entry& entry) const {
+			return exists[entry.key] and dueTimes[entry.key] == entry.dueTime;
+		}
+
+		void schedule(Schedule& schedule, uint8_t job, uint32_t dueTime) {
+			exists[job] = true;
+			dueTimes[job] = Time::DefaultCUC(dueTime);
+			schedule.schedule(job, dueTimes[job], [this](const Schedule::Entry& entry) {
+				return isCurrent(entry);
+			});
+		}
+	};
+} // namespace
+
+TEST_CASE("Due schedule takes the current due entries in time order") {
+	Schedule schedule;
+	Jobs jobs;
+	auto isCurrent = [&jobs](const Schedule::Entry& entry) {
+		return jobs.isCurrent(entry);
+	};
+
+	jobs.schedule(schedule, 0, 30);
+	jobs.schedule(schedule, 1, 10);
+	jobs.schedule(schedule, 2, 20);
+	jobs.schedule(schedule, 3, 15);
+
+	// Rescheduling and deleting jobs outdates their previous entries
+	jobs.schedule(schedule, 1, 25);
+	jobs.exists[3] = false;
+	CHECK(schedule.size() == 5);
+
+	Time::DefaultCUC nextDueTime;
+	REQUIRE(schedule.nextDueTime(isCurrent, nextDueTime));
+	CHECK(nextDueTime == Time::DefaultCUC(20));
+	CHECK(schedule.size() == 3);
+
+	Schedule::Entry dueEntry;
+	REQUIRE(schedule.takeDue(Time::DefaultCUC(25), isCurrent, dueEntry));
+	CHECK(dueEntry.key == 2);
+	REQUIRE(schedule.takeDue(Time::DefaultCUC(25), isCurrent, dueEntry));
+	CHECK(dueEntry.key == 1);
+	CHECK(dueEntry.dueTime == Time::DefaultCUC(25));
+	CHECK_FALSE(schedule.takeDue(Time::DefaultCUC(25), isCurrent, dueEntry));
+
+	jobs.exists[0] = false;
+	CHECK_FALSE(schedule.nextDueTime(isCurrent, nextDueTime));
+	CHECK(schedule.empty());
+}
+
+TEST_CASE("Due schedule purges the outdated entries when it is full") {
+	Schedule schedule;
+	Jobs jobs;
+
+	for (uint32_t time = 1; time <= Schedule::capacity(); time++) {
+		jobs.schedule(schedule, 0, time);
+	}
+	CHECK(schedule.size() == Schedule::capacity());
+
+	// Only the last entry of job 0 is kept
+	jobs.schedule(schedule, 1, 100);
+	CHECK(schedule.size() == 2);
+
+	auto isCurrent = [&jobs](const Schedule::Entry& entry) {
+		return jobs.isCurrent(entry);
+	};
+	Time::DefaultCUC nextDueTime;
+	REQUIRE(schedule.nextDueTime(isCurrent, nextDueTime));
+	CHECK(nextDueTime == Time::DefaultCUC(Schedule::capacity()));
+}
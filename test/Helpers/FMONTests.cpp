@@ -0,0 +1,133 @@
+#include <memory>
+#include "Helpers/FMON.hpp"
+#include "catch2/catch_all.hpp"
+#include "etl/bitset.h"
+
+namespace {
+	FMON makeFMON(FMONId id, uint16_t minimumFailingPMONs, std::initializer_list<ParameterId> PMONIds) {
+		FMON fmon;
+		fmon.id = id;
+		fmon.eventDefinitionId = id + 1;
+		fmon.minimumFailingPMONs = minimumFailingPMONs;
+		for (const ParameterId PMONId: PMONIds) {
+			fmon.PMONIds.push_back(PMONId);
+		}
+		return fmon;
+	}
+
+	const auto noPMONFailing = [](ParameterId /* PMONId */) {
+		return false;
+	};
+} // namespace
+
+TEST_CASE("Functional monitoring list storage") {
+	FMONList<2, 8, 16> list;
+
+	CHECK(list.add(makeFMON(3, 1, {1, 2}), noPMONFailing));
+	CHECK(list.add(makeFMON(5, 2, {2, 4}), [](ParameterId PMONId) {
+		return PMONId == 4;
+	}));
+	CHECK(list.full());
+	CHECK_FALSE(list.add(makeFMON(6, 1, {7}), noPMONFailing));
+
+	REQUIRE(list.find(5) != nullptr);
+	CHECK(list.find(5)->failingPMONs == 1);
+	CHECK(list.find(5)->checkingStatus == FMON::CheckingStatus::Running);
+	CHECK(list.find(6) == nullptr);
+	CHECK(list.find(100) == nullptr);
+
+	CHECK(list.isPMONUsed(2));
+	CHECK(list.isPMONUsed(4));
+	CHECK_FALSE(list.isPMONUsed(3));
+
+	list.remove(5);
+	CHECK(list.size() == 1);
+	CHECK(list.find(5) == nullptr);
+	CHECK(list.isPMONUsed(2));
+	CHECK_FALSE(list.isPMONUsed(4));
+
+	list.clear();
+	CHECK(list.size() == 0);
+	CHECK_FALSE(list.isPMONUsed(1));
+	CHECK_FALSE(list.isPMONUsed(2));
+}
+
+TEST_CASE("Functional monitoring list status updates") {
+	FMONList<2, 8, 16> list;
+	list.add(makeFMON(0, 1, {1, 2}), noPMONFailing);
+	list.add(makeFMON(1, 2, {2, 3}), noPMONFailing);
+
+	etl::vector<FMONId, 4> failedFMONs;
+	auto onFailure = [&failedFMONs](const FMON& fmon) {
+		failedFMONs.push_back(fmon.id);
+	};
+
+	list.updatePMONStatus(2, false, true, onFailure);
+	REQUIRE(failedFMONs.size() == 1);
+	CHECK(failedFMONs[0] == 0);
+	CHECK(list.find(0)->checkingStatus == FMON::CheckingStatus::Failed);
+	CHECK(list.find(1)->checkingStatus == FMON::CheckingStatus::Running);
+
+	list.updatePMONStatus(1, false, true, onFailure);
+	list.updatePMONStatus(3, true, true, onFailure);
+	CHECK(failedFMONs.size() == 1);
+	CHECK(list.find(0)->failingPMONs == 2);
+
+	list.updatePMONStatus(3, false, true, onFailure);
+	REQUIRE(failedFMONs.size() == 2);
+	CHECK(failedFMONs[1] == 1);
+
+	list.updatePMONStatus(2, true, false, onFailure);
+	CHECK(list.find(0)->checkingStatus == FMON::CheckingStatus::Failed);
+	CHECK(list.find(1)->checkingStatus == FMON::CheckingStatus::Running);
+
+	list.updatePMONStatus(1, true, false, onFailure);
+	CHECK(list.find(0)->checkingStatus == FMON::CheckingStatus::Running);
+	CHECK(list.find(0)->failingPMONs == 0);
+	CHECK(failedFMONs.size() == 2);
+}
+
+TEST_CASE("Functional monitoring list benchmark", "[.][benchmark]") {
+	constexpr size_t NumberOfFMONs = 1000;
+	constexpr size_t NumberOfPMONs = 10000;
+	using LargeFMONList = FMONList<NumberOfFMONs, NumberOfFMONs, NumberOfPMONs>;
+
+	auto list = std::make_unique<LargeFMONList>();
+	for (FMONId id = 0; id < NumberOfFMONs; id++) {
+		FMON fmon;
+		fmon.id = id;
+		fmon.minimumFailingPMONs = 2;
+		for (size_t i = 0; i < ECSSMaxPMONsPerFMON; i++) {
+			fmon.PMONIds.push_back(static_cast<ParameterId>((id * 7 + i * 1259) % NumberOfPMONs));
+		}
+		REQUIRE(list->add(fmon, noPMONFailing));
+	}
+
+	auto failingPMONs = std::make_unique<etl::bitset<NumberOfPMONs>>();
+	uint32_t failures = 0;
+	auto onFailure = [&failures](const FMON& /* fmon */) {
+		failures++;
+	};
+
+	BENCHMARK("1000 PMON status transitions") {
+		for (size_t i = 0; i < 1000; i++) {
+			const ParameterId PMONId = (i * 4099) % NumberOfPMONs;
+			const bool wasFailing = failingPMONs->test(PMONId);
+			failingPMONs->set(PMONId, not wasFailing);
+			list->updatePMONStatus(PMONId, wasFailing, not wasFailing, onFailure);
+		}
+		return failures;
+	};
+
+	BENCHMARK("Full rescan of 1000 FMONs") {
+		uint32_t failedFMONs = 0;
+		list->forEach([&failedFMONs, &failingPMONs](const FMON& fmon) {
+			uint16_t failing = 0;
+			for (const ParameterId PMONId: fmon.PMONIds) {
+				failing += failingPMONs->test(PMONId) ? 1 : 0;
+			}
+			failedFMONs += (failing >= fmon.minimumFailingPMONs) ? 1 : 0;
+		});
+		return failedFMONs;
+	};
+}
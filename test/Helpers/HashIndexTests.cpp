@@ -0,0 +1,67 @@
+#include "Helpers/HashIndex.hpp"
+#include "catch2/catch_all.hpp"
+#include "etl/vector.h"
+
+namespace {
+	/**
+	 * A poor hash, so that the keys collide and wrap around the end of the table
+	 */
+	struct CollidingHash {
+		uint32_t operator()(uint32_t key) const {
+			return 14 + key / 4;
+		}
+	};
+
+	template <typename Index>
+	etl::vector<uint32_t, 8> matches(const Index& index, uint32_t key) {
+		etl::vector<uint32_t, 8> values;
+		index.forEachMatch(key, [&values](uint32_t value) {
+			values.push_back(value);
+		});
+		return values;
+	}
+} // namespace
+
+TEST_CASE("Hash index insertion and lookup") {
+	HashIndex<uint32_t, uint32_t, 8, CollidingHash> index;
+
+	for (uint32_t key = 0; key < 6; key++) {
+		CHECK(index.insert(key, 10 * key));
+	}
+	CHECK(index.insert(3, 31));
+	CHECK(index.insert(7, 70));
+	CHECK(index.full());
+	CHECK_FALSE(index.insert(8, 80));
+
+	CHECK(matches(index, 0) == etl::vector<uint32_t, 8>{0});
+	CHECK(matches(index, 3) == etl::vector<uint32_t, 8>{30, 31});
+	CHECK(matches(index, 7) == etl::vector<uint32_t, 8>{70});
+	CHECK(matches(index, 6).empty());
+}
+
+TEST_CASE("Hash index removal") {
+	HashIndex<uint32_t, uint32_t, 8, CollidingHash> index;
+	for (uint32_t key = 0; key < 8; key++) {
+		index.insert(key, key);
+	}
+
+	CHECK(index.erase(1, 1));
+	CHECK_FALSE(index.erase(1, 1));
+	CHECK_FALSE(index.erase(2, 3));
+	CHECK(index.erase(4, 4));
+	CHECK(index.size() == 6);
+
+	for (uint32_t key = 0; key < 8; key++) {
+		if (key == 1 or key == 4) {
+			CHECK(matches(index, key).empty());
+		} else {
+			CHECK(matches(index, key) == etl::vector<uint32_t, 8>{key});
+		}
+	}
+
+	index.clear();
+	CHECK(index.size() == 0);
+	CHECK(matches(index, 0).empty());
+	CHECK(index.insert(0, 5));
+	CHECK(matches(index, 0) == etl::vector<uint32_t, 8>{5});
+}
@@ -0,0 +1,167 @@
+#include <chrono>
+#include <vector>
+#include "Helpers/Journal.hpp"
+#include "catch2/catch_all.hpp"
+
+namespace {
+	std::vector<uint32_t> replay(Journal& journal, etl::span<uint8_t> region, bool& found) {
+		std::vector<uint32_t> values;
+		found = journal.attach(region, [&values](etl::span<const uint8_t> record) {
+			Journal::RecordReader reader(record);
+			values.push_back(reader.read<uint32_t>());
+		});
+		return values;
+	}
+
+	bool appendValue(Journal& journal, uint32_t value) {
+		Journal::Record<8> record;
+		record.append(value);
+		return journal.append(record);
+	}
+} // namespace
+
+TEST_CASE("Journal records") {
+	etl::array<uint8_t, 72> region{};
+	Journal journal;
+	bool found = true;
+
+	CHECK(replay(journal, region, found).empty());
+	CHECK(not found);
+	CHECK(journal.isAttached());
+	CHECK(journal.capacity() == 32);
+
+	CHECK(appendValue(journal, 1));
+	CHECK(appendValue(journal, 2));
+	CHECK(appendValue(journal, 3));
+	CHECK(journal.usedBytes() == 24);
+
+	SECTION("Replay after a restart") {
+		Journal restarted;
+		CHECK(replay(restarted, region, found) == std::vector<uint32_t>{1, 2, 3});
+		CHECK(found);
+		CHECK(appendValue(restarted, 4));
+		CHECK(replay(restarted, region, found) == std::vector<uint32_t>{1, 2, 3, 4});
+	}
+
+	SECTION("Full journal") {
+		CHECK(appendValue(journal, 4));
+		CHECK(not appendValue(journal, 5));
+		CHECK(replay(journal, region, found) == std::vector<uint32_t>{1, 2, 3, 4});
+	}
+
+	SECTION("Interrupted write") {
+		region[8 + 16 + Journal::RecordOverhead] ^= 0xFFU;
+		Journal restarted;
+		CHECK(replay(restarted, region, found) == std::vector<uint32_t>{1, 2});
+		CHECK(appendValue(restarted, 4));
+		CHECK(replay(restarted, region, found) == std::vector<uint32_t>{1, 2, 4});
+	}
+
+	SECTION("Snapshot") {
+		journal.beginSnapshot();
+		CHECK(appendValue(journal, 6));
+
+		Journal interrupted;
+		CHECK(replay(interrupted, region, found) == std::vector<uint32_t>{1, 2, 3});
+
+		journal.commitSnapshot();
+		CHECK(appendValue(journal, 7));
+		Journal restarted;
+		CHECK(replay(restarted, region, found) == std::vector<uint32_t>{6, 7});
+	}
+
+	SECTION("Snapshot that does not fit") {
+		CHECK(appendValue(journal, 4));
+		journal.beginSnapshot();
+		CHECK(appendValue(journal, 6));
+		CHECK(appendValue(journal, 7));
+		CHECK(appendValue(journal, 8));
+		CHECK(appendValue(journal, 9));
+		CHECK(not appendValue(journal, 10));
+		journal.abortSnapshot();
+
+		// The active area is full, so nothing is appended to the abandoned snapshot instead
+		CHECK(journal.usedBytes() == 32);
+		CHECK(not appendValue(journal, 11));
+		CHECK(not journal.append(etl::array<uint8_t, 2>{}.data(), 2));
+		Journal restarted;
+		CHECK(replay(restarted, region, found) == std::vector<uint32_t>{1, 2, 3, 4});
+	}
+
+	SECTION("Records after an abandoned snapshot") {
+		journal.beginSnapshot();
+		CHECK(appendValue(journal, 6));
+		journal.abortSnapshot();
+		CHECK(journal.usedBytes() == 24);
+		CHECK(appendValue(journal, 4));
+		Journal restarted;
+		CHECK(replay(restarted, region, found) == std::vector<uint32_t>{1, 2, 3, 4});
+	}
+
+	SECTION("Detached journal") {
+		journal.detach();
+		CHECK(not appendValue(journal, 4));
+	}
+}
+
+TEST_CASE("Journal record fields") {
+	Journal::Record<12> record;
+	record.append(uint8_t{7});
+	record.append(uint32_t{123456});
+	const etl::array<uint8_t, 3> bytes = {1, 2, 3};
+	record.appendBytes(bytes.data(), bytes.size());
+	record.append(uint64_t{1}); // Does not fit
+	CHECK(record.size() == 8);
+
+	Journal::RecordReader reader(etl::span<const uint8_t>(record.data(), record.size()));
+	CHECK(reader.read<uint8_t>() == 7);
+	CHECK(reader.read<uint32_t>() == 123456);
+	const etl::span<const uint8_t> readBytes = reader.readBytes(3);
+	REQUIRE(readBytes.size() == 3);
+	CHECK(readBytes[2] == 3);
+	CHECK(reader.readBytes(1).empty());
+	CHECK(reader.read<uint16_t>() == 0);
+}
+
+TEST_CASE("Journal record throughput benchmark", "[.][benchmark]") {
+	constexpr uint32_t NumberOfRecords = 100000;
+	constexpr uint16_t PacketSize = 16;
+	std::vector<uint8_t> region(2 * NumberOfRecords * (Journal::RecordOverhead + 32) + 64);
+	const etl::array<uint8_t, PacketSize> packet{};
+
+	Journal journal;
+	journal.attach(region, [](etl::span<const uint8_t> /* record */) {});
+	const auto appendStart = std::chrono::steady_clock::now();
+	for (uint32_t index = 0; index < NumberOfRecords; index++) {
+		Journal::RecordOf<uint8_t, uint32_t, uint32_t, uint16_t> record;
+		record.append(uint8_t{1});
+		record.append(index);
+		record.append((index * 7919) % NumberOfRecords);
+		record.append(PacketSize);
+		journal.append(record, packet);
+	}
+	const auto appendTime = std::chrono::steady_clock::now() - appendStart;
+
+	uint32_t replayedRecords = 0;
+	uint32_t replayedBytes = 0;
+	const auto replayStart = std::chrono::steady_clock::now();
+	Journal restarted;
+	restarted.attach(region, [&replayedRecords, &replayedBytes](etl::span<const uint8_t> record) {
+		Journal::RecordReader reader(record);
+		reader.read<uint8_t>();
+		reader.read<uint32_t>();
+		reader.read<uint32_t>();
+		replayedBytes += reader.readBytes(reader.read<uint16_t>()).size();
+		replayedRecords++;
+	});
+	const auto replayTime = std::chrono::steady_clock::now() - replayStart;
+
+	CHECK(replayedRecords == NumberOfRecords);
+	CHECK(replayedBytes == NumberOfRecords * PacketSize);
+	using Microseconds = std::chrono::duration<double, std::micro>;
+	using Milliseconds = std::chrono::duration<double, std::milli>;
+	const double appendMicroseconds = Microseconds(appendTime).count() / NumberOfRecords;
+	const double replayMilliseconds = Milliseconds(replayTime).count();
+	WARN("Journal append: " << appendMicroseconds << " us per record, replay of " << NumberOfRecords
+	                        << " records: " << replayMilliseconds << " ms");
+}
@@ -0,0 +1,184 @@
+#include <vector>
+#include "Helpers/MessagePool.hpp"
+#include "../Services/ServiceTests.hpp"
+#include "Helpers/PacketStore.hpp"
+#include "ServicePool.hpp"
+#include "catch2/catch_all.hpp"
+
+namespace {
+	using SmallPool = MessagePool<2>;
+
+	/**
+	 * A handle that the wait function of a blocking pool releases, as another task would
+	 */
+	SmallPool::Handle heldHandle;
+
+	bool releaseHeldHandle() {
+		heldHandle.reset();
+		return true;
+	}
+
+	bool giveUp() {
+		return false;
+	}
+} // namespace
+
+TEST_CASE("Message pool handles") {
+	SmallPool pool;
+	CHECK(pool.available() == 2);
+
+	SmallPool::Handle report = pool.create(17, 2, Message::TM);
+	REQUIRE(report);
+	CHECK(report->serviceType == 17);
+	CHECK(report->messageType == 2);
+	CHECK(report->dataSize == 0);
+	CHECK(report.useCount() == 1);
+	report->appendUint16(0x1234);
+
+	SmallPool::Handle copy = report;
+	CHECK(copy.useCount() == 2);
+	CHECK(copy.get() == report.get());
+	CHECK(pool.size() == 1);
+
+	SmallPool::Handle moved = std::move(copy);
+	CHECK(moved.useCount() == 2);
+	CHECK_FALSE(copy); // NOLINT(bugprone-use-after-move)
+
+	report.reset();
+	CHECK(moved.useCount() == 1);
+	CHECK(moved->readUint16() == 0x1234);
+	moved = SmallPool::Handle();
+	CHECK(pool.size() == 0);
+	CHECK(pool.available() == 2);
+
+	Message message(3, 25, Message::TM);
+	message.appendUint8(7);
+	SmallPool::Handle stored = pool.store(message);
+	REQUIRE(stored);
+	CHECK(*stored == message);
+	SmallPool::Handle empty = pool.acquire();
+	CHECK(empty->dataSize == 0);
+	CHECK(pool.highWaterMark == 2);
+}
+
+TEST_CASE("Message pool exhaustion policies") {
+	SmallPool pool;
+	CHECK(pool.exhaustionPolicy() == SmallPool::ExhaustionPolicy::Fail);
+
+	SECTION("Fail") {
+		SmallPool::Handle first = pool.acquire();
+		SmallPool::Handle second = pool.acquire();
+		CHECK_FALSE(pool.acquire());
+		CHECK(pool.exhaustions == 1);
+		CHECK(pool.failedAcquisitions == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::MessagePoolExhausted) == 1);
+
+		second.reset();
+		CHECK(pool.acquire());
+	}
+
+	SECTION("Drop oldest") {
+		pool.setExhaustionPolicy(SmallPool::ExhaustionPolicy::DropOldest);
+		SmallPool::Handle first = pool.create(1, 1, Message::TM);
+		SmallPool::Handle firstCopy = first;
+		SmallPool::Handle second = pool.create(2, 2, Message::TM);
+
+		SmallPool::Handle third = pool.create(3, 3, Message::TM);
+		REQUIRE(third);
+		CHECK(third->serviceType == 3);
+		CHECK_FALSE(first);
+		CHECK_FALSE(firstCopy);
+		CHECK(first.useCount() == 0);
+		CHECK(pool.droppedMessages == 1);
+		CHECK(pool.failedAcquisitions == 0);
+
+		// The outdated handles do not change the references of the new message
+		SmallPool::Handle outdatedCopy = firstCopy;
+		first.reset();
+		outdatedCopy.reset();
+		CHECK(third.useCount() == 1);
+
+		CHECK(pool.create(4, 4, Message::TM));
+		CHECK_FALSE(second);
+		CHECK(third);
+
+		// A dropped handle does not resolve again once the generation of its buffer goes past 16 bits
+		uint32_t resolvedDroppedHandles = 0;
+		for (uint32_t reuse = 0; reuse <= UINT16_MAX + 1U; reuse++) {
+			const SmallPool::Handle reused = pool.acquire();
+			if (second) {
+				resolvedDroppedHandles++;
+			}
+		}
+		CHECK(resolvedDroppedHandles == 0);
+	}
+
+	SECTION("Block") {
+		pool.setExhaustionPolicy(SmallPool::ExhaustionPolicy::Block, releaseHeldHandle);
+		heldHandle = pool.acquire();
+		SmallPool::Handle other = pool.acquire();
+
+		SmallPool::Handle waited = pool.acquire();
+		CHECK(waited);
+		CHECK_FALSE(heldHandle);
+		CHECK(pool.exhaustions == 1);
+
+		pool.setExhaustionPolicy(SmallPool::ExhaustionPolicy::Block, giveUp);
+		CHECK_FALSE(pool.acquire());
+		CHECK(pool.failedAcquisitions == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::MessagePoolExhausted) == 1);
+	}
+
+	ServiceTests::resetErrors();
+}
+
+TEST_CASE("Packet stores share the buffers of their packets") {
+	const size_t usedBuffers = Services.messagePool.size();
+
+	Message report(17, 2, Message::TM);
+	report.appendUint32(55);
+
+	PacketStore packetStore;
+	packetStore.storedTelemetryPackets.push_back({Time::DefaultCUC(1), Services.messagePool.store(report)});
+	PacketStore copiedStore = packetStore;
+	CHECK(Services.messagePool.size() == usedBuffers + 1);
+	CHECK(copiedStore.calculateSizeInBytes() == 4);
+	CHECK(copiedStore.storedTelemetryPackets.front().second.useCount() == 2);
+
+	packetStore.storedTelemetryPackets.clear();
+	copiedStore.storedTelemetryPackets.clear();
+	CHECK(Services.messagePool.size() == usedBuffers);
+}
+
+TEST_CASE("Packet stores do not keep dropped packets", "[service][st15]") {
+	const String<ECSSPacketStoreIdSize> packetStoreId("ps1");
+	Services.storageAndRetrieval.addPacketStore(packetStoreId, PacketStore());
+	PacketStore& packetStore = Services.storageAndRetrieval.getPacketStore(packetStoreId);
+
+	Services.storageAndRetrieval.addTelemetryToPacketStore(packetStoreId, Time::DefaultCUC(1), MessageHandle());
+	CHECK(packetStore.storedTelemetryPackets.empty());
+
+	Message report(17, 2, Message::TM);
+	Services.storageAndRetrieval.addTelemetryToPacketStore(packetStoreId, Time::DefaultCUC(2), Services.messagePool.store(report));
+	REQUIRE(packetStore.countHeldPackets() == 1);
+
+	// Fill the pool, so that the next message takes the buffer of the stored packet
+	Services.messagePool.setExhaustionPolicy(ServiceMessagePool::ExhaustionPolicy::DropOldest);
+	std::vector<MessageHandle> otherMessages;
+	while (Services.messagePool.available() != 0) {
+		otherMessages.push_back(Services.messagePool.acquire());
+	}
+	otherMessages.push_back(Services.messagePool.acquire());
+	CHECK(packetStore.storedTelemetryPackets.size() == 1);
+	CHECK(packetStore.countHeldPackets() == 0);
+
+	Services.storageAndRetrieval.addTelemetryToPacketStore(packetStoreId, Time::DefaultCUC(3), Services.messagePool.store(report));
+	REQUIRE(packetStore.storedTelemetryPackets.size() == 1);
+	CHECK(packetStore.storedTelemetryPackets.front().first == Time::DefaultCUC(3));
+	CHECK(packetStore.countHeldPackets() == 1);
+
+	otherMessages.clear();
+	Services.messagePool.setExhaustionPolicy(ServiceMessagePool::ExhaustionPolicy::Fail);
+	ServiceTests::reset();
+	Services.reset();
+}
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <vector>
+#include "Helpers/QuantileSketch.hpp"
+#include "catch2/catch_all.hpp"
+
+namespace {
+	constexpr double RelativeAccuracy = 0.02;
+
+	double exactQuantile(std::vector<double> values, double quantile) {
+		std::sort(values.begin(), values.end());
+		return values[std::lround(quantile * (values.size() - 1))];
+	}
+} // namespace
+
+TEST_CASE("Quantile sketch estimation") {
+	SECTION("Quantiles are within the relative accuracy") {
+		QuantileSketch<128> sketch(RelativeAccuracy);
+		CHECK(sketch.quantile(0.5) == 0);
+
+		std::vector<double> values;
+		for (int i = 1; i <= 1000; i++) {
+			values.push_back((i % 2 == 0 ? -1 : 1) * (10 + (i * 37) % 500) / 10.0);
+		}
+		values.push_back(0);
+		for (const double value: values) {
+			sketch.add(value);
+		}
+
+		CHECK(sketch.count() == values.size());
+		for (const double quantile: {0.0, 0.1, 0.25, 0.5, 0.75, 0.95, 0.99, 1.0}) {
+			const double exact = exactQuantile(values, quantile);
+			CHECK(sketch.quantile(quantile) == Catch::Approx(exact).epsilon(RelativeAccuracy));
+		}
+	}
+
+	SECTION("Merged sketches estimate the combined distribution") {
+		QuantileSketch<128> firstWindow(RelativeAccuracy);
+		QuantileSketch<128> secondWindow(RelativeAccuracy);
+		std::vector<double> values;
+		for (int i = 1; i <= 200; i++) {
+			values.push_back(i);
+			(i % 3 == 0 ? firstWindow : secondWindow).add(i);
+		}
+
+		firstWindow.merge(secondWindow);
+		CHECK(firstWindow.count() == 200);
+		CHECK(firstWindow.quantile(0.5) == Catch::Approx(exactQuantile(values, 0.5)).epsilon(RelativeAccuracy));
+		CHECK(firstWindow.quantile(0.99) == Catch::Approx(exactQuantile(values, 0.99)).epsilon(RelativeAccuracy));
+
+		firstWindow.reset();
+		CHECK(firstWindow.count() == 0);
+	}
+
+	SECTION("Out of range values collapse the lowest buckets") {
+		QuantileSketch<16> sketch(RelativeAccuracy);
+		for (int i = 0; i < 99; i++) {
+			sketch.add(1);
+		}
+		sketch.add(1e6);
+
+		CHECK(sketch.count() == 100);
+		CHECK(sketch.quantile(1) == Catch::Approx(1e6).epsilon(RelativeAccuracy));
+		CHECK(sketch.quantile(0.5) < 1e6);
+	}
+}
@@ -0,0 +1,67 @@
+#include <cmath>
+#include "Helpers/SlidingWindow.hpp"
+#include "catch2/catch_all.hpp"
+
+TEST_CASE("Sliding window extrema") {
+	SlidingWindow<8> window;
+	const Time::DefaultCUC startTime(1000);
+	double values[6] = {5, 2, 7, 2, 3, 1};
+	for (int i = 0; i < 6; i++) {
+		window.add(values[i], startTime + std::chrono::seconds(i));
+	}
+
+	CHECK(window.size() == 6);
+	CHECK(window.max() == 7);
+	CHECK(window.timeOfMax() == startTime + std::chrono::seconds(2));
+	CHECK(window.min() == 1);
+	CHECK(window.oldestTime() == startTime);
+	CHECK(window.newestTime() == startTime + std::chrono::seconds(5));
+
+	window.expire(startTime + std::chrono::seconds(3));
+	CHECK(window.size() == 3);
+	CHECK(window.max() == 3);
+	CHECK(window.min() == 1);
+	CHECK(window.oldestTime() == startTime + std::chrono::seconds(3));
+
+	window.expire(startTime + std::chrono::seconds(5));
+	CHECK(window.max() == 1);
+	CHECK(window.min() == 1);
+
+	window.clear();
+	CHECK(window.empty());
+}
+
+TEST_CASE("Sliding window equal extrema") {
+	SlidingWindow<8> window;
+	const Time::DefaultCUC startTime(1000);
+	window.add(4, startTime);
+	window.add(4, startTime + std::chrono::seconds(1));
+	CHECK(window.timeOfMax() == startTime);
+	CHECK(window.timeOfMin() == startTime);
+
+	window.expire(startTime + std::chrono::seconds(1));
+	CHECK(window.max() == 4);
+	CHECK(window.timeOfMax() == startTime + std::chrono::seconds(1));
+}
+
+TEST_CASE("Sliding window moments") {
+	SlidingWindow<4> window;
+	const Time::DefaultCUC startTime(1000);
+
+	// The window keeps the 4 newest samples of a long signal with a large offset
+	for (int i = 0; i < 1000; i++) {
+		window.add(1e9 + (i % 7), startTime + std::chrono::seconds(i));
+	}
+	// The last samples are 1e9 + {2, 3, 4, 5}
+	CHECK(window.size() == 4);
+	CHECK(window.mean() == Catch::Approx(1e9 + 3.5).epsilon(1e-15));
+	CHECK(window.standardDeviation() == Catch::Approx(std::sqrt(1.25)).epsilon(1e-9));
+	CHECK(window.min() == 1e9 + 2);
+	CHECK(window.max() == 1e9 + 5);
+
+	int visited = 0;
+	window.forEach([&visited](double /* value */) {
+		visited++;
+	});
+	CHECK(visited == 4);
+}
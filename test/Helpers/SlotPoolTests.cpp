@@ -0,0 +1,106 @@
+#include "Helpers/SlotPool.hpp"
+#include "catch2/catch_all.hpp"
+
+namespace {
+	struct Shape {
+		static inline int liveShapes = 0;
+
+		Shape() {
+			liveShapes++;
+		}
+
+		Shape(const Shape&) {
+			liveShapes++;
+		}
+
+		virtual ~Shape() {
+			liveShapes--;
+		}
+
+		virtual int sides() const = 0;
+	};
+
+	struct Triangle : public Shape {
+		int sides() const override {
+			return 3;
+		}
+	};
+
+	struct Polygon : public Shape {
+		int sideCount;
+		double padding[4] = {};
+
+		explicit Polygon(int sideCount) : sideCount(sideCount) {}
+
+		int sides() const override {
+			return sideCount;
+		}
+	};
+
+	using ShapePool = SlotPool<Shape, sizeof(Polygon), 3>;
+} // namespace
+
+TEST_CASE("Slot pool emplacement and release") {
+	ShapePool pool;
+	CHECK(pool.empty());
+
+	SlotHandle triangle = pool.emplace<Triangle>();
+	SlotHandle hexagon = pool.emplace<Polygon>(6);
+	REQUIRE(triangle.isValid());
+	REQUIRE(hexagon.isValid());
+	CHECK(pool.size() == 2);
+	CHECK(pool.get(triangle)->sides() == 3);
+	CHECK(pool.get(hexagon)->sides() == 6);
+	CHECK(Shape::liveShapes == 2);
+
+	CHECK(pool.release(triangle));
+	CHECK(pool.get(triangle) == nullptr);
+	CHECK_FALSE(pool.release(triangle));
+	CHECK(pool.get(hexagon)->sides() == 6);
+	CHECK(Shape::liveShapes == 1);
+
+	SlotHandle square = pool.emplace<Polygon>(4);
+	CHECK(square.index == triangle.index);
+	CHECK(square != triangle);
+	CHECK(pool.get(triangle) == nullptr);
+	CHECK(pool.get(square)->sides() == 4);
+
+	pool.clear();
+	CHECK(pool.empty());
+	CHECK(Shape::liveShapes == 0);
+	CHECK(pool.get(hexagon) == nullptr);
+}
+
+TEST_CASE("Slot pool capacity") {
+	ShapePool pool;
+	for (int i = 0; i < 3; i++) {
+		CHECK(pool.emplace<Polygon>(i + 3).isValid());
+	}
+	CHECK(pool.full());
+	CHECK_FALSE(pool.emplace<Triangle>().isValid());
+
+	int totalSides = 0;
+	pool.forEach([&totalSides](SlotHandle /* handle */, Shape& shape) {
+		totalSides += shape.sides();
+	});
+	CHECK(totalSides == 3 + 4 + 5);
+
+	pool.release(pool.handleAt(1));
+	CHECK_FALSE(pool.full());
+	CHECK(pool.emplace<Triangle>().index == 1);
+}
+
+TEST_CASE("Slot pool handles stay outdated after many reuses") {
+	ShapePool pool;
+	const SlotHandle outdated = pool.emplace<Triangle>();
+	pool.release(outdated);
+
+	for (uint32_t reuse = 0; reuse < UINT16_MAX; reuse++) {
+		pool.release(pool.emplace<Triangle>());
+	}
+	// The generation of the slot is now 2^16, which a 16-bit counter would have wrapped to that of the outdated handle
+	const SlotHandle current = pool.emplace<Triangle>();
+	CHECK(current.index == outdated.index);
+	CHECK(pool.get(outdated) == nullptr);
+	CHECK(pool.get(current) != nullptr);
+}
@@ -1,3 +1,6 @@
+#include <cmath>
+#include <iterator>
+#include <vector>
 #include "Helpers/Statistic.hpp"
 #include "Services/ParameterStatisticsService.hpp"
 #include "catch2/catch_all.hpp"
@@ -57,6 +60,13 @@ TEST_CASE("Appending of statistics to message") {
 		REQUIRE(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000);
 		REQUIRE(report.readFloat() == Catch::Approx(4.99501).epsilon(0.00001));
 		REQUIRE(report.readFloat() == Catch::Approx(2.76527).epsilon(0.00001));
+		if constexpr (SupportsQuantiles) {
+			static_assert(std::size(ECSSStatisticsReportedQuantiles) == 3);
+			CHECK(report.readFloat() == Catch::Approx(6).epsilon(ECSSStatisticsQuantileRelativeAccuracy));    // median
+			CHECK(report.readFloat() == Catch::Approx(8.35).epsilon(ECSSStatisticsQuantileRelativeAccuracy)); // 95th
+			CHECK(report.readFloat() == Catch::Approx(8.35).epsilon(ECSSStatisticsQuantileRelativeAccuracy)); // 99th
+		}
+		CHECK(report.readPosition == report.dataSize);
 	}
 }
 
@@ -82,3 +92,126 @@ TEST_CASE("Reset statistics") {
 		REQUIRE(stat.statisticsAreInitialized());
 	}
 }
+
+namespace {
+	struct ReferenceStatistics {
+		long double mean = 0;
+		long double standardDeviation = 0;
+	};
+
+	ReferenceStatistics computeReference(const std::vector<double>& values) {
+		long double sum = 0;
+		for (double value: values) {
+			sum += value;
+		}
+		ReferenceStatistics reference;
+		reference.mean = sum / values.size();
+		long double deviations = 0;
+		for (double value: values) {
+			deviations += (value - reference.mean) * (value - reference.mean);
+		}
+		reference.standardDeviation = std::sqrt(deviations / values.size());
+		return reference;
+	}
+
+	/**
+	 * A signal with a large offset compared to its noise, for which a plain sum of squares loses all precision
+	 */
+	std::vector<double> largeMeanSignal(size_t count) {
+		std::vector<double> values(count);
+		uint32_t state = 1;
+		for (auto& value: values) {
+			state = state * 1664525 + 1013904223; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+			value = 1e9 + static_cast<double>(state % 1000) / 100.0;
+		}
+		return values;
+	}
+} // namespace
+
+TEST_CASE("Batch statistics updating") {
+	SECTION("A batch gives the same statistics as single samples") {
+		double values[11] = {8.3001, 2.3, 6.4, 1.1, 8.35, 3.4, 6, 8.31, 4.7, 1.09, 1.09};
+		Statistic single;
+		for (auto& value: values) {
+			single.updateStatistics(value);
+		}
+
+		Statistic batch;
+		batch.updateStatistics(etl::span<const double>(values, 3), Time::DefaultCUC(0));
+		batch.updateStatistics(etl::span<const double>(values + 3, 8), Time::DefaultCUC(0));
+
+		CHECK(batch.sampleCounter == single.sampleCounter);
+		CHECK(batch.max == single.max);
+		CHECK(batch.min == single.min);
+		CHECK(batch.mean == Catch::Approx(single.mean).epsilon(1e-12));
+		CHECK(batch.standardDeviation() == Catch::Approx(single.standardDeviation()).epsilon(1e-12));
+		if constexpr (SupportsQuantiles) {
+			CHECK(batch.quantiles.count() == 11);
+			for (const double quantile: ECSSStatisticsReportedQuantiles) {
+				CHECK(batch.quantiles.quantile(quantile) == single.quantiles.quantile(quantile));
+			}
+		}
+	}
+
+	SECTION("Extrema are timestamped with their position in the batch") {
+		double values[6] = {4, 9, 1, 9, 1, 5};
+		const Time::DefaultCUC firstSampleTime(100);
+		Statistic stat;
+		stat.updateStatistics(etl::span<const double>(values), firstSampleTime, std::chrono::milliseconds(500));
+
+		CHECK(stat.max == 9);
+		CHECK(stat.timeOfMaxValue == firstSampleTime + std::chrono::milliseconds(500));
+		CHECK(stat.min == 1);
+		CHECK(stat.timeOfMinValue == firstSampleTime + std::chrono::seconds(1));
+
+		stat.updateStatistics(2, firstSampleTime + std::chrono::seconds(10));
+		CHECK(stat.timeOfMinValue == firstSampleTime + std::chrono::seconds(1));
+		stat.updateStatistics(0, firstSampleTime + std::chrono::seconds(10));
+		CHECK(stat.timeOfMinValue == firstSampleTime + std::chrono::seconds(10));
+	}
+
+	SECTION("The standard deviation is accurate for signals with a large mean") {
+		const std::vector<double> values = largeMeanSignal(5000);
+		const ReferenceStatistics reference = computeReference(values);
+
+		Statistic single;
+		for (double value: values) {
+			single.updateStatistics(value);
+		}
+		Statistic batch;
+		for (size_t first = 0; first < values.size(); first += 100) {
+			batch.updateStatistics(etl::span<const double>(values.data() + first, 100), Time::DefaultCUC(0));
+		}
+
+		CHECK(single.mean == Catch::Approx(static_cast<double>(reference.mean)).epsilon(1e-12));
+		CHECK(single.standardDeviation() == Catch::Approx(static_cast<double>(reference.standardDeviation)).epsilon(1e-6));
+		CHECK(batch.mean == Catch::Approx(static_cast<double>(reference.mean)).epsilon(1e-12));
+		CHECK(batch.standardDeviation() == Catch::Approx(static_cast<double>(reference.standardDeviation)).epsilon(1e-6));
+	}
+}
+
+TEST_CASE("Batch statistics benchmark", "[.][benchmark]") {
+	constexpr size_t BatchSize = 1000;
+	const std::vector<double> values = largeMeanSignal(BatchSize);
+	const ReferenceStatistics reference = computeReference(values);
+
+	BENCHMARK("1000 single samples") {
+		Statistic stat;
+		for (double value: values) {
+			stat.updateStatistics(value, Time::DefaultCUC(0));
+		}
+		return stat.mean;
+	};
+
+	BENCHMARK("Batch of 1000 samples") {
+		Statistic stat;
+		stat.updateStatistics(etl::span<const double>(values.data(), values.size()), Time::DefaultCUC(0));
+		return stat.mean;
+	};
+
+	Statistic stat;
+	stat.updateStatistics(etl::span<const double>(values.data(), values.size()), Time::DefaultCUC(0));
+	const double relativeError = std::abs(static_cast<double>((stat.standardDeviation() - reference.standardDeviation) / reference.standardDeviation));
+	UNSCOPED_INFO("Relative standard deviation error against the long double reference: " << relativeError);
+	CHECK(relativeError < 1e-6);
+}
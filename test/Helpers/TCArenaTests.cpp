@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "Helpers/TCArena.hpp"
+#include "catch2/catch_all.hpp"
+
+namespace {
+	template <size_t ArenaSize, size_t MaxEntries>
+	bool holds(const TCArena<ArenaSize, MaxEntries>& arena, SlotHandle handle, uint8_t value, uint16_t length) {
+		const etl::span<const uint8_t> packet = arena.get(handle);
+		if (packet.size() != length) {
+			return false;
+		}
+		for (const uint8_t byte: packet) {
+			if (byte != value) {
+				return false;
+			}
+		}
+		return true;
+	}
+} // namespace
+
+TEST_CASE("TC arena storage") {
+	TCArena<32, 3> arena;
+	etl::array<uint8_t, 16> bytes{};
+
+	bytes.fill(1);
+	const SlotHandle first = arena.store(bytes.data(), 10);
+	bytes.fill(2);
+	const SlotHandle second = arena.store(bytes.data(), 12);
+	CHECK(arena.size() == 2);
+	CHECK(arena.usedBytes() == 22);
+	CHECK(holds(arena, first, 1, 10));
+	CHECK(holds(arena, second, 2, 12));
+
+	CHECK_FALSE(arena.store(bytes.data(), 11).isValid());
+	CHECK_FALSE(arena.store(bytes.data(), 0).isValid());
+
+	CHECK(arena.release(first));
+	CHECK_FALSE(arena.release(first));
+	CHECK(arena.get(first).empty());
+	CHECK(arena.availableBytes() == 20);
+
+	arena.clear();
+	CHECK(arena.size() == 0);
+	CHECK(arena.get(second).empty());
+}
+
+TEST_CASE("TC arena compaction") {
+	TCArena<32, 3> arena;
+	etl::array<uint8_t, 16> bytes{};
+
+	bytes.fill(1);
+	const SlotHandle first = arena.store(bytes.data(), 10);
+	bytes.fill(2);
+	const SlotHandle second = arena.store(bytes.data(), 10);
+	bytes.fill(3);
+	const SlotHandle third = arena.store(bytes.data(), 10);
+	CHECK(arena.full());
+
+	arena.release(first);
+	arena.release(third);
+
+	// 16 bytes only fit after the second packet is moved to the start of the arena
+	bytes.fill(4);
+	const SlotHandle fourth = arena.store(bytes.data(), 16);
+	REQUIRE(fourth.isValid());
+	CHECK(holds(arena, second, 2, 10));
+	CHECK(holds(arena, fourth, 4, 16));
+	CHECK(arena.get(third).empty());
+	CHECK(arena.usedBytes() == 26);
+}
+
+TEST_CASE("TC arena larger than 64 KiB") {
+	auto arena = std::make_unique<TCArena<100000, 3>>();
+	std::vector<uint8_t> bytes(40000);
+
+	std::fill(bytes.begin(), bytes.end(), 1);
+	const SlotHandle first = arena->store(bytes.data(), 40000);
+	std::fill(bytes.begin(), bytes.end(), 2);
+	const SlotHandle second = arena->store(bytes.data(), 40000);
+	REQUIRE(second.isValid());
+	CHECK(arena->usedBytes() == 80000);
+	CHECK(holds(*arena, first, 1, 40000));
+	CHECK(holds(*arena, second, 2, 40000));
+
+	// The third packet only fits after the second one is moved to the start of the arena
+	arena->release(first);
+	std::fill(bytes.begin(), bytes.end(), 3);
+	const SlotHandle third = arena->store(bytes.data(), 40000);
+	REQUIRE(third.isValid());
+	CHECK(holds(*arena, second, 2, 40000));
+	CHECK(holds(*arena, third, 3, 40000));
+}
@@ -0,0 +1,247 @@
+#include "Helpers/TCTransferFrameReceiver.hpp"
+#include "../Services/ServiceTests.hpp"
+#include "Services/TestService.hpp"
+#include "catch2/catch_all.hpp"
+#include "etl/vector.h"
+
+namespace {
+	constexpr uint16_t ReceiverSpacecraftId = 0x1A5;
+	constexpr uint8_t ReceiverVirtualChannel = 3;
+
+	using Frame = etl::vector<uint8_t, CCSDSMaxTCFrameLength>;
+	using Receiver = TCTransferFrameReceiver;
+
+	enum class FrameType : uint8_t {
+		AD = 0x00,
+		BD = 0x20,
+		BC = 0x30,
+	};
+
+	/**
+	 * Builds a TC transfer frame around a data field, with a correct Frame Error Control Field
+	 */
+	Frame frameOf(FrameType type, uint8_t sequenceNumber, const uint8_t* data, uint16_t dataLength,
+	              uint8_t virtualChannel = ReceiverVirtualChannel) {
+		const uint16_t frameLength = Receiver::PrimaryHeaderSize + dataLength + Receiver::ErrorControlFieldSize;
+		Frame frame;
+		frame.push_back(static_cast<uint8_t>(type) | (ReceiverSpacecraftId >> 8U));
+		frame.push_back(ReceiverSpacecraftId & 0xFFU);
+		frame.push_back((virtualChannel << 2U) | ((frameLength - 1) >> 8U));
+		frame.push_back((frameLength - 1) & 0xFFU);
+		frame.push_back(sequenceNumber);
+		frame.insert(frame.end(), data, data + dataLength);
+		const uint16_t crc = CRCHelper::calculateCRC(frame.data(), frame.size());
+		frame.push_back(crc >> 8U);
+		frame.push_back(crc & 0xFFU);
+		return frame;
+	}
+
+	/**
+	 * Builds a frame that carries a segment of a packet stream
+	 */
+	Frame segmentFrameOf(FrameType type, uint8_t sequenceNumber, Receiver::SequenceFlags flags,
+	                     const uint8_t* data, uint16_t dataLength) {
+		etl::vector<uint8_t, CCSDSMaxTCFrameLength> dataField;
+		dataField.push_back(flags << 6U);
+		dataField.insert(dataField.end(), data, data + dataLength);
+		return frameOf(type, sequenceNumber, dataField.data(), dataField.size());
+	}
+
+	/**
+	 * Composes a TC[17,1] packet, with some bytes of application data
+	 */
+	String<CCSDSMaxMessageSize> testPacket(uint16_t dataLength = 0) {
+		Message message(TestService::ServiceType, TestService::MessageType::AreYouAliveTest, Message::TC, 1);
+		for (uint16_t byte = 0; byte < dataLength; byte++) {
+			message.appendUint8(byte & 0xFFU);
+		}
+		return MessageParser::compose(message);
+	}
+
+	Frame packetFrame(FrameType type, uint8_t sequenceNumber) {
+		auto packet = testPacket();
+		return segmentFrameOf(type, sequenceNumber, Receiver::Unsegmented,
+		                      reinterpret_cast<const uint8_t*>(packet.data()), packet.size());
+	}
+
+	Frame controlFrame(std::initializer_list<uint8_t> command) {
+		return frameOf(FrameType::BC, 0, command.begin(), command.size());
+	}
+
+	struct PacketCounter {
+		uint32_t packets = 0;
+		uint16_t lastDataSize = 0;
+
+		void operator()(Message& message) {
+			packets++;
+			lastDataSize = message.dataSize;
+		}
+	};
+} // namespace
+
+TEST_CASE("TC transfer frame validation") {
+	Receiver receiver(ReceiverSpacecraftId, ReceiverVirtualChannel);
+	PacketCounter counter;
+
+	Frame frame = packetFrame(FrameType::AD, 0);
+	CHECK(receiver.receiveFrame(frame.data(), frame.size() - 1, counter) == Receiver::FrameResult::InvalidFrame);
+	CHECK(receiver.receiveFrame(frame.data(), 4, counter) == Receiver::FrameResult::InvalidFrame);
+
+	frame[8] ^= 0x01U;
+	CHECK(receiver.receiveFrame(frame.data(), frame.size(), counter) == Receiver::FrameResult::InvalidCRC);
+
+	const auto packet = testPacket();
+	Frame otherChannel = frameOf(FrameType::AD, 0, reinterpret_cast<const uint8_t*>(packet.data()), packet.size(),
+	                             ReceiverVirtualChannel + 1);
+	CHECK(receiver.receiveFrame(otherChannel.data(), otherChannel.size(), counter) ==
+	      Receiver::FrameResult::OtherVirtualChannel);
+
+	Frame invalidCommand = controlFrame({0x82, 0x01, 0x00});
+	CHECK(receiver.receiveFrame(invalidCommand.data(), invalidCommand.size(), counter) ==
+	      Receiver::FrameResult::InvalidFrame);
+
+	CHECK(counter.packets == 0);
+	CHECK(receiver.expectedSequenceNumber() == 0);
+}
+
+TEST_CASE("TC transfer frames with unsegmented packets") {
+	Receiver receiver(ReceiverSpacecraftId, ReceiverVirtualChannel);
+
+	SECTION("Several packets in a frame") {
+		PacketCounter counter;
+		auto first = testPacket(3);
+		auto second = testPacket(5);
+		first.append(second);
+		Frame frame = segmentFrameOf(FrameType::AD, 0, Receiver::Unsegmented,
+		                             reinterpret_cast<const uint8_t*>(first.data()), first.size());
+
+		CHECK(receiver.receiveFrame(frame.data(), frame.size(), counter) == Receiver::FrameResult::Accepted);
+		CHECK(counter.packets == 2);
+		CHECK(counter.lastDataSize == 5);
+		CHECK(receiver.expectedSequenceNumber() == 1);
+		CHECK(receiver.segmentErrors == 0);
+	}
+
+	SECTION("Packets are executed by default") {
+		Frame frame = packetFrame(FrameType::BD, 0);
+		CHECK(receiver.receiveFrame(frame.data(), frame.size()) == Receiver::FrameResult::Accepted);
+
+		REQUIRE(ServiceTests::count() == 1);
+		CHECK(ServiceTests::get(0).serviceType == TestService::ServiceType);
+		CHECK(ServiceTests::get(0).messageType == TestService::MessageType::AreYouAliveTestReport);
+		ServiceTests::reset();
+	}
+}
+
+TEST_CASE("TC transfer frame FARM-1") {
+	Receiver receiver(ReceiverSpacecraftId, ReceiverVirtualChannel);
+	PacketCounter counter;
+	auto receive = [&receiver, &counter](const Frame& frame) {
+		return receiver.receiveFrame(frame.data(), frame.size(), counter);
+	};
+
+	CHECK(receive(packetFrame(FrameType::AD, 0)) == Receiver::FrameResult::Accepted);
+	CHECK(receiver.clcw() == ((1U << 24U) | (ReceiverVirtualChannel << 18U) | 1U));
+
+	// A repeated frame is in the negative window
+	CHECK(receive(packetFrame(FrameType::AD, 0)) == Receiver::FrameResult::Discarded);
+	CHECK(receiver.state() == Receiver::FARMState::Open);
+	CHECK((receiver.clcw() & (1U << 11U)) == 0);
+
+	// A gap in the sequence asks for a retransmission
+	CHECK(receive(packetFrame(FrameType::AD, 3)) == Receiver::FrameResult::Discarded);
+	CHECK((receiver.clcw() & (1U << 11U)) != 0);
+	CHECK(receive(packetFrame(FrameType::AD, 1)) == Receiver::FrameResult::Accepted);
+	CHECK((receiver.clcw() & (1U << 11U)) == 0);
+	CHECK(counter.packets == 2);
+
+	// A frame outside the sliding window locks the FARM out
+	CHECK(receive(packetFrame(FrameType::AD, 100)) == Receiver::FrameResult::Discarded);
+	CHECK(receiver.state() == Receiver::FARMState::Lockout);
+	CHECK((receiver.clcw() & (1U << 13U)) != 0);
+	CHECK(receive(packetFrame(FrameType::AD, 2)) == Receiver::FrameResult::Discarded);
+
+	// Expedited frames bypass the FARM
+	CHECK(receive(packetFrame(FrameType::BD, 0)) == Receiver::FrameResult::Accepted);
+	CHECK(counter.packets == 3);
+
+	// Set V(R) has no effect in the Lockout state, Unlock returns to the Open state
+	CHECK(receive(controlFrame({0x82, 0x00, 50})) == Receiver::FrameResult::Accepted);
+	CHECK(receiver.expectedSequenceNumber() == 2);
+	CHECK(receive(controlFrame({0x00})) == Receiver::FrameResult::Accepted);
+	CHECK(receiver.state() == Receiver::FARMState::Open);
+	CHECK(receive(controlFrame({0x82, 0x00, 50})) == Receiver::FrameResult::Accepted);
+	CHECK(receiver.expectedSequenceNumber() == 50);
+	CHECK(receive(packetFrame(FrameType::AD, 50)) == Receiver::FrameResult::Accepted);
+
+	// One Type-BD and three Type-BC frames have been accepted
+	CHECK(((receiver.clcw() >> 9U) & 0x03U) == 0);
+	CHECK((receiver.clcw() & 0xFFU) == 51);
+	CHECK(counter.packets == 4);
+}
+
+TEST_CASE("TC transfer frame FARM-1 Wait state") {
+	Receiver receiver(ReceiverSpacecraftId, ReceiverVirtualChannel);
+	PacketCounter counter;
+	Frame frame = packetFrame(FrameType::AD, 0);
+
+	receiver.setBufferAvailable(false);
+	CHECK(receiver.receiveFrame(frame.data(), frame.size(), counter) == Receiver::FrameResult::Discarded);
+	CHECK(receiver.state() == Receiver::FARMState::Wait);
+	CHECK((receiver.clcw() & (1U << 12U)) != 0);
+
+	receiver.setBufferAvailable(true);
+	CHECK(receiver.state() == Receiver::FARMState::Open);
+	CHECK(receiver.receiveFrame(frame.data(), frame.size(), counter) == Receiver::FrameResult::Accepted);
+	CHECK(counter.packets == 1);
+}
+
+TEST_CASE("TC transfer frames with segmented packets") {
+	Receiver receiver(ReceiverSpacecraftId, ReceiverVirtualChannel);
+	PacketCounter counter;
+
+	const auto packet = testPacket(300);
+	const auto* bytes = reinterpret_cast<const uint8_t*>(packet.data());
+	const uint16_t third = packet.size() / 3;
+
+	Frame first = segmentFrameOf(FrameType::AD, 0, Receiver::FirstSegment, bytes, third);
+	Frame middle = segmentFrameOf(FrameType::AD, 1, Receiver::ContinuingSegment, bytes + third, third);
+	Frame last = segmentFrameOf(FrameType::AD, 2, Receiver::LastSegment, bytes + 2 * third, packet.size() - 2 * third);
+
+	CHECK(receiver.receiveFrame(first.data(), first.size(), counter) == Receiver::FrameResult::Accepted);
+	CHECK(receiver.receiveFrame(middle.data(), middle.size(), counter) == Receiver::FrameResult::Accepted);
+	CHECK(counter.packets == 0);
+	CHECK(receiver.receiveFrame(last.data(), last.size(), counter) == Receiver::FrameResult::Accepted);
+	CHECK(counter.packets == 1);
+	CHECK(counter.lastDataSize == 300);
+	CHECK(receiver.segmentErrors == 0);
+
+	// A segment without its first segment is dropped
+	Frame orphan = segmentFrameOf(FrameType::BD, 0, Receiver::LastSegment, bytes, third);
+	CHECK(receiver.receiveFrame(orphan.data(), orphan.size(), counter) == Receiver::FrameResult::Accepted);
+	CHECK(receiver.segmentErrors == 1);
+	CHECK(counter.packets == 1);
+}
+
+TEST_CASE("TC transfer frame replay benchmark", "[.][benchmark]") {
+	// A whole cycle of sequence numbers, so that the replay can start over
+	constexpr uint16_t NumberOfFrames = 256;
+	auto frames = std::make_unique<etl::array<Frame, NumberOfFrames>>();
+
+	auto packets = testPacket(100);
+	packets.append(testPacket(100));
+	for (uint16_t sequenceNumber = 0; sequenceNumber < NumberOfFrames; sequenceNumber++) {
+		(*frames)[sequenceNumber] = segmentFrameOf(FrameType::AD, sequenceNumber, Receiver::Unsegmented,
+		                                           reinterpret_cast<const uint8_t*>(packets.data()), packets.size());
+	}
+
+	Receiver receiver(ReceiverSpacecraftId, ReceiverVirtualChannel);
+	PacketCounter counter;
+
+	BENCHMARK("Receive 256 TC frames of 2 packets") {
+		for (const Frame& frame: *frames) {
+			receiver.receiveFrame(frame.data(), frame.size(), counter);
+		}
+		return counter.packets;
+	};
+}
@@ -0,0 +1,234 @@
+#include "Helpers/TMTransferFrameGenerator.hpp"
+#include "catch2/catch_all.hpp"
+#include "etl/vector.h"
+
+namespace {
+	constexpr size_t FrameLength = 64;
+
+	/**
+	 * The data field of a frame without an Operational Control Field
+	 */
+	constexpr size_t DataFieldLength = FrameLength - 6 - 2;
+
+	using Generator = TMTransferFrameGenerator<FrameLength, 4>;
+
+	/**
+	 * Creates a packet whose bytes all have the same value
+	 */
+	template <size_t Length>
+	etl::array<uint8_t, Length> packetOf(uint8_t value) {
+		etl::array<uint8_t, Length> packet;
+		packet.fill(value);
+		return packet;
+	}
+
+	uint8_t virtualChannelOf(const uint8_t* frame) {
+		return (frame[1] >> 1U) & 0x07U;
+	}
+
+	uint16_t firstHeaderPointerOf(const uint8_t* frame) {
+		return ((frame[4] & 0x07U) << 8U) | frame[5];
+	}
+} // namespace
+
+TEST_CASE("TM transfer frame header and trailer") {
+	Generator generator(0x2AB);
+	const auto packet = packetOf<30>(0xA1);
+	REQUIRE(generator.queuePacket(2, packet));
+
+	etl::array<uint8_t, FrameLength> frame{};
+	CHECK(generator.generateFrame(frame.data()) == 2);
+
+	CHECK(frame[0] == 0x2A);
+	CHECK(frame[1] == ((0xBU << 4U) | (2U << 1U)));
+	CHECK(frame[2] == 0); // master channel frame count
+	CHECK(frame[3] == 0); // virtual channel frame count
+	CHECK(frame[4] == 0x18);
+	CHECK(firstHeaderPointerOf(frame.data()) == 0);
+	CHECK(std::all_of(frame.begin() + 6, frame.begin() + 36, [](uint8_t byte) { return byte == 0xA1; }));
+
+	// The rest of the data field is an idle packet
+	CHECK(frame[36] == 0x07);
+	CHECK(frame[37] == 0xFF);
+	CHECK(frame[38] == 0xC0);
+	CHECK(frame[40] == 0);
+	CHECK(frame[41] == DataFieldLength - 30 - 7);
+	CHECK(frame[42] == Generator::IdlePattern);
+
+	CHECK(CRCHelper::validateCRC(frame.data(), FrameLength) == 0);
+	CHECK(generator.pendingPackets(2) == 0);
+}
+
+TEST_CASE("TM transfer frames with packets spanning frames") {
+	Generator generator(1);
+	const auto first = packetOf<40>(1);
+	const auto second = packetOf<40>(2);
+	const auto third = packetOf<40>(3);
+	REQUIRE(generator.queuePacket(1, first));
+	REQUIRE(generator.queuePacket(1, second));
+	REQUIRE(generator.queuePacket(1, third));
+
+	etl::vector<uint8_t, 3 * DataFieldLength> stream;
+	for (uint8_t count = 0; count < 3; count++) {
+		etl::array<uint8_t, FrameLength> frame{};
+		CHECK(generator.generateFrame(frame.data()) == 1);
+		CHECK(frame[2] == count);
+		CHECK(frame[3] == count);
+		stream.insert(stream.end(), frame.begin() + 6, frame.begin() + 6 + DataFieldLength);
+
+		const uint16_t expectedFirstHeaderPointer = (count == 0) ? 0 : ((count == 1) ? 24 : 8);
+		CHECK(firstHeaderPointerOf(frame.data()) == expectedFirstHeaderPointer);
+	}
+
+	CHECK(std::equal(first.begin(), first.end(), stream.begin()));
+	CHECK(std::equal(second.begin(), second.end(), stream.begin() + 40));
+	CHECK(std::equal(third.begin(), third.end(), stream.begin() + 80));
+	CHECK(stream[120] == 0x07);
+	CHECK(generator.pendingPackets(1) == 0);
+	CHECK(generator.pendingBytes(1) == 0);
+}
+
+TEST_CASE("TM transfer frames with an idle packet continuing in the next frame") {
+	Generator generator(1);
+	const auto first = packetOf<DataFieldLength - 4>(1);
+	const auto second = packetOf<10>(2);
+	REQUIRE(generator.queuePacket(0, first));
+
+	etl::array<uint8_t, FrameLength> frame{};
+	generator.generateFrame(frame.data());
+	CHECK(frame[6 + DataFieldLength - 4] == 0x07);
+	CHECK(frame[6 + DataFieldLength - 1] == 0);
+
+	REQUIRE(generator.queuePacket(0, second));
+	generator.generateFrame(frame.data());
+	CHECK(virtualChannelOf(frame.data()) == 0);
+	CHECK(frame[6] == 0);
+	CHECK(frame[7] == 0);
+	CHECK(frame[8] == Generator::IdlePattern);
+	CHECK(firstHeaderPointerOf(frame.data()) == 3);
+	CHECK(frame[9] == 2);
+}
+
+TEST_CASE("TM transfer frames with only idle data") {
+	Generator generator(1);
+	etl::array<uint8_t, FrameLength> frame{};
+
+	for (uint8_t count = 0; count < 2; count++) {
+		CHECK(generator.generateFrame(frame.data()) == Generator::IdleVirtualChannel);
+		CHECK(frame[2] == count);
+		CHECK(frame[3] == count);
+		CHECK(firstHeaderPointerOf(frame.data()) == Generator::OnlyIdleData);
+		CHECK(std::all_of(frame.begin() + 6, frame.end() - 2, [](uint8_t byte) { return byte == Generator::IdlePattern; }));
+	}
+
+	const auto packet = packetOf<10>(1);
+	REQUIRE(generator.queuePacket(3, packet));
+	CHECK(generator.generateFrame(frame.data()) == 3);
+	CHECK(frame[2] == 2);
+	CHECK(frame[3] == 0);
+
+	CHECK_FALSE(generator.queuePacket(Generator::IdleVirtualChannel, packet));
+	CHECK_FALSE(generator.queuePacket(Generator::VirtualChannels, packet));
+	CHECK_FALSE(generator.queuePacket(0, etl::span<const uint8_t>()));
+	for (uint8_t count = 0; count < 4; count++) {
+		CHECK(generator.queuePacket(0, packet));
+	}
+	CHECK_FALSE(generator.queuePacket(0, packet));
+}
+
+TEST_CASE("TM transfer frame multiplexing") {
+	Generator generator(1);
+	const auto packet = packetOf<DataFieldLength>(1);
+	etl::array<uint8_t, FrameLength> frame{};
+
+	REQUIRE(generator.setMultiplexing(0, 0, 3));
+	REQUIRE(generator.setMultiplexing(1, 0, 1));
+	CHECK_FALSE(generator.setMultiplexing(1, 0, 0));
+
+	etl::array<uint8_t, Generator::VirtualChannels> framesOfChannel{};
+	for (uint8_t count = 0; count < 8; count++) {
+		for (uint8_t virtualChannel = 0; virtualChannel < 2; virtualChannel++) {
+			if (generator.pendingPackets(virtualChannel) == 0) {
+				generator.queuePacket(virtualChannel, packet);
+			}
+		}
+		framesOfChannel[generator.generateFrame(frame.data())]++;
+	}
+	CHECK(framesOfChannel[0] == 6);
+	CHECK(framesOfChannel[1] == 2);
+
+	// A virtual channel with a higher priority is served first
+	REQUIRE(generator.setMultiplexing(2, 1, 1));
+	REQUIRE(generator.queuePacket(2, packet));
+	CHECK(generator.generateFrame(frame.data()) == 2);
+
+	// A partial frame waits while there are full frames of the same priority
+	REQUIRE(generator.setMultiplexing(3, 1, 1));
+	const auto urgent = packetOf<10>(2);
+	REQUIRE(generator.queuePacket(2, urgent));
+	REQUIRE(generator.queuePacket(3, packet));
+	CHECK(generator.generateFrame(frame.data()) == 3);
+	CHECK(generator.generateFrame(frame.data()) == 2);
+}
+
+TEST_CASE("TM transfer frame multiplexing of a partial frame with a higher priority") {
+	Generator generator(1);
+	const auto packet = packetOf<DataFieldLength>(1);
+	const auto urgent = packetOf<10>(2);
+	etl::array<uint8_t, FrameLength> frame{};
+
+	REQUIRE(generator.setMultiplexing(0, 10, 1));
+	REQUIRE(generator.setMultiplexing(1, 0, 1));
+	for (uint8_t count = 0; count < 4; count++) {
+		REQUIRE(generator.queuePacket(1, packet));
+	}
+	REQUIRE(generator.queuePacket(0, urgent));
+
+	// The full frames of a lower priority do not hold back the only packet of a higher priority
+	CHECK(generator.generateFrame(frame.data()) == 0);
+	CHECK(generator.pendingPackets(0) == 0);
+	for (uint8_t count = 0; count < 4; count++) {
+		CHECK(generator.generateFrame(frame.data()) == 1);
+	}
+	CHECK(generator.generateFrame(frame.data()) == Generator::IdleVirtualChannel);
+}
+
+TEST_CASE("TM transfer frames with an Operational Control Field") {
+	TMTransferFrameGenerator<FrameLength, 4> generator(1, true, false);
+	generator.setOperationalControlField(0x01020304);
+
+	etl::array<uint8_t, FrameLength> frame{};
+	generator.generateFrame(frame.data());
+	CHECK((frame[1] & 1U) == 1);
+	CHECK(frame[FrameLength - 4] == 0x01);
+	CHECK(frame[FrameLength - 3] == 0x02);
+	CHECK(frame[FrameLength - 2] == 0x03);
+	CHECK(frame[FrameLength - 1] == 0x04);
+}
+
+TEST_CASE("TM transfer frame generation benchmark", "[.][benchmark]") {
+	constexpr size_t LargeFrameLength = 1115;
+	constexpr uint32_t NumberOfFrames = 1000;
+	using LargeGenerator = TMTransferFrameGenerator<LargeFrameLength, 64>;
+	auto generator = std::make_unique<LargeGenerator>(0x2AB);
+	generator->setMultiplexing(0, 0, 3);
+
+	etl::array<etl::array<uint8_t, 1024>, 4> packets{};
+	etl::array<uint8_t, LargeFrameLength> frame{};
+	uint32_t nextPacket = 0;
+
+	BENCHMARK("Generate 1000 frames of 1115 bytes from 3 virtual channels") {
+		uint32_t checksum = 0;
+		for (uint32_t count = 0; count < NumberOfFrames; count++) {
+			for (uint8_t virtualChannel = 0; virtualChannel < 3; virtualChannel++) {
+				while (generator->pendingPackets(virtualChannel) < 32) {
+					const size_t length = 100 + (nextPacket * 337) % 900;
+					generator->queuePacket(virtualChannel, etl::span<const uint8_t>(packets[nextPacket % 4].data(), length));
+					nextPacket++;
+				}
+			}
+			checksum += generator->generateFrame(frame.data()) + frame[LargeFrameLength - 1];
+		}
+		return checksum;
+	};
+}
@@ -0,0 +1,53 @@
+#include <vector>
+#include "Helpers/WordBitset.hpp"
+#include "catch2/catch_all.hpp"
+
+namespace {
+	template <typename Bitset>
+	std::vector<size_t> clearedBits(const Bitset& bitset) {
+		std::vector<size_t> bits;
+		bitset.forEachReset([&bits](size_t bit) {
+			bits.push_back(bit);
+		});
+		return bits;
+	}
+} // namespace
+
+TEST_CASE("Word bitset updates") {
+	WordBitset<70> bitset;
+	CHECK(bitset.count() == 0);
+
+	CHECK(bitset.set(3));
+	CHECK_FALSE(bitset.set(3));
+	CHECK(bitset.set(69, true));
+	CHECK(bitset.test(3));
+	CHECK(bitset[69]);
+	CHECK_FALSE(bitset[4]);
+	CHECK(bitset.count() == 2);
+
+	CHECK(bitset.reset(3));
+	CHECK_FALSE(bitset.reset(3));
+	CHECK(bitset.count() == 1);
+
+	bitset.set();
+	CHECK(bitset.count() == 70);
+	bitset.reset();
+	CHECK(bitset.count() == 0);
+}
+
+TEST_CASE("Word bitset scan of cleared bits") {
+	WordBitset<70> bitset;
+	bitset.set();
+	CHECK(clearedBits(bitset).empty());
+
+	bitset.reset(0);
+	bitset.reset(31);
+	bitset.reset(32);
+	bitset.reset(69);
+	CHECK(clearedBits(bitset) == std::vector<size_t>{0, 31, 32, 69});
+
+	// The unused bits of the last word are never reported
+	bitset.reset();
+	CHECK(clearedBits(bitset).size() == 70);
+	CHECK(clearedBits(bitset).back() == 69);
+}
@@ -48,6 +48,35 @@ TEST_CASE("TC Message parsing into a string", "[MessageParser]") {
 	}
 }
 
+TEST_CASE("Embedded TC packet parsing", "[MessageParser]") {
+	Message message(129, 31, Message::TC, 7);
+	message.packetSequenceCount = 8199;
+	message.appendUint16(4253);
+	message.appendUint8(12);
+
+	Message container;
+	container.appendPacket(message);
+	container.appendUint8(99); // Data that follows the embedded packet
+
+	const uint16_t expectedLength = CCSDSPrimaryHeaderSize + ECSSSecondaryTCHeaderSize + 3 + (CRCHelper::EnableCRC ? 2 : 0);
+	CHECK(MessageParser::packetLength(container.data.begin(), container.dataSize) == expectedLength);
+	CHECK(MessageParser::packetLength(container.data.begin(), expectedLength - 1) == 0);
+	CHECK(MessageParser::packetLength(container.data.begin(), CCSDSPrimaryHeaderSize - 1) == 0);
+
+	const etl::span<const uint8_t> packet = container.readPacket();
+	REQUIRE(packet.size() == expectedLength);
+	CHECK(container.readUint8() == 99);
+
+	const Message parsed = MessageParser::parseEmbeddedTC(packet.data(), packet.size());
+	CHECK(parsed.packetType == Message::TC);
+	CHECK(parsed.applicationId == 7);
+	CHECK(parsed.packetSequenceCount == 8199);
+	CHECK(parsed.serviceType == 129);
+	CHECK(parsed.messageType == 31);
+	CHECK(parsed.dataSize == 3);
+	CHECK(message.bytesEqualWith(parsed));
+}
+
 TEST_CASE("TM message parsing", "[MessageParser]") {
 	uint8_t packet[] = {0x08, 0x02, 0xc0, 0x4d, 0x00, 0x12, 0x20, 0x16,
 	                    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2,6 +2,7 @@
 #include <ServicePool.hpp>
 #include <catch2/catch_all.hpp>
 #include "Services/EventReportService.hpp"
+#include "Services/ServiceTests.hpp"
 #include "etl/String.hpp"
 
 TEST_CASE("Message is usable", "[message]") {
@@ -456,3 +457,102 @@ TEST_CASE("Storing and retrieving enums in Messages") {
 		CHECK(parameter3.getValue() == parameter4.getValue());
 	}
 }
+
+TEST_CASE("Appending bits over stale data", "[message]") {
+	Message message(0, 0, Message::TC, 0);
+	message.data[0] = 0xFF;
+	message.data[1] = 0xFF;
+
+	message.appendBits(4, 0x5);
+	message.appendBits(8, 0x3C);
+	message.finalize();
+
+	REQUIRE(message.dataSize == 2);
+	CHECK(message.data[0] == 0x53);
+	CHECK(message.data[1] == 0xC0);
+}
+
+TEST_CASE("Copying and comparing messages", "[message]") {
+	Message message(17, 2, Message::TM, 3);
+	message.appendUint16(0x1234);
+	message.appendBits(3, 0x5);
+
+	Message copy = message;
+	CHECK(copy.dataSize == 2);
+	CHECK(copy.currentBit == 3);
+	copy.appendBits(5, 0x1F);
+	CHECK(copy.readUint16() == 0x1234);
+	CHECK(copy.readUint8() == 0xBF);
+
+	Message other(17, 2, Message::TM, 3);
+	other.appendUint16(0x1234);
+	other.data[2] = 0xAA;
+	message.data[2] = 0x55;
+	CHECK(message == other);
+	CHECK(message.bytesEqualWith(other));
+
+	other.appendUint8(1);
+	CHECK_FALSE(message == other);
+	CHECK(message.bytesEqualWith(other));
+	CHECK_FALSE(other.bytesEqualWith(message));
+
+	Message assigned;
+	assigned = other;
+	CHECK(assigned == other);
+	CHECK(assigned.applicationId == 3);
+}
+
+TEST_CASE("Reading past the data of a message", "[message]") {
+	Message message(17, 1, Message::TC, 1);
+	message.appendUint16(0x1234);
+	message.appendUint8(0x56);
+	// The bytes after the data are not part of the message, even if they hold stale values
+	message.data[3] = 0x78;
+
+	CHECK(message.readUint32() == 0);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::MessageTooShort) == 1);
+	CHECK(message.readUint16() == 0x1234);
+	CHECK(message.readUint16() == 0);
+	CHECK(message.readBits(12) == 0);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::MessageTooShort) == 3);
+
+	CHECK(message.readUint8() == 0x56);
+	CHECK(message.readUint8() == 0);
+	uint8_t string[2] = {};
+	message.readString(string, 1);
+	CHECK(string[0] == 0);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::MessageTooShort) == 5);
+	ServiceTests::reset();
+}
+
+TEST_CASE("Message creation benchmark", "[.][benchmark]") {
+	auto createMessage = [](uint16_t size) {
+		Message message(17, 2, Message::TM, ApplicationId);
+		for (uint16_t byte = 0; byte < size; byte++) {
+			message.appendUint8(static_cast<uint8_t>(byte));
+		}
+		message.finalize();
+		return message.dataSize;
+	};
+
+	BENCHMARK("Create, append and finalize a 3-byte message") {
+		return createMessage(3);
+	};
+
+	BENCHMARK("Create, append and finalize a 64-byte message") {
+		return createMessage(64);
+	};
+
+	BENCHMARK("Create, append and finalize a full message") {
+		return createMessage(ECSSMaxMessageSize);
+	};
+
+	Message message(17, 2, Message::TM, ApplicationId);
+	message.appendUint16(0x1234);
+	message.appendUint8(1);
+
+	BENCHMARK("Copy a 3-byte message") {
+		Message copy = message;
+		return copy.dataSize;
+	};
+}
@@ -1,12 +1,25 @@
+#include <chrono>
 #include <Message.hpp>
 #include <ServicePool.hpp>
 #include <Services/EventActionService.hpp>
+#include <Services/EventReportService.hpp>
+#include <Services/FunctionManagementService.hpp>
+#include <Services/TestService.hpp>
 #include <catch2/catch_all.hpp>
 #include <etl/String.hpp>
 #include "ServiceTests.hpp"
 
 EventActionService& eventActionService = Services.eventAction;
 
+/**
+ * Creates a TC to be used as the request of an event-action definition, carrying some data to tell requests apart
+ */
+Message actionRequest(uint16_t data) {
+	Message request(TestService::ServiceType, TestService::MessageType::AreYouAliveTest, Message::TC, 0);
+	request.appendUint16(data);
+	return request;
+}
+
 /**
  * Initializes 9 Event Action Definitions with eventDefinitionIDs = {0, 4, 2, 12, 1, 5, 8, 23, 3}
  */
@@ -15,12 +28,12 @@ void initializeEventActionDefinitions() {
 	uint8_t numberOfEventActionDefinitions = 9;
 	ApplicationProcessId applicationIDs[] = {1, 0, 1, 0, 0, 2, 0, 1, 0};
 	EventDefinitionId eventDefinitionIDs[] = {0, 4, 2, 12, 1, 5, 8, 23, 3};
-	String<ECSSTCRequestStringSize> data[] = {"\0", "1", "\0", "3", "4", "5", "6", "7", "8"};
+	uint16_t data[] = {0, 1, 0, 3, 4, 5, 6, 7, 8};
 	addDefinitions.appendUint8(numberOfEventActionDefinitions);
 	for (auto i = 0; i < numberOfEventActionDefinitions; i++) {
 		addDefinitions.append<ApplicationProcessId>(applicationIDs[i]);
 		addDefinitions.append<EventDefinitionId>(eventDefinitionIDs[i]);
-		addDefinitions.appendFixedString(data[i]);
+		addDefinitions.appendPacket(actionRequest(data[i]));
 	}
 	MessageParser::execute(addDefinitions);
 
@@ -36,17 +49,20 @@ TEST_CASE("Add event-action definitions TC[19,1]", "[service][st19]") {
 		addDefinition.appendUint8(1);
 		addDefinition.append<ApplicationProcessId >(0);
 		addDefinition.append<EventDefinitionId>(2);
-		String<ECSSTCRequestStringSize> data = "12345abcdefg";
-		addDefinition.appendFixedString(data);
+		Message request = actionRequest(12345);
+		request.appendString(String<ECSSTCRequestStringSize>("abcdefg"));
+		addDefinition.appendPacket(request);
 		MessageParser::execute(addDefinition);
 
 		auto element = eventActionService.eventActionDefinitionMap.find(2);
 		CHECK(element->second.applicationID == 0);
 		CHECK(element->second.eventDefinitionID == 2);
 		CHECK(!element->second.enabled);
-		for (auto i = 0; i < data.size(); ++i) {
-			CHECK(data[i] == element->second.request[i]);
-		}
+		const Message storedRequest = eventActionService.getRequest(element->second);
+		CHECK(storedRequest.serviceType == TestService::ServiceType);
+		CHECK(storedRequest.messageType == TestService::MessageType::AreYouAliveTest);
+		CHECK(storedRequest.dataSize == request.dataSize);
+		CHECK(request.bytesEqualWith(storedRequest));
 	}
 
 	SECTION("Adding multiple event-action definitions for different events") {
@@ -54,12 +70,12 @@ TEST_CASE("Add event-action definitions TC[19,1]", "[service][st19]") {
 		uint8_t numberOfEventActionDefinitions = 3;
 		ApplicationProcessId applicationIDs[] = {0, 1, 2};
 		EventDefinitionId eventDefinitionIDs[] = {3, 5, 4};
-		String<ECSSTCRequestStringSize> dataArray[] = {"123", "456", "789"};
+		uint16_t dataArray[] = {123, 456, 789};
 		addDefinitions.appendUint8(numberOfEventActionDefinitions);
 		for (auto i = 0; i < numberOfEventActionDefinitions; i++) {
 			addDefinitions.append<ApplicationProcessId>(applicationIDs[i]);
 			addDefinitions.append<EventDefinitionId>(eventDefinitionIDs[i]);
-			addDefinitions.appendFixedString(dataArray[i]);
+			addDefinitions.appendPacket(actionRequest(dataArray[i]));
 		}
 		MessageParser::execute(addDefinitions);
 
@@ -67,12 +83,11 @@ TEST_CASE("Add event-action definitions TC[19,1]", "[service][st19]") {
 			auto element = eventActionService.eventActionDefinitionMap.find(eventDefinitionIDs[i]);
 			CHECK(element->second.applicationID == applicationIDs[i]);
 			CHECK(element->second.eventDefinitionID == eventDefinitionIDs[i]);
-			CHECK(element->second.request.substr(0, 3) == dataArray[i]);
+			CHECK(eventActionService.getRequest(element->second).readUint16() == dataArray[i]);
 			CHECK(!element->second.enabled);
-			CHECK(element->second.request.size() == ECSSTCRequestStringSize);
 		}
 
-		eventActionService.eventActionDefinitionMap.clear();
+		eventActionService.clearDefinitions();
 		ServiceTests::reset();
 	}
 
@@ -81,27 +96,24 @@ TEST_CASE("Add event-action definitions TC[19,1]", "[service][st19]") {
 		addDefinitions.appendUint8(2);
 		addDefinitions.append<ApplicationProcessId>(1);
 		addDefinitions.append<EventDefinitionId>(3);
-		String<ECSSTCRequestStringSize> data = "123";
-		addDefinitions.appendFixedString(data);
+		addDefinitions.appendPacket(actionRequest(123));
 		addDefinitions.append<ApplicationProcessId>(6);
 		addDefinitions.append<EventDefinitionId>(3);
-		data = "123";
-		addDefinitions.appendFixedString(data);
+		addDefinitions.appendPacket(actionRequest(123));
 		MessageParser::execute(addDefinitions);
 
 		addDefinitions.appendUint8(1);
 		addDefinitions.append<ApplicationProcessId>(3);
 		addDefinitions.append<EventDefinitionId>(3);
-		data = "234";
-		addDefinitions.appendFixedString(data);
+		addDefinitions.appendPacket(actionRequest(234));
 		MessageParser::execute(addDefinitions);
 
 		auto element = eventActionService.eventActionDefinitionMap.find(3);
 		CHECK(element->second.applicationID == 3);
-		CHECK(element->second.request.substr(0, 3) == data);
+		CHECK(eventActionService.getRequest(element->second).readUint16() == 234);
 
 
-		eventActionService.eventActionDefinitionMap.clear();
+		eventActionService.clearDefinitions();
 		ServiceTests::reset();
 	}
 
@@ -110,8 +122,7 @@ TEST_CASE("Add event-action definitions TC[19,1]", "[service][st19]") {
 		addDefinitions.appendUint8(1);
 		addDefinitions.append<ApplicationProcessId>(0);
 		addDefinitions.append<EventDefinitionId>(3);
-		String<ECSSTCRequestStringSize> data = "456";
-		addDefinitions.appendFixedString(data);
+		addDefinitions.appendPacket(actionRequest(456));
 		MessageParser::execute(addDefinitions);
 
 		Message enableDefinitions(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
@@ -124,41 +135,37 @@ TEST_CASE("Add event-action definitions TC[19,1]", "[service][st19]") {
 		addDefinitions.appendUint8(1);
 		addDefinitions.append<ApplicationProcessId>(5);
 		addDefinitions.append<EventDefinitionId>(3);
-		data = "456";
-		addDefinitions.appendFixedString(data);
+		addDefinitions.appendPacket(actionRequest(456));
 		MessageParser::execute(addDefinitions);
 
 		CHECK(ServiceTests::thrownError(ErrorHandler::EventActionEnabledError));
 		CHECK(ServiceTests::countErrors() == 1);
 
-		eventActionService.eventActionDefinitionMap.clear();
+		eventActionService.clearDefinitions();
 		ServiceTests::reset();
 	}
 
 	SECTION("Add an event-action definition when the eventActionDefinitionMap is full") {
-		Message message(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
-		String<ECSSTCRequestStringSize> data = "123";
-		message.appendFixedString(data);
 		ApplicationProcessId applicationID = 257;
 
 		for (EventDefinitionId eventDefinitionID = 0; eventDefinitionID < 100; ++eventDefinitionID) {
-			EventActionService::EventActionDefinition temp(--applicationID, eventDefinitionID, message);
+			EventActionService::EventActionDefinition temp(--applicationID, eventDefinitionID, EventActionService::ParsedRequest());
 			eventActionService.eventActionDefinitionMap.insert(std::make_pair(eventDefinitionID, temp));
-			message.resetRead();
 		}
 
 		Message addDefinitions(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
 		addDefinitions.appendUint8(2);
 		addDefinitions.append<ApplicationProcessId>(1);
 		addDefinitions.append<EventDefinitionId>(100);
+		addDefinitions.appendPacket(actionRequest(123));
 		addDefinitions.append<ApplicationProcessId>(0);
 		addDefinitions.append<EventDefinitionId>(101);
-		addDefinitions.appendFixedString(data);
+		addDefinitions.appendPacket(actionRequest(123));
 		MessageParser::execute(addDefinitions);
 
 		CHECK(ServiceTests::thrownError(ErrorHandler::EventActionDefinitionsMapIsFull));
 		CHECK(ServiceTests::countErrors() == 2);
-		eventActionService.eventActionDefinitionMap.clear();
+		eventActionService.clearDefinitions();
 	}
 }
 
@@ -207,7 +214,7 @@ TEST_CASE("Enable event-action definitions TC[19,4]", "[service][st19]") {
 		CHECK(ServiceTests::thrownError(ErrorHandler::EventActionUnknownEventActionDefinitionError));
 		CHECK(ServiceTests::countErrors() == 2);
 
-		eventActionService.eventActionDefinitionMap.clear();
+		eventActionService.clearDefinitions();
 	}
 
 	SECTION("Enable all event action definitions") {
@@ -221,7 +228,7 @@ TEST_CASE("Enable event-action definitions TC[19,4]", "[service][st19]") {
 			CHECK(iterator.second.enabled);
 		}
 
-		eventActionService.eventActionDefinitionMap.clear();
+		eventActionService.clearDefinitions();
 	}
 }
 
@@ -283,7 +290,7 @@ TEST_CASE("Delete event-action definitions TC[19,2]", "[service][st19]") {
 		CHECK(ServiceTests::thrownError(ErrorHandler::EventActionUnknownEventActionDefinitionError));
 		CHECK(ServiceTests::countErrors() == 2);
 
-		eventActionService.eventActionDefinitionMap.clear();
+		eventActionService.clearDefinitions();
 	}
 }
 
@@ -392,12 +399,10 @@ TEST_CASE("Event-action status report TM[19,7]", "[service][st19]") {
 	addDefinitions.appendUint8(2);
 	addDefinitions.append<ApplicationProcessId>(1);
 	addDefinitions.append<EventDefinitionId>(0);
-	String<ECSSTCRequestStringSize> data = "0";
-	addDefinitions.appendFixedString(data);
+	addDefinitions.appendPacket(actionRequest(0));
 	addDefinitions.append<ApplicationProcessId>(1);
 	addDefinitions.append<EventDefinitionId>(2);
-	data = "2";
-	addDefinitions.appendFixedString(data);
+	addDefinitions.appendPacket(actionRequest(2));
 	MessageParser::execute(addDefinitions);
 
 	Message enableDefinition(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC,
@@ -443,7 +448,7 @@ TEST_CASE("Execute a TC request", "[service][st19]") {
 		messageToBeExecuted.appendUint8(1);
 		messageToBeExecuted.append<ApplicationProcessId>(0);
 		messageToBeExecuted.append<EventDefinitionId>(15);
-		addDefinition.appendMessage(messageToBeExecuted, ECSSTCRequestStringSize);
+		addDefinition.appendPacket(messageToBeExecuted);
 		MessageParser::execute(addDefinition);
 
 		Message enableDefinition(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
@@ -458,6 +463,7 @@ TEST_CASE("Execute a TC request", "[service][st19]") {
 		REQUIRE(eventActionService.getEventActionFunctionStatus());
 
 		eventActionService.executeAction(15);
+		eventActionService.executePendingActions();
 
 		CHECK(!eventActionService.eventActionDefinitionMap.find(15)->second.enabled);
 		CHECK(ServiceTests::countErrors() == 0);
@@ -475,9 +481,8 @@ TEST_CASE("Execute a TC request", "[service][st19]") {
 		messageToBeExecuted.appendUint8(1);
 		messageToBeExecuted.append<ApplicationProcessId>(0);
 		messageToBeExecuted.append<EventDefinitionId>(74);
-		String<ECSSTCRequestStringSize> data = "12345";
-		messageToBeExecuted.appendString(data);
-		addDefinition.appendMessage(messageToBeExecuted, ECSSTCRequestStringSize);
+		messageToBeExecuted.appendPacket(actionRequest(12345));
+		addDefinition.appendPacket(messageToBeExecuted);
 
 		MessageParser::execute(addDefinition);
 
@@ -488,12 +493,13 @@ TEST_CASE("Execute a TC request", "[service][st19]") {
 		MessageParser::execute(enableDefinition);
 
 		eventActionService.executeAction(9);
+		eventActionService.executePendingActions();
 
 		auto element = eventActionService.eventActionDefinitionMap.find(74);
 		CHECK(element->second.applicationID == 0);
 		CHECK(element->second.eventDefinitionID == 74);
 		CHECK(!element->second.enabled);
-		CHECK(element->second.request.size() == ECSSTCRequestStringSize);
+		CHECK(eventActionService.getRequest(element->second).readUint16() == 12345);
 	}
 
 	SECTION("Action: ParameterService::ReportParameterValues") {
@@ -508,7 +514,7 @@ TEST_CASE("Execute a TC request", "[service][st19]") {
 		TCToBeExecuted.append<ParameterId>(0);
 		TCToBeExecuted.append<ParameterId>(1);
 		TCToBeExecuted.append<ParameterId>(2);
-		addDefinition.appendMessage(TCToBeExecuted, ECSSTCRequestStringSize);
+		addDefinition.appendPacket(TCToBeExecuted);
 
 		MessageParser::execute(addDefinition);
 
@@ -519,6 +525,7 @@ TEST_CASE("Execute a TC request", "[service][st19]") {
 		MessageParser::execute(enableDefinition);
 
 		eventActionService.executeAction(10);
+		eventActionService.executePendingActions();
 
 		Message report = ServiceTests::get(0);
 		CHECK(report.serviceType == ParameterService::ServiceType);
@@ -531,4 +538,252 @@ TEST_CASE("Execute a TC request", "[service][st19]") {
 		CHECK(report.read<ParameterId>() == 2);
 		CHECK(report.readUint32() == 10);
 	}
-}
\ No newline at end of file
+}
+
+TEST_CASE("Pre-parsed event-action requests", "[service][st19]") {
+	SECTION("The request keeps the fields of its packet") {
+		Message request(TestService::ServiceType, TestService::MessageType::AreYouAliveTest, Message::TC, 7);
+		request.packetSequenceCount = 1234;
+		request.sourceId = 42;
+		request.acknowledgementFlags = Message::AcknowledgeCompletion;
+		request.appendUint32(0xDEADBEEF);
+
+		Message addDefinition(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
+		addDefinition.appendUint8(1);
+		addDefinition.append<ApplicationProcessId>(0);
+		addDefinition.append<EventDefinitionId>(6);
+		addDefinition.appendPacket(request);
+		MessageParser::execute(addDefinition);
+
+		REQUIRE(ServiceTests::countErrors() == 0);
+		Message storedRequest = eventActionService.getRequest(eventActionService.eventActionDefinitionMap.find(6)->second);
+		CHECK(storedRequest.packetType == Message::TC);
+		CHECK(storedRequest.serviceType == TestService::ServiceType);
+		CHECK(storedRequest.messageType == TestService::MessageType::AreYouAliveTest);
+		CHECK(storedRequest.applicationId == 7);
+		CHECK(storedRequest.packetSequenceCount == 1234);
+		CHECK(storedRequest.acknowledgementFlags == Message::AcknowledgeCompletion);
+		CHECK(storedRequest.readUint32() == 0xDEADBEEF);
+
+		eventActionService.clearDefinitions();
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("A request that is not a TC is rejected when it is added") {
+		Message report(TestService::ServiceType, TestService::MessageType::AreYouAliveTestReport, Message::TM, 0);
+
+		Message addDefinition(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
+		addDefinition.appendUint8(2);
+		addDefinition.append<ApplicationProcessId>(0);
+		addDefinition.append<EventDefinitionId>(6);
+		addDefinition.appendPacket(report);
+		addDefinition.append<ApplicationProcessId>(0);
+		addDefinition.append<EventDefinitionId>(7);
+		addDefinition.appendPacket(actionRequest(1));
+		MessageParser::execute(addDefinition);
+
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidEventActionRequest) == 1);
+		CHECK(eventActionService.eventActionDefinitionMap.count(6) == 0);
+		CHECK(eventActionService.eventActionDefinitionMap.count(7) == 1);
+
+		eventActionService.clearDefinitions();
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("A request with a wrong CRC is rejected when it is added") {
+		Message addDefinition(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
+		addDefinition.appendUint8(1);
+		addDefinition.append<ApplicationProcessId>(0);
+		addDefinition.append<EventDefinitionId>(6);
+		addDefinition.appendPacket(actionRequest(1));
+		addDefinition.data[addDefinition.dataSize - 1] ^= 0xFFU;
+		MessageParser::execute(addDefinition);
+
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidEventActionRequest) == 1);
+		CHECK(eventActionService.eventActionDefinitionMap.empty());
+
+		eventActionService.clearDefinitions();
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Only the enabled actions of the event are dispatched") {
+		initializeEventActionDefinitions();
+		Message enableDefinitions(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
+		enableDefinitions.appendUint8(2);
+		enableDefinitions.append<ApplicationProcessId>(0);
+		enableDefinitions.append<EventDefinitionId>(4);
+		enableDefinitions.append<ApplicationProcessId>(1);
+		enableDefinitions.append<EventDefinitionId>(23);
+		MessageParser::execute(enableDefinitions);
+		eventActionService.setEventActionFunctionStatus(true);
+
+		eventActionService.executeAction(2);
+		eventActionService.executeAction(9);
+		CHECK(eventActionService.pendingEventCount() == 0);
+
+		eventActionService.executeAction(23);
+		eventActionService.executeAction(4);
+		eventActionService.executePendingActions();
+		REQUIRE(ServiceTests::count() == 2);
+		CHECK(ServiceTests::get(0).messageType == TestService::MessageType::AreYouAliveTestReport);
+		CHECK(ServiceTests::get(1).messageType == TestService::MessageType::AreYouAliveTestReport);
+
+		eventActionService.clearDefinitions();
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("Event-action dispatch benchmark", "[.][benchmark]") {
+	constexpr uint32_t NumberOfEvents = 1000000;
+	constexpr EventDefinitionId NumberOfDefinitions = 100;
+
+	// The action re-enables the event-action function, which reports nothing, so that only the dispatch is measured
+	const Message action(EventActionService::ServiceType, EventActionService::MessageType::EnableEventActionFunction, Message::TC, 0);
+	for (EventDefinitionId eventDefinitionID = 0; eventDefinitionID < NumberOfDefinitions; eventDefinitionID++) {
+		Message addDefinition(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
+		addDefinition.appendUint8(1);
+		addDefinition.append<ApplicationProcessId>(0);
+		addDefinition.append<EventDefinitionId>(eventDefinitionID * 3);
+		addDefinition.appendPacket(action);
+		MessageParser::execute(addDefinition);
+	}
+	Message enableAll(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
+	enableAll.appendUint8(0);
+	MessageParser::execute(enableAll);
+	eventActionService.setEventActionFunctionStatus(true);
+	REQUIRE(eventActionService.eventActionDefinitionMap.size() == NumberOfDefinitions);
+
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t event = 0; event < NumberOfEvents; event++) {
+		eventActionService.executeAction((event * 7919) % (3 * NumberOfDefinitions));
+		eventActionService.executePendingActions();
+	}
+	const auto time = std::chrono::steady_clock::now() - start;
+
+	CHECK(ServiceTests::countErrors() == 0);
+	const double nanoseconds = std::chrono::duration<double, std::nano>(time).count() / NumberOfEvents;
+	WARN("Event-action dispatch: " << nanoseconds << " ns per event, a third of which have an action");
+
+	eventActionService.clearDefinitions();
+	ServiceTests::reset();
+	Services.reset();
+}
+
+namespace {
+	/**
+	 * ST[08] function that raises the event whose ID is its argument, so that actions can raise events
+	 */
+	void raiseEvent(String<ECSSFunctionMaxArgLength> argument) {
+		Services.eventReport.informativeEventReport(static_cast<EventReportService::Event>(static_cast<uint8_t>(argument[0])), "");
+	}
+
+	/**
+	 * Adds and enables an event-action definition
+	 */
+	void addEnabledDefinition(EventDefinitionId eventDefinitionID, const Message& request) {
+		Message addDefinition(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 0);
+		addDefinition.appendUint8(1);
+		addDefinition.append<ApplicationProcessId>(0);
+		addDefinition.append<EventDefinitionId>(eventDefinitionID);
+		addDefinition.appendPacket(request);
+		MessageParser::execute(addDefinition);
+
+		Message enableDefinition(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 0);
+		enableDefinition.appendUint8(1);
+		enableDefinition.append<ApplicationProcessId>(0);
+		enableDefinition.append<EventDefinitionId>(eventDefinitionID);
+		MessageParser::execute(enableDefinition);
+	}
+
+	/**
+	 * Makes an action of one event raise another event
+	 */
+	void chainEvents(EventDefinitionId eventDefinitionID, uint8_t raisedEventID) {
+		Message performFunction(FunctionManagementService::ServiceType, FunctionManagementService::MessageType::PerformFunction, Message::TC, 0);
+		performFunction.appendFixedString(String<ECSSFunctionNameLength>("raise"));
+		performFunction.appendByte(raisedEventID);
+		addEnabledDefinition(eventDefinitionID, performFunction);
+	}
+
+	/**
+	 * @return The number of TM[5,1] reports of an event
+	 */
+	size_t countEventReports(EventDefinitionId eventDefinitionID) {
+		size_t reports = 0;
+		for (size_t index = 0; index < ServiceTests::count(); index++) {
+			Message report = ServiceTests::get(index);
+			if (report.serviceType == EventReportService::ServiceType and
+			    report.messageType == EventReportService::MessageType::InformativeEventReport and
+			    report.read<EventDefinitionId>() == eventDefinitionID) {
+				reports++;
+			}
+		}
+		return reports;
+	}
+} // namespace
+
+TEST_CASE("Deferred event-action execution", "[service][st19]") {
+	Services.functionManagement.include(String<ECSSFunctionNameLength>("raise"), &raiseEvent);
+	eventActionService.setEventActionFunctionStatus(true);
+
+	SECTION("Actions are executed from the queue, after the event report") {
+		addEnabledDefinition(30, actionRequest(1));
+		ServiceTests::resetErrors();
+
+		Services.eventReport.informativeEventReport(static_cast<EventReportService::Event>(30), "");
+		REQUIRE(ServiceTests::count() == 1);
+		CHECK(eventActionService.pendingEventCount() == 1);
+
+		CHECK(eventActionService.executePendingActions() == 0);
+		REQUIRE(ServiceTests::count() == 2);
+		CHECK(ServiceTests::get(1).serviceType == TestService::ServiceType);
+	}
+
+	SECTION("The queue is bounded, and drained within a budget") {
+		addEnabledDefinition(30, actionRequest(1));
+		ServiceTests::resetErrors();
+
+		for (uint8_t i = 0; i < ECSSEventActionQueueSize + 5; i++) {
+			eventActionService.executeAction(30);
+		}
+		CHECK(eventActionService.queueOverflowCount == 5);
+		CHECK(eventActionService.executePendingActions() == ECSSEventActionQueueSize - ECSSMaxEventActionDispatchesPerTick);
+		CHECK(ServiceTests::count() == ECSSMaxEventActionDispatchesPerTick);
+	}
+
+	SECTION("Cycles are broken") {
+		chainEvents(10, 11);
+		chainEvents(11, 10);
+		ServiceTests::resetErrors();
+
+		eventActionService.executeAction(10);
+		CHECK(eventActionService.executePendingActions() == 0);
+		CHECK(countEventReports(11) == 1);
+		CHECK(countEventReports(10) == 1);
+		CHECK(eventActionService.cycleCount == 1);
+		CHECK(ServiceTests::countErrors() == 0);
+	}
+
+	SECTION("Cascades are limited in depth") {
+		for (uint8_t eventID = 20; eventID < 30; eventID++) {
+			chainEvents(eventID, eventID + 1);
+		}
+		ServiceTests::resetErrors();
+
+		eventActionService.executeAction(20);
+		while (eventActionService.executePendingActions() != 0) {}
+		for (uint8_t eventID = 21; eventID <= 21 + ECSSMaxEventActionCascadeDepth; eventID++) {
+			CHECK(countEventReports(eventID) == 1);
+		}
+		CHECK(countEventReports(22 + ECSSMaxEventActionCascadeDepth) == 0);
+		CHECK(eventActionService.cascadeDepthExceededCount == 1);
+	}
+
+	eventActionService.clearDefinitions();
+	ServiceTests::reset();
+	Services.reset();
+}
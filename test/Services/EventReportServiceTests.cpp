@@ -178,3 +178,234 @@ TEST_CASE("List of observables 6.5.6", "[service][st05]") {
 	CHECK(eventReportService.lastHighSeverityReportID == 65535);
 
 }
+
+TEST_CASE("Event catalogue beyond the predefined events", "[service][st05]") {
+	const EventDefinitionId highestID = EventReportService::NumberOfEvents - 1;
+
+	SECTION("Any ID of the catalogue can be reported") {
+		eventReportService.informativeEventReport(static_cast<EventReportService::Event>(highestID), "");
+		REQUIRE(ServiceTests::hasOneMessage());
+		CHECK(ServiceTests::get(0).read<EventDefinitionId>() == highestID);
+	}
+
+	SECTION("Unknown IDs are rejected, and the rest of the TC is applied") {
+		Message message(EventReportService::ServiceType, EventReportService::MessageType::DisableReportGenerationOfEvents, Message::TC, 1);
+		message.appendUint16(3);
+		message.append<EventDefinitionId>(highestID);
+		message.append<EventDefinitionId>(EventReportService::NumberOfEvents);
+		message.append<EventDefinitionId>(EventReportService::MCUStart);
+		MessageParser::execute(message);
+
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::UnknownEventDefinitionId) == 1);
+		CHECK(eventReportService.getStateOfEvents()[highestID] == 0);
+		CHECK(eventReportService.getStateOfEvents()[EventReportService::MCUStart] == 0);
+		CHECK(eventReportService.disabledEventsCount == 2);
+	}
+
+	SECTION("The count of disabled events is only changed by actual changes") {
+		Message disable(EventReportService::ServiceType, EventReportService::MessageType::DisableReportGenerationOfEvents, Message::TC, 1);
+		disable.appendUint16(3);
+		disable.append<EventDefinitionId>(100);
+		disable.append<EventDefinitionId>(100);
+		disable.append<EventDefinitionId>(200);
+		MessageParser::execute(disable);
+		CHECK(eventReportService.disabledEventsCount == 2);
+
+		Message enable(EventReportService::ServiceType, EventReportService::MessageType::EnableReportGenerationOfEvents, Message::TC, 1);
+		enable.appendUint16(2);
+		enable.append<EventDefinitionId>(100);
+		enable.append<EventDefinitionId>(300);
+		MessageParser::execute(enable);
+		CHECK(eventReportService.disabledEventsCount == 1);
+
+		eventReportService.disableAllEvents();
+		CHECK(eventReportService.disabledEventsCount == EventReportService::NumberOfEvents);
+	}
+
+	SECTION("The disabled events are split in several reports") {
+		eventReportService.disableAllEvents();
+		eventReportService.listOfDisabledEventsReport();
+
+		uint32_t reportedEvents = 0;
+		EventDefinitionId expectedID = 0;
+		for (size_t index = 0; index < ServiceTests::count(); index++) {
+			Message report = ServiceTests::get(index);
+			REQUIRE(report.messageType == EventReportService::MessageType::DisabledListEventReport);
+			const uint16_t eventsInReport = report.readHalfword();
+			CHECK(report.dataSize == sizeof(uint16_t) + eventsInReport * sizeof(EventDefinitionId));
+			for (uint16_t i = 0; i < eventsInReport; i++) {
+				CHECK(report.read<EventDefinitionId>() == expectedID++);
+			}
+			reportedEvents += eventsInReport;
+		}
+		CHECK(ServiceTests::count() > 1);
+		CHECK(reportedEvents == EventReportService::NumberOfEvents);
+	}
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+namespace {
+	/**
+	 * Advances the mock time by a number of seconds
+	 */
+	void advanceTime(uint32_t seconds) {
+		UTCTimestamp time = ServiceTests::getMockTime();
+		time += std::chrono::seconds(seconds);
+		ServiceTests::setMockTime(time);
+	}
+
+	/**
+	 * Reports a low severity anomaly several times, and returns how many reports were generated
+	 */
+	size_t reportStorm(EventReportService::Event eventID, uint32_t occurrences) {
+		const uint16_t reportsBefore = eventReportService.lowSeverityReportCount;
+		for (uint32_t i = 0; i < occurrences; i++) {
+			eventReportService.lowSeverityAnomalyReport(eventID, "");
+		}
+		return eventReportService.lowSeverityReportCount - reportsBefore;
+	}
+} // namespace
+
+TEST_CASE("Event rate limiting", "[service][st05]") {
+	SECTION("Token bucket") {
+		REQUIRE(eventReportService.setRateLimit(EventReportService::WWDGReset, EventReportService::RateLimitType::TokenBucket, 3,
+		                                        std::chrono::seconds(2)));
+
+		CHECK(reportStorm(EventReportService::WWDGReset, 1000) == 3);
+		CHECK(eventReportService.lowSeverityEventCount == 1000);
+		CHECK(eventReportService.suppressedEventsCount == 997);
+		CHECK(ServiceTests::count() == 3);
+
+		advanceTime(3);
+		CHECK(reportStorm(EventReportService::WWDGReset, 10) == 1);
+
+		// The suppressed occurrences are summarised right before the next report
+		REQUIRE(ServiceTests::count() == 5);
+		Message summary = ServiceTests::get(3);
+		CHECK(summary.messageType == EventReportService::MessageType::SuppressedEventsSummaryReport);
+		CHECK(summary.read<EventDefinitionId>() == EventReportService::WWDGReset);
+		CHECK(summary.readUint32() == 997);
+		CHECK(ServiceTests::get(4).messageType == EventReportService::MessageType::LowSeverityAnomalyReport);
+
+		advanceTime(60);
+		CHECK(reportStorm(EventReportService::WWDGReset, 10) == 3);
+
+		// Other events are not limited
+		CHECK(reportStorm(EventReportService::MCUStart, 10) == 10);
+	}
+
+	SECTION("Minimum interval") {
+		Message setLimits(EventReportService::ServiceType, EventReportService::MessageType::SetEventRateLimits, Message::TC, 1);
+		setLimits.appendUint16(1);
+		setLimits.append<EventDefinitionId>(EventReportService::AssertionFail);
+		setLimits.appendUint8(static_cast<uint8_t>(EventReportService::RateLimitType::MinimumInterval));
+		setLimits.appendUint16(0);
+		setLimits.appendUint32(5000);
+		MessageParser::execute(setLimits);
+		REQUIRE(ServiceTests::countErrors() == 0);
+
+		CHECK(reportStorm(EventReportService::AssertionFail, 100) == 1);
+		advanceTime(4);
+		CHECK(reportStorm(EventReportService::AssertionFail, 100) == 0);
+		advanceTime(1);
+		CHECK(reportStorm(EventReportService::AssertionFail, 100) == 1);
+
+		const EventReportService::EventRateLimit* limit = eventReportService.getRateLimit(EventReportService::AssertionFail);
+		REQUIRE(limit != nullptr);
+		CHECK(limit->pendingSuppressions == 99);
+		CHECK(limit->totalSuppressions == 298);
+	}
+
+	SECTION("Invalid rate limits") {
+		Message setLimits(EventReportService::ServiceType, EventReportService::MessageType::SetEventRateLimits, Message::TC, 1);
+		setLimits.appendUint16(4);
+		setLimits.append<EventDefinitionId>(0);
+		setLimits.appendUint8(1);
+		setLimits.appendUint16(1);
+		setLimits.appendUint32(1000);
+		setLimits.append<EventDefinitionId>(EventReportService::MCUStart);
+		setLimits.appendUint8(3);
+		setLimits.appendUint16(1);
+		setLimits.appendUint32(1000);
+		setLimits.append<EventDefinitionId>(EventReportService::MCUStart);
+		setLimits.appendUint8(static_cast<uint8_t>(EventReportService::RateLimitType::TokenBucket));
+		setLimits.appendUint16(0);
+		setLimits.appendUint32(1000);
+		setLimits.append<EventDefinitionId>(EventReportService::MCUStart);
+		setLimits.appendUint8(static_cast<uint8_t>(EventReportService::RateLimitType::MinimumInterval));
+		setLimits.appendUint16(1);
+		setLimits.appendUint32(1050);
+		MessageParser::execute(setLimits);
+
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::UnknownEventDefinitionId) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidEventRateLimit) == 3);
+		CHECK(eventReportService.getRateLimit(EventReportService::MCUStart) == nullptr);
+
+		for (EventDefinitionId eventID = 1; eventID <= ECSSMaxRateLimitedEvents; eventID++) {
+			CHECK(eventReportService.setRateLimit(eventID, EventReportService::RateLimitType::MinimumInterval, 1, std::chrono::seconds(1)));
+		}
+		CHECK_FALSE(eventReportService.setRateLimit(100, EventReportService::RateLimitType::MinimumInterval, 1, std::chrono::seconds(1)));
+		CHECK(eventReportService.setRateLimit(1, EventReportService::RateLimitType::None, 0, std::chrono::seconds(0)));
+		CHECK(eventReportService.getRateLimit(1) == nullptr);
+	}
+
+	SECTION("Intervals are rounded up to the time resolution") {
+		REQUIRE(eventReportService.setRateLimit(EventReportService::MCUStart, EventReportService::RateLimitType::MinimumInterval, 1,
+		                                        EventReportService::RateLimitIntervalResolution + std::chrono::milliseconds(1)));
+		CHECK(eventReportService.getRateLimit(EventReportService::MCUStart)->interval == 2 * EventReportService::RateLimitIntervalResolution);
+	}
+
+	SECTION("Suppressed occurrences still execute their actions") {
+		Message addDefinition(EventActionService::ServiceType, EventActionService::MessageType::AddEventAction, Message::TC, 1);
+		addDefinition.appendUint8(1);
+		addDefinition.append<ApplicationProcessId>(0);
+		addDefinition.append<EventDefinitionId>(EventReportService::WWDGReset);
+		addDefinition.appendPacket(Message(17, 1, Message::TC, 1));
+		MessageParser::execute(addDefinition);
+		Message enableDefinition(EventActionService::ServiceType, EventActionService::MessageType::EnableEventAction, Message::TC, 1);
+		enableDefinition.appendUint8(1);
+		enableDefinition.append<ApplicationProcessId>(0);
+		enableDefinition.append<EventDefinitionId>(EventReportService::WWDGReset);
+		MessageParser::execute(enableDefinition);
+		Services.eventAction.setEventActionFunctionStatus(true);
+
+		REQUIRE(eventReportService.setRateLimit(EventReportService::WWDGReset, EventReportService::RateLimitType::TokenBucket, 1,
+		                                        std::chrono::seconds(10)));
+		CHECK(reportStorm(EventReportService::WWDGReset, 5) == 1);
+		CHECK(Services.eventAction.pendingEventCount() == 5);
+
+		Services.eventAction.clearDefinitions();
+	}
+
+	SECTION("Suppression statistics report") {
+		eventReportService.setRateLimit(EventReportService::UnknownEvent, EventReportService::RateLimitType::TokenBucket, 1,
+		                                std::chrono::seconds(10));
+		eventReportService.setRateLimit(EventReportService::MCUStart, EventReportService::RateLimitType::MinimumInterval, 1,
+		                                std::chrono::seconds(10));
+		reportStorm(EventReportService::UnknownEvent, 5);
+		reportStorm(EventReportService::MCUStart, 3);
+		ServiceTests::resetErrors();
+
+		Message request(EventReportService::ServiceType, EventReportService::MessageType::ReportEventSuppressionStatistics, Message::TC, 1);
+		MessageParser::execute(request);
+		REQUIRE(ServiceTests::hasOneMessage());
+
+		Message report = ServiceTests::get(0);
+		CHECK(report.messageType == EventReportService::MessageType::EventSuppressionStatisticsReport);
+		CHECK(report.readUint32() == 6);
+		CHECK(report.readUint16() == 2);
+		CHECK(report.read<EventDefinitionId>() == EventReportService::UnknownEvent);
+		CHECK(report.readUint8() == static_cast<uint8_t>(EventReportService::RateLimitType::TokenBucket));
+		CHECK(report.readUint32() == 4);
+		CHECK(report.readUint32() == 4);
+		CHECK(report.read<EventDefinitionId>() == EventReportService::MCUStart);
+		CHECK(report.readUint8() == static_cast<uint8_t>(EventReportService::RateLimitType::MinimumInterval));
+		CHECK(report.readUint32() == 2);
+		CHECK(report.readUint32() == 2);
+	}
+
+	ServiceTests::reset();
+	Services.reset();
+}
@@ -22,6 +22,8 @@ TEST_CASE("Create a file TC[23,1]", "[service][st23]") {
 		message.appendOctetString(repo1);
 		message.appendOctetString(file1);
 
+		uint32_t maxFileSizeBytes = 100;
+		message.appendUint32(maxFileSizeBytes);
 		bool isFileLocked = false;
 		message.appendBoolean(isFileLocked);
 
@@ -110,6 +112,7 @@ TEST_CASE("Create a file TC[23,1]", "[service][st23]") {
 		message11.appendOctetString(file11);
 		uint32_t maxFileSizeBytes = 100;
 		message11.appendUint32(maxFileSizeBytes);
+		message11.appendBoolean(false);
 
 		MessageParser::execute(message11);
 		CHECK(ServiceTests::countErrors() == 1);
@@ -46,6 +46,20 @@ TEST_CASE("ST[08] - Call Tests") {
 		CHECK(globalVariable == 10);
 	}
 
+	SECTION("Truncated name") {
+		ServiceTests::reset();
+		globalVariable = 10;
+
+		fms.include(String<ECSSFunctionNameLength>("test"), &test);
+		Message msg(FunctionManagementService::ServiceType, FunctionManagementService::MessageType::PerformFunction, Message::TC, 1);
+		msg.appendString(String<ECSSFunctionNameLength>("tes"));
+		MessageParser::execute(msg);
+
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::MessageTooShort) == 1);
+		CHECK(ServiceTests::count() == 1);
+		CHECK(globalVariable == 10);
+	}
+
 	SECTION("Too long message") {
 		ServiceTests::reset();
 		globalVariable = 10;
@@ -86,7 +86,7 @@ TEST_CASE("Enable Parameter Monitoring Definitions") {
 		Message request =
 		    Message(OnBoardMonitoringService::ServiceType,
 		            OnBoardMonitoringService::MessageType::EnableParameterMonitoringDefinitions, Message::TC, 0);
-		uint16_t numberOfIds = 4;
+		uint16_t numberOfIds = 3;
 		request.appendUint16(numberOfIds);
 		etl::array<ParameterId, 4> PMONIds = {0, 10, 1};
 		request.append<ParameterId>(PMONIds[0]);
@@ -220,6 +220,7 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 		request.appendUint16(numberOfIds);
 		ParameterId PMONId = 0;
 		ParameterId monitoredParameterId = 0;
+		PMONMonitoringInterval monitoringInterval = 3;
 		PMONRepetitionNumber repetitionNumber = 5;
 		PMONBitMask expectedValueCheckMask = 2;
 		PMONExpectedValue expectedValue = 10;
@@ -231,6 +232,7 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 
 		request.appendEnum16(PMONId);
 		request.append<ParameterId>(monitoredParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.append<PMONRepetitionNumber>(repetitionNumber);
 		request.append<PMON::CheckType>(PMON::CheckType::Limit);
 		request.append<PMONLimit>(lowLimit);
@@ -245,6 +247,7 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 		auto definition = onBoardMonitoringService.getPMONDefinition(PMONId);
 		auto& pmon = definition.get();
 
+		CHECK(pmon.getMonitoringInterval() == monitoringInterval);
 		CHECK(pmon.getRepetitionNumber() == repetitionNumber);
 		CHECK(pmon.isMonitoringEnabled() == false);
 		CHECK(pmon.getCheckingStatus() == PMON::Unchecked);
@@ -263,14 +266,19 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 		initialiseParameterMonitoringDefinitions();
 		uint16_t numberOfIds = 1;
 		ParameterId monitoredParameterId = 5;
+		PMONMonitoringInterval monitoringInterval = 1;
 		PMONRepetitionNumber repetitionNumber = 5;
 		Message request =
 		    Message(OnBoardMonitoringService::ServiceType,
 		            OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
 		request.appendUint16(numberOfIds);
 		request.append<ParameterId>(monitoredParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.append<PMONRepetitionNumber>(repetitionNumber);
 		request.append<PMON::CheckType>(PMON::CheckType::ExpectedValue);
+		request.append<PMONBitMask>(0);
+		request.append<PMONExpectedValue>(0);
+		request.append<EventDefinitionId>(0);
 
 		MessageParser::execute(request);
 		CHECK(ServiceTests::count() == 1);
@@ -283,6 +291,7 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 		initialiseParameterMonitoringDefinitions();
 		uint16_t numberOfIds = 1;
 		ParameterId monitoredParameterId = 0;
+		PMONMonitoringInterval monitoringInterval = 1;
 		PMONRepetitionNumber repetitionNumber = 0;
 
 		Message request =
@@ -290,8 +299,12 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 		            OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
 		request.appendUint16(numberOfIds);
 		request.append<ParameterId>(monitoredParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.append<PMONRepetitionNumber>(repetitionNumber);
 		request.append<PMON::CheckType>(PMON::CheckType::ExpectedValue);
+		request.append<PMONBitMask>(0);
+		request.append<PMONExpectedValue>(0);
+		request.append<EventDefinitionId>(0);
 
 		MessageParser::execute(request);
 		CHECK(ServiceTests::count() == 1);
@@ -302,14 +315,23 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 
 	SECTION("Add Parameter Monitoring Definition with a non-existing parameter") {
 		uint16_t numberOfIds = 1;
+		ParameterId PMONId = 0;
+		ParameterId nonExistingParameterId = 512;
+		PMONMonitoringInterval monitoringInterval = 1;
 		PMONRepetitionNumber repetitionNumber = 5;
 
 		Message request =
 		    Message(OnBoardMonitoringService::ServiceType,
 		            OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
 		request.appendUint16(numberOfIds);
+		request.append<ParameterId>(PMONId);
+		request.append<ParameterId>(nonExistingParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.append<PMONRepetitionNumber>(repetitionNumber);
 		request.append<PMON::CheckType>(PMON::CheckType::ExpectedValue);
+		request.append<PMONBitMask>(0);
+		request.append<PMONExpectedValue>(0);
+		request.append<EventDefinitionId>(0);
 
 		MessageParser::execute(request);
 		CHECK(ServiceTests::count() == 1);
@@ -322,6 +344,7 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 		uint16_t numberOfIds = 1;
 		ParameterId PMONId = 0;
 		ParameterId monitoredParameterId = 0;
+		PMONMonitoringInterval monitoringInterval = 1;
 		PMONRepetitionNumber repetitionNumber = 5;
 		PMONLimit lowLimit = 6;
 		PMONLimit highLimit = 2;
@@ -334,6 +357,7 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 		request.appendUint16(numberOfIds);
 		request.append<ParameterId>(PMONId);
 		request.append<ParameterId>(monitoredParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.append<PMONRepetitionNumber>(repetitionNumber);
 		request.append<PMON::CheckType>(PMON::CheckType::Limit);
 		request.append<PMONLimit>(lowLimit);
@@ -352,6 +376,7 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 		uint16_t numberOfIds = 1;
 		ParameterId PMONId = 0;
 		ParameterId monitoredParameterId = 0;
+		PMONMonitoringInterval monitoringInterval = 1;
 		PMONRepetitionNumber repetitionNumber = 5;
 		DeltaThreshold lowDeltaThreshold = 8;
 		DeltaThreshold highDeltaThreshold = 2;
@@ -365,6 +390,7 @@ TEST_CASE("Add Parameter Monitoring Definitions") {
 		request.appendUint16(numberOfIds);
 		request.append<ParameterId>(PMONId);
 		request.appendUint16(monitoredParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.appendUint16(repetitionNumber);
 		request.append<PMON::CheckType>(PMON::CheckType::Delta);
 		request.append<DeltaThreshold>(lowDeltaThreshold);
@@ -456,6 +482,7 @@ TEST_CASE("Modify Parameter Monitoring Definitions") {
 		uint16_t numberOfIds = 1;
 		ParameterId PMONId = 1;
 		ParameterId monitoredParameterId = 6;
+		PMONMonitoringInterval monitoringInterval = 1;
 		PMONRepetitionNumber repetitionNumber = 5;
 		PMONLimit lowLimit = 4;
 		PMONLimit highLimit = 10;
@@ -467,6 +494,7 @@ TEST_CASE("Modify Parameter Monitoring Definitions") {
 		request.appendUint16(numberOfIds);
 		request.append<ParameterId>(PMONId);
 		request.append<ParameterId>(monitoredParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.append<PMONRepetitionNumber>(repetitionNumber);
 		request.append<PMON::CheckType>(PMON::CheckType::Limit);
 		request.append<PMONLimit>(lowLimit);
@@ -497,6 +525,7 @@ TEST_CASE("Modify Parameter Monitoring Definitions") {
 		uint16_t numberOfIds = 1;
 		ParameterId PMONIdNotInList = 100;
 		ParameterId monitoredParameterId = 7;
+		PMONMonitoringInterval monitoringInterval = 1;
 		PMONRepetitionNumber repetitionNumber = 5;
 		PMONLimit lowLimit = 4;
 		PMONLimit highLimit = 10;
@@ -508,6 +537,7 @@ TEST_CASE("Modify Parameter Monitoring Definitions") {
 		request.appendUint16(numberOfIds);
 		request.append<ParameterId>(PMONIdNotInList);
 		request.append<ParameterId>(monitoredParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.append<PMONRepetitionNumber>(repetitionNumber);
 		request.append<PMON::CheckType>(PMON::CheckType::Limit);
 		request.append<PMONLimit>(lowLimit);
@@ -528,6 +558,7 @@ TEST_CASE("Modify Parameter Monitoring Definitions") {
 		uint16_t numberOfIds = 1;
 		ParameterId existingPMONId = 1;
 		ParameterId wrongMonitoredParameterId = 999;
+		PMONMonitoringInterval monitoringInterval = 1;
 		PMONRepetitionNumber repetitionNumber = 5;
 		PMONLimit lowLimit = 4;
 		PMONLimit highLimit = 10;
@@ -539,6 +570,7 @@ TEST_CASE("Modify Parameter Monitoring Definitions") {
 		request.appendUint16(numberOfIds);
 		request.append<ParameterId>(existingPMONId);
 		request.append<ParameterId>(wrongMonitoredParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.append<PMONRepetitionNumber>(repetitionNumber);
 		request.append<PMON::CheckType>(PMON::CheckType::Limit);
 		request.append<PMONLimit>(lowLimit);
@@ -559,6 +591,7 @@ TEST_CASE("Modify Parameter Monitoring Definitions") {
 		uint16_t numberOfIds = 1;
 		ParameterId PMONId = 1;
 		ParameterId monitoredParameterId = 6;
+		PMONMonitoringInterval monitoringInterval = 1;
 		PMONRepetitionNumber repetitionNumber = 5;
 		PMONLimit lowLimit = 10;
 		PMONLimit highLimit = 4;
@@ -570,6 +603,7 @@ TEST_CASE("Modify Parameter Monitoring Definitions") {
 		request.appendUint16(numberOfIds);
 		request.append<ParameterId>(PMONId);
 		request.append<ParameterId>(monitoredParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.append<PMONRepetitionNumber>(repetitionNumber);
 		request.append<PMON::CheckType> (PMON::CheckType::Limit);
 		request.append<PMONLimit>(lowLimit);
@@ -590,6 +624,7 @@ TEST_CASE("Modify Parameter Monitoring Definitions") {
 		uint16_t numberOfIds = 1;
 		ParameterId PMONId = 1;
 		ParameterId monitoredParameterId = 6;
+		PMONMonitoringInterval monitoringInterval = 1;
 		PMONRepetitionNumber repetitionNumber = 5;
 		DeltaThreshold lowDeltaThreshold = 8;
 		DeltaThreshold highDeltaThreshold = 2;
@@ -603,6 +638,7 @@ TEST_CASE("Modify Parameter Monitoring Definitions") {
 		request.appendUint16(numberOfIds);
 		request.append<ParameterId>(PMONId);
 		request.appendUint16(monitoredParameterId);
+		request.append<PMONMonitoringInterval>(monitoringInterval);
 		request.appendUint16(repetitionNumber);
 		request.append<PMON::CheckType>(PMON::CheckType::Delta);
 		request.append<DeltaThreshold>(lowDeltaThreshold);
@@ -647,6 +683,7 @@ TEST_CASE("Report Parameter Monitoring Definitions") {
 		CHECK(report.readEnum16() == PMONIds[0]);
 		CHECK(report.read<ParameterId>() == onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoredParameterId);
 		CHECK(report.readEnum8() == onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoringEnabled);
+		CHECK(report.read<PMONMonitoringInterval>() == onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoringInterval);
 		CHECK(report.read<PMONRepetitionNumber>() == onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().repetitionNumber);
 
 		REQUIRE(pmon0.getCheckType() == PMON::CheckType::ExpectedValue);
@@ -661,6 +698,7 @@ TEST_CASE("Report Parameter Monitoring Definitions") {
 		CHECK(report.readEnum16() == PMONIds[1]);
 		CHECK(report.read<ParameterId>() == onBoardMonitoringService.getPMONDefinition(PMONIds[1]).get().monitoredParameterId);
 		CHECK(report.readEnum8() == onBoardMonitoringService.getPMONDefinition(PMONIds[1]).get().monitoringEnabled);
+		CHECK(report.read<PMONMonitoringInterval>() == onBoardMonitoringService.getPMONDefinition(PMONIds[1]).get().monitoringInterval);
 		CHECK(report.read<PMONRepetitionNumber>() == onBoardMonitoringService.getPMONDefinition(PMONIds[1]).get().repetitionNumber);
 
 		REQUIRE(pmon1.getCheckType() == PMON::CheckType::Limit);
@@ -675,6 +713,7 @@ TEST_CASE("Report Parameter Monitoring Definitions") {
 		CHECK(report.readEnum16() == PMONIds[2]);
 		CHECK(report.read<ParameterId>() == onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().monitoredParameterId);
 		CHECK(report.readEnum8() == onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().monitoringEnabled);
+		CHECK(report.read<PMONMonitoringInterval>() == onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().monitoringInterval);
 		CHECK(report.read<PMONRepetitionNumber>() == onBoardMonitoringService.getPMONDefinition(PMONIds[2]).get().repetitionNumber);
 
 		REQUIRE(pmon2.getCheckType() == PMON::CheckType::Delta);
@@ -690,6 +729,7 @@ TEST_CASE("Report Parameter Monitoring Definitions") {
 		CHECK(report.readEnum16() == PMONIds[3]);
 		CHECK(report.read<ParameterId>() == onBoardMonitoringService.getPMONDefinition(PMONIds[3]).get().monitoredParameterId);
 		CHECK(report.readEnum8() == onBoardMonitoringService.getPMONDefinition(PMONIds[3]).get().monitoringEnabled);
+		CHECK(report.read<PMONMonitoringInterval>() == onBoardMonitoringService.getPMONDefinition(PMONIds[3]).get().monitoringInterval);
 		CHECK(report.read<PMONRepetitionNumber>() == onBoardMonitoringService.getPMONDefinition(PMONIds[3]).get().repetitionNumber);
 
 		REQUIRE(pmon3.getCheckType() == PMON::CheckType::Delta);
@@ -748,6 +788,7 @@ TEST_CASE("Report Parameter Monitoring Definitions") {
 		CHECK(report.readEnum16() == PMONIds[0]);
 		CHECK(report.read<ParameterId>() == onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoredParameterId);
 		CHECK(report.readEnum8() == onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoringEnabled);
+		CHECK(report.read<PMONMonitoringInterval>() == onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().monitoringInterval);
 		CHECK(report.read<PMONRepetitionNumber>() == onBoardMonitoringService.getPMONDefinition(PMONIds[0]).get().repetitionNumber);
 
 		REQUIRE(pmon0.getCheckType() == PMON::CheckType::ExpectedValue);
@@ -1206,3 +1247,558 @@ TEST_CASE("Check All Behavior") {
     }
 }
 
+
+/**
+ * Counts the TM[12,12] reports among the queued messages
+ */
+uint64_t countCheckTransitionReports() {
+	uint64_t reports = 0;
+	for (uint64_t i = 0; i < ServiceTests::count(); i++) {
+		const Message& message = ServiceTests::get(i);
+		if (message.serviceType == OnBoardMonitoringService::ServiceType and
+		    message.messageType == OnBoardMonitoringService::MessageType::CheckTransitionReport) {
+			reports++;
+		}
+	}
+	return reports;
+}
+
+TEST_CASE("Check Transition Reporting") {
+	SECTION("Confirmed transition is reported and raises its event") {
+		initialiseParameterMonitoringDefinitions();
+		onBoardMonitoringService.getPMONDefinition(0).get().monitoringEnabled = false;
+		auto& pmon = onBoardMonitoringService.getPMONDefinition(1).get();
+		auto& param = static_cast<Parameter<unsigned char>&>(pmon.monitoredParameter.get());
+		pmon.monitoringEnabled = true;
+		pmon.repetitionNumber = 2;
+
+		param.setValue(1);
+		onBoardMonitoringService.checkAll();
+		CHECK(ServiceTests::count() == 0);
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 0);
+
+		onBoardMonitoringService.checkAll();
+		REQUIRE(ServiceTests::count() == 2);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InternalErrorType::InvalidEventID) == 0);
+
+		Message event = ServiceTests::get(0);
+		CHECK(event.serviceType == EventReportService::ServiceType);
+		CHECK(event.messageType == EventReportService::MessageType::LowSeverityAnomalyReport);
+		CHECK(event.read<EventDefinitionId>() == 1);
+
+		Message report = ServiceTests::get(1);
+		CHECK(report.serviceType == OnBoardMonitoringService::ServiceType);
+		CHECK(report.messageType == OnBoardMonitoringService::MessageType::CheckTransitionReport);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.read<ParameterId>() == 1);
+		CHECK(report.read<ParameterId>() == pmon.monitoredParameterId);
+		CHECK(report.read<PMON::CheckType>() == PMON::CheckType::Limit);
+		CHECK(report.readDouble() == 1);
+		CHECK(report.readDouble() == 2);
+		CHECK(report.read<PMON::CheckingStatus>() == PMON::Unchecked);
+		CHECK(report.read<PMON::CheckingStatus>() == PMON::BelowLowLimit);
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 0);
+
+		onBoardMonitoringService.checkAll();
+		CHECK(ServiceTests::count() == 2);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Transitions within the reporting delay are coalesced") {
+		initialiseParameterMonitoringDefinitions();
+		onBoardMonitoringService.getPMONDefinition(0).get().monitoringEnabled = false;
+		onBoardMonitoringService.maximumTransitionReportingDelay = 3;
+		auto& pmon = onBoardMonitoringService.getPMONDefinition(1).get();
+		auto& param = static_cast<Parameter<unsigned char>&>(pmon.monitoredParameter.get());
+		pmon.monitoringEnabled = true;
+		pmon.repetitionNumber = 1;
+
+		param.setValue(1);
+		onBoardMonitoringService.checkAll();
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 1);
+
+		param.setValue(5);
+		onBoardMonitoringService.checkAll();
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 1);
+		CHECK(ServiceTests::count() == 1);
+
+		onBoardMonitoringService.checkAll();
+		REQUIRE(ServiceTests::count() == 2);
+
+		Message report = ServiceTests::get(1);
+		CHECK(report.messageType == OnBoardMonitoringService::MessageType::CheckTransitionReport);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.read<ParameterId>() == 1);
+		CHECK(report.read<ParameterId>() == pmon.monitoredParameterId);
+		CHECK(report.read<PMON::CheckType>() == PMON::CheckType::Limit);
+		CHECK(report.readDouble() == 5);
+		CHECK(report.readDouble() == 2);
+		CHECK(report.read<PMON::CheckingStatus>() == PMON::Unchecked);
+		CHECK(report.read<PMON::CheckingStatus>() == PMON::WithinLimits);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Oscillating parameter does not grow the pending transitions") {
+		initialiseParameterMonitoringDefinitions();
+		onBoardMonitoringService.getPMONDefinition(0).get().monitoringEnabled = false;
+		onBoardMonitoringService.maximumTransitionReportingDelay = 1000;
+		auto& pmon = onBoardMonitoringService.getPMONDefinition(1).get();
+		auto& param = static_cast<Parameter<unsigned char>&>(pmon.monitoredParameter.get());
+		pmon.monitoringEnabled = true;
+		pmon.repetitionNumber = 1;
+
+		for (int cycle = 0; cycle < 100; cycle++) {
+			param.setValue((cycle % 2 == 0) ? 1 : 10);
+			onBoardMonitoringService.checkAll();
+		}
+
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 1);
+		CHECK(countCheckTransitionReports() == 0);
+
+		onBoardMonitoringService.checkTransitionReport();
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 0);
+		CHECK(countCheckTransitionReports() == 1);
+
+		onBoardMonitoringService.checkTransitionReport();
+		CHECK(countCheckTransitionReports() == 1);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Returning to the previous status cancels the pending transition") {
+		initialiseParameterMonitoringDefinitions();
+		onBoardMonitoringService.getPMONDefinition(0).get().monitoringEnabled = false;
+		onBoardMonitoringService.maximumTransitionReportingDelay = 1000;
+		auto& pmon = onBoardMonitoringService.getPMONDefinition(1).get();
+		auto& param = static_cast<Parameter<unsigned char>&>(pmon.monitoredParameter.get());
+		pmon.monitoringEnabled = true;
+		pmon.repetitionNumber = 1;
+
+		param.setValue(5);
+		onBoardMonitoringService.checkAll();
+		onBoardMonitoringService.checkTransitionReport();
+		CHECK(countCheckTransitionReports() == 1);
+
+		param.setValue(1);
+		onBoardMonitoringService.checkAll();
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 1);
+
+		param.setValue(5);
+		onBoardMonitoringService.checkAll();
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 0);
+
+		onBoardMonitoringService.checkTransitionReport();
+		CHECK(countCheckTransitionReports() == 1);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Check transition events are limited per cycle") {
+		initialiseParameterMonitoringDefinitions();
+		onBoardMonitoringService.getPMONDefinition(0).get().monitoringEnabled = false;
+		onBoardMonitoringService.maximumTransitionReportingDelay = 1000;
+		onBoardMonitoringService.maximumTransitionEventsPerCycle = 0;
+		auto& pmon = onBoardMonitoringService.getPMONDefinition(1).get();
+		auto& param = static_cast<Parameter<unsigned char>&>(pmon.monitoredParameter.get());
+		pmon.monitoringEnabled = true;
+		pmon.repetitionNumber = 1;
+
+		param.setValue(1);
+		onBoardMonitoringService.checkAll();
+		CHECK(ServiceTests::count() == 0);
+		CHECK(onBoardMonitoringService.getPendingCheckTransitionCount() == 1);
+		CHECK(onBoardMonitoringService.getSuppressedTransitionEventCount() == 1);
+
+		onBoardMonitoringService.maximumTransitionEventsPerCycle = 1;
+		param.setValue(5);
+		onBoardMonitoringService.checkAll();
+		param.setValue(1);
+		onBoardMonitoringService.checkAll();
+		REQUIRE(ServiceTests::count() == 1);
+		CHECK(ServiceTests::get(0).serviceType == EventReportService::ServiceType);
+		CHECK(onBoardMonitoringService.getSuppressedTransitionEventCount() == 1);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("Scheduled Parameter Monitoring") {
+	SECTION("Only the due definitions are checked") {
+		initialiseParameterMonitoringDefinitions();
+		onBoardMonitoringService.getPMONDefinition(0).get().monitoringEnabled = false;
+		auto& limitCheck = onBoardMonitoringService.getPMONDefinition(1).get();
+		auto& deltaCheck = onBoardMonitoringService.getPMONDefinition(2).get();
+		auto& limitParam = static_cast<Parameter<unsigned char>&>(limitCheck.monitoredParameter.get());
+		auto& deltaParam = static_cast<Parameter<unsigned char>&>(deltaCheck.monitoredParameter.get());
+		limitCheck.monitoringEnabled = true;
+		limitCheck.monitoringInterval = 3;
+		deltaCheck.monitoringEnabled = true;
+		deltaCheck.monitoringInterval = 1;
+
+		const Time::DefaultCUC startTime(1000);
+		limitParam.setValue(5);
+		deltaParam.setValue(10);
+
+		CHECK(onBoardMonitoringService.checkDueDefinitions(startTime) == startTime + ECSSMonitoringFrequency);
+		CHECK(limitCheck.getCheckingStatus() == PMON::WithinLimits);
+		CHECK(limitCheck.getRepetitionCounter() == 1);
+		CHECK(deltaCheck.getCheckingStatus() == PMON::Invalid);
+
+		CHECK(onBoardMonitoringService.checkDueDefinitions(startTime + ECSSMonitoringFrequency / 2) == startTime + ECSSMonitoringFrequency);
+		CHECK(limitCheck.getRepetitionCounter() == 1);
+		CHECK(deltaCheck.getRepetitionCounter() == 1);
+
+		deltaParam.setValue(250);
+		CHECK(onBoardMonitoringService.checkDueDefinitions(startTime + ECSSMonitoringFrequency) == startTime + 2 * ECSSMonitoringFrequency);
+		CHECK(limitCheck.getRepetitionCounter() == 1);
+		CHECK(deltaCheck.getCheckingStatus() == PMON::WithinThreshold);
+
+		onBoardMonitoringService.checkDueDefinitions(startTime + 2 * ECSSMonitoringFrequency);
+		CHECK(limitCheck.getRepetitionCounter() == 1);
+		CHECK(onBoardMonitoringService.checkDueDefinitions(startTime + 3 * ECSSMonitoringFrequency) == startTime + 4 * ECSSMonitoringFrequency);
+		CHECK(limitCheck.getRepetitionCounter() == 2);
+		CHECK(deltaCheck.getCheckingStatus() == PMON::BelowLowThreshold);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Enabling a definition makes it due immediately") {
+		initialiseParameterMonitoringDefinitions();
+		auto& limitCheck = onBoardMonitoringService.getPMONDefinition(1).get();
+		limitCheck.monitoringInterval = 10;
+		const Time::DefaultCUC startTime(1000);
+
+		onBoardMonitoringService.checkDueDefinitions(startTime);
+		CHECK(limitCheck.getCheckingStatus() == PMON::Unchecked);
+
+		Message request = Message(OnBoardMonitoringService::ServiceType,
+		                          OnBoardMonitoringService::MessageType::EnableParameterMonitoringDefinitions, Message::TC, 0);
+		request.appendUint16(1);
+		request.append<ParameterId>(1);
+		MessageParser::execute(request);
+
+		onBoardMonitoringService.checkDueDefinitions(startTime + ECSSMonitoringFrequency);
+		CHECK(limitCheck.getCheckingStatus() != PMON::Unchecked);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Empty monitoring list") {
+		const Time::DefaultCUC startTime(1000);
+		CHECK(onBoardMonitoringService.checkDueDefinitions(startTime) == startTime + ECSSMonitoringFrequency);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("Parameter Monitoring Definition Storage") {
+	SECTION("Modifying the check type re-types the definition in place") {
+		initialiseParameterMonitoringDefinitions();
+		onBoardMonitoringService.getPMONDefinition(1).get().monitoringEnabled = true;
+
+		Message request =
+		    Message(OnBoardMonitoringService::ServiceType,
+		            OnBoardMonitoringService::MessageType::ModifyParameterMonitoringDefinitions, Message::TC, 0);
+		request.appendUint16(1);
+		request.append<ParameterId>(1);
+		request.append<ParameterId>(6);
+		request.append<PMONMonitoringInterval>(2);
+		request.append<PMONRepetitionNumber>(3);
+		request.append<PMON::CheckType>(PMON::CheckType::ExpectedValue);
+		request.append<PMONBitMask>(0xFF);
+		request.append<PMONExpectedValue>(5);
+		request.append<EventDefinitionId>(3);
+
+		MessageParser::execute(request);
+		CHECK(ServiceTests::count() == 0);
+		CHECK(onBoardMonitoringService.getPMONDefinitionCount() == 4);
+
+		auto& pmon = onBoardMonitoringService.getPMONDefinition(1).get();
+		REQUIRE(pmon.checkType == PMON::CheckType::ExpectedValue);
+		CHECK(pmon.isMonitoringEnabled());
+		CHECK(pmon.getMonitoringInterval() == 2);
+		CHECK(pmon.getRepetitionNumber() == 3);
+		CHECK(static_cast<PMONExpectedValueCheck&>(pmon).getExpectedValue() == 5);
+		CHECK(static_cast<PMONExpectedValueCheck&>(pmon).getUnexpectedValueEvent() == 3);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("PMON ID out of range") {
+		Message request =
+		    Message(OnBoardMonitoringService::ServiceType,
+		            OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
+		request.appendUint16(1);
+		request.append<ParameterId>(ECSSPMONIdRange);
+		request.append<ParameterId>(6);
+		request.append<PMONMonitoringInterval>(1);
+		request.append<PMONRepetitionNumber>(1);
+		request.append<PMON::CheckType>(PMON::CheckType::ExpectedValue);
+		request.append<PMONBitMask>(0xFF);
+		request.append<PMONExpectedValue>(5);
+		request.append<EventDefinitionId>(3);
+
+		MessageParser::execute(request);
+		CHECK(ServiceTests::count() == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::PMONIdOutOfRange) == 1);
+		CHECK(onBoardMonitoringService.isPMONListEmpty());
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("Continuous PMON reconfiguration stays within the definition pool", "[.][benchmark]") {
+	const ParameterId PMONId = ECSSPMONIdRange - 1;
+
+	Message addRequest =
+	    Message(OnBoardMonitoringService::ServiceType,
+	            OnBoardMonitoringService::MessageType::AddParameterMonitoringDefinitions, Message::TC, 0);
+	addRequest.appendUint16(1);
+	addRequest.append<ParameterId>(PMONId);
+	addRequest.append<ParameterId>(6);
+	addRequest.append<PMONMonitoringInterval>(1);
+	addRequest.append<PMONRepetitionNumber>(1);
+	addRequest.append<PMON::CheckType>(PMON::CheckType::Limit);
+	addRequest.append<PMONLimit>(2);
+	addRequest.append<EventDefinitionId>(1);
+	addRequest.append<PMONLimit>(9);
+	addRequest.append<EventDefinitionId>(2);
+
+	Message deleteRequest =
+	    Message(OnBoardMonitoringService::ServiceType,
+	            OnBoardMonitoringService::MessageType::DeleteParameterMonitoringDefinitions, Message::TC, 0);
+	deleteRequest.appendUint16(1);
+	deleteRequest.append<ParameterId>(PMONId);
+
+	Time::DefaultCUC cycleTime(1000);
+	for (uint32_t iteration = 0; iteration < 1000000; iteration++) {
+		addRequest.resetRead();
+		MessageParser::execute(addRequest);
+		if (iteration % 1000 == 0) {
+			cycleTime += ECSSMonitoringFrequency;
+			onBoardMonitoringService.checkDueDefinitions(cycleTime);
+		}
+		deleteRequest.resetRead();
+		MessageParser::execute(deleteRequest);
+	}
+
+	CHECK(ServiceTests::count() == 0);
+	CHECK(onBoardMonitoringService.isPMONListEmpty());
+
+	addRequest.resetRead();
+	MessageParser::execute(addRequest);
+	CHECK(onBoardMonitoringService.getPMONDefinitionCount() == 1);
+	CHECK(onBoardMonitoringService.getPMONDefinition(PMONId).get().checkType == PMON::CheckType::Limit);
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+void addFunctionalMonitoringDefinition(FMONId id, EventDefinitionId eventId, uint16_t minimumFailingPMONs,
+                                       std::initializer_list<ParameterId> PMONIds) {
+	Message request =
+	    Message(OnBoardMonitoringService::ServiceType,
+	            OnBoardMonitoringService::MessageType::AddFunctionalMonitoringDefinitions, Message::TC, 0);
+	request.appendUint16(1);
+	request.append<FMONId>(id);
+	request.append<EventDefinitionId>(eventId);
+	request.appendUint16(minimumFailingPMONs);
+	request.appendUint16(PMONIds.size());
+	for (const ParameterId PMONId: PMONIds) {
+		request.append<ParameterId>(PMONId);
+	}
+	MessageParser::execute(request);
+}
+
+Message functionalMonitoringRequest(OnBoardMonitoringService::MessageType messageType, std::initializer_list<FMONId> FMONIds) {
+	Message request = Message(OnBoardMonitoringService::ServiceType, messageType, Message::TC, 0);
+	request.appendUint16(FMONIds.size());
+	for (const FMONId id: FMONIds) {
+		request.append<FMONId>(id);
+	}
+	return request;
+}
+
+TEST_CASE("Deleting all Parameter Monitoring Definitions keeps the protected Functional Monitoring Definitions") {
+	initialiseParameterMonitoringDefinitions();
+	onBoardMonitoringService.parameterMonitoringFunctionStatus = false;
+	addFunctionalMonitoringDefinition(4, 0, 1, {0, 1});
+	addFunctionalMonitoringDefinition(5, 0, 1, {2});
+	Message protectRequest = functionalMonitoringRequest(OnBoardMonitoringService::MessageType::ProtectFunctionalMonitoringDefinitions, {4});
+	MessageParser::execute(protectRequest);
+	REQUIRE(onBoardMonitoringService.getFMONDefinitionCount() == 2);
+
+	Message request = Message(OnBoardMonitoringService::ServiceType,
+	                          OnBoardMonitoringService::MessageType::DeleteAllParameterMonitoringDefinitions, Message::TC, 0);
+	MessageParser::execute(request);
+	CHECK(ServiceTests::count() == 0);
+
+	CHECK(onBoardMonitoringService.getFMONDefinitionCount() == 1);
+	CHECK(onBoardMonitoringService.findFMONDefinition(4) != nullptr);
+	CHECK(onBoardMonitoringService.findFMONDefinition(5) == nullptr);
+	CHECK(onBoardMonitoringService.getPMONDefinitionCount() == 2);
+	CHECK(onBoardMonitoringService.getPMONDefinition(0).get().checkType == PMON::CheckType::ExpectedValue);
+	CHECK(onBoardMonitoringService.getPMONDefinition(1).get().checkType == PMON::CheckType::Limit);
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Functional Monitoring Definitions") {
+	SECTION("Add, report and delete definitions") {
+		initialiseParameterMonitoringDefinitions();
+
+		addFunctionalMonitoringDefinition(4, 3, 2, {1, 2, 3});
+		CHECK(ServiceTests::count() == 0);
+		REQUIRE(onBoardMonitoringService.findFMONDefinition(4) != nullptr);
+		CHECK(onBoardMonitoringService.getFMONDefinitionCount() == 1);
+
+		Message reportRequest = functionalMonitoringRequest(OnBoardMonitoringService::MessageType::ReportFunctionalMonitoringDefinitions, {4, 5});
+		MessageParser::execute(reportRequest);
+		REQUIRE(ServiceTests::count() == 2);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::GetNonExistingFunctionalMonitoringDefinition) == 1);
+
+		Message report = ServiceTests::get(1);
+		CHECK(report.messageType == OnBoardMonitoringService::MessageType::FunctionalMonitoringDefinitionReport);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.read<FMONId>() == 4);
+		CHECK(report.readBoolean() == false);
+		CHECK(report.readBoolean() == false);
+		CHECK(report.read<EventDefinitionId>() == 3);
+		CHECK(report.readUint16() == 2);
+		CHECK(report.readUint16() == 3);
+		CHECK(report.read<ParameterId>() == 1);
+		CHECK(report.read<ParameterId>() == 2);
+		CHECK(report.read<ParameterId>() == 3);
+
+		Message deletePMONRequest =
+		    Message(OnBoardMonitoringService::ServiceType,
+		            OnBoardMonitoringService::MessageType::DeleteParameterMonitoringDefinitions, Message::TC, 0);
+		deletePMONRequest.appendUint16(1);
+		deletePMONRequest.append<ParameterId>(2);
+		MessageParser::execute(deletePMONRequest);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidRequestToDeleteParameterMonitoringDefinition) == 1);
+
+		Message protectRequest = functionalMonitoringRequest(OnBoardMonitoringService::MessageType::ProtectFunctionalMonitoringDefinitions, {4});
+		MessageParser::execute(protectRequest);
+		Message deleteRequest = functionalMonitoringRequest(OnBoardMonitoringService::MessageType::DeleteFunctionalMonitoringDefinitions, {4});
+		MessageParser::execute(deleteRequest);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidRequestToDeleteFunctionalMonitoringDefinition) == 1);
+		CHECK(onBoardMonitoringService.findFMONDefinition(4) != nullptr);
+
+		Message unprotectRequest = functionalMonitoringRequest(OnBoardMonitoringService::MessageType::UnprotectFunctionalMonitoringDefinitions, {4});
+		MessageParser::execute(unprotectRequest);
+		deleteRequest.resetRead();
+		MessageParser::execute(deleteRequest);
+		CHECK(onBoardMonitoringService.findFMONDefinition(4) == nullptr);
+		CHECK(onBoardMonitoringService.getFMONDefinitionCount() == 0);
+
+		deletePMONRequest.resetRead();
+		MessageParser::execute(deletePMONRequest);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidRequestToDeleteParameterMonitoringDefinition) == 1);
+		CHECK(onBoardMonitoringService.getPMONDefinitionCount() == 3);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Invalid definitions are rejected") {
+		initialiseParameterMonitoringDefinitions();
+
+		addFunctionalMonitoringDefinition(ECSSFMONIdRange, 3, 1, {1});
+		addFunctionalMonitoringDefinition(0, 3, 0, {1});
+		addFunctionalMonitoringDefinition(0, 3, 3, {1, 2});
+		addFunctionalMonitoringDefinition(0, 3, 1, {1, 1});
+		addFunctionalMonitoringDefinition(0, 3, 1, {1, 200});
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidFunctionalMonitoringDefinition) == 5);
+		CHECK(onBoardMonitoringService.getFMONDefinitionCount() == 0);
+
+		addFunctionalMonitoringDefinition(0, 3, 1, {1});
+		addFunctionalMonitoringDefinition(0, 3, 1, {2});
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::AddAlreadyExistingFunctionalMonitoringDefinition) == 1);
+
+		for (FMONId id = 1; id <= ECSSMaxFunctionalMonitoringDefinitions; id++) {
+			addFunctionalMonitoringDefinition(id, 3, 1, {1});
+		}
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::FunctionalMonitoringListIsFull) == 1);
+		CHECK(onBoardMonitoringService.getFMONDefinitionCount() == ECSSMaxFunctionalMonitoringDefinitions);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("A failing definition raises its event and reports its status") {
+		initialiseParameterMonitoringDefinitions();
+		onBoardMonitoringService.getPMONDefinition(0).get().monitoringEnabled = false;
+		auto& pmon = onBoardMonitoringService.getPMONDefinition(1).get();
+		auto& param = static_cast<Parameter<unsigned char>&>(pmon.monitoredParameter.get());
+		pmon.monitoringEnabled = true;
+		pmon.repetitionNumber = 1;
+
+		addFunctionalMonitoringDefinition(2, 4, 1, {1, 3});
+		Message enableFunctionRequest(OnBoardMonitoringService::ServiceType,
+		                              OnBoardMonitoringService::MessageType::EnableFunctionalMonitoringFunction, Message::TC, 0);
+		MessageParser::execute(enableFunctionRequest);
+		Message enableRequest = functionalMonitoringRequest(OnBoardMonitoringService::MessageType::EnableFunctionalMonitoringDefinitions, {2});
+		MessageParser::execute(enableRequest);
+		CHECK(onBoardMonitoringService.functionalMonitoringFunctionStatus);
+		CHECK(ServiceTests::count() == 0);
+
+		param.setValue(1);
+		onBoardMonitoringService.checkAll();
+		REQUIRE(ServiceTests::count() == 3);
+		CHECK(ServiceTests::get(0).read<EventDefinitionId>() == 1);
+		Message event = ServiceTests::get(1);
+		CHECK(event.serviceType == EventReportService::ServiceType);
+		CHECK(event.read<EventDefinitionId>() == 4);
+		CHECK(onBoardMonitoringService.findFMONDefinition(2)->checkingStatus == FMON::CheckingStatus::Failed);
+
+		Message statusRequest(OnBoardMonitoringService::ServiceType,
+		                      OnBoardMonitoringService::MessageType::ReportStatusOfFunctionalMonitoringDefinitions, Message::TC, 0);
+		MessageParser::execute(statusRequest);
+		REQUIRE(ServiceTests::count() == 4);
+		Message report = ServiceTests::get(3);
+		CHECK(report.messageType == OnBoardMonitoringService::MessageType::FunctionalMonitoringDefinitionStatusReport);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.read<FMONId>() == 2);
+		CHECK(report.readBoolean() == true);
+		CHECK(report.readEnum8() == static_cast<uint8_t>(FMON::CheckingStatus::Failed));
+
+		param.setValue(5);
+		onBoardMonitoringService.checkAll();
+		CHECK(onBoardMonitoringService.findFMONDefinition(2)->checkingStatus == FMON::CheckingStatus::Running);
+		const size_t messageCount = ServiceTests::count();
+
+		Message disableFunctionRequest(OnBoardMonitoringService::ServiceType,
+		                               OnBoardMonitoringService::MessageType::DisableFunctionalMonitoringFunction, Message::TC, 0);
+		MessageParser::execute(disableFunctionRequest);
+		param.setValue(1);
+		onBoardMonitoringService.checkAll();
+		CHECK(onBoardMonitoringService.findFMONDefinition(2)->checkingStatus == FMON::CheckingStatus::Failed);
+		CHECK(ServiceTests::count() == messageCount + 2);
+
+		Message disablePMONRequest =
+		    Message(OnBoardMonitoringService::ServiceType,
+		            OnBoardMonitoringService::MessageType::DisableParameterMonitoringDefinitions, Message::TC, 0);
+		disablePMONRequest.appendUint16(1);
+		disablePMONRequest.append<ParameterId>(1);
+		MessageParser::execute(disablePMONRequest);
+		CHECK(onBoardMonitoringService.findFMONDefinition(2)->checkingStatus == FMON::CheckingStatus::Running);
+		CHECK(onBoardMonitoringService.findFMONDefinition(2)->failingPMONs == 0);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
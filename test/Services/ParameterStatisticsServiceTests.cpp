@@ -1,4 +1,5 @@
 #include <iostream>
+#include <iterator>
 #include "ECSS_Definitions.hpp"
 #include "Message.hpp"
 #include "ServiceTests.hpp"
@@ -27,6 +28,33 @@ void initializeStatistics(uint16_t interval1, uint16_t interval2) {
 	Services.parameterStatistics.statisticsMap.insert({id2, stat2});
 }
 
+/**
+ * Checks the evaluation start and stop times of TM[4,2], which are at the start of the report, or after the number of
+ * samples of every parameter if @ref SupportsSlidingWindowStatistics is set
+ *
+ * @param perParameter Whether the times are expected after the number of samples of a parameter
+ */
+void checkEvaluationTimes(Message& report, bool perParameter) {
+	if (perParameter == SupportsSlidingWindowStatistics) {
+		CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // start time
+		CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // end time
+	}
+}
+
+/**
+ * Checks the quantiles that follow the statistics of a parameter in TM[4,2] if @ref SupportsQuantiles is set
+ *
+ * @param expected The expected @ref ECSSStatisticsReportedQuantiles
+ */
+void checkQuantiles(Message& report, std::initializer_list<double> expected) {
+	if constexpr (SupportsQuantiles) {
+		REQUIRE(expected.size() == std::size(ECSSStatisticsReportedQuantiles));
+		for (const double quantile: expected) {
+			CHECK(report.readFloat() == Catch::Approx(quantile).epsilon(ECSSStatisticsQuantileRelativeAccuracy));
+		}
+	}
+}
+
 TEST_CASE("Reporting of statistics") {
 
 	if (not Services.parameterStatistics.HasAutomaticStatisticsReset) {
@@ -34,6 +62,7 @@ TEST_CASE("Reporting of statistics") {
 			initializeStatistics(6, 7);
 			Message request = Message(ParameterStatisticsService::ServiceType,
 			                          ParameterStatisticsService::MessageType::ReportParameterStatistics, Message::TC, 1);
+			request.appendBoolean(false);
 
 			MessageParser::execute(request);
 			CHECK(ServiceTests::count() == 1);
@@ -41,27 +70,31 @@ TEST_CASE("Reporting of statistics") {
 			Message report = ServiceTests::get(0);
 			CHECK(report.serviceType == ParameterStatisticsService::ServiceType);
 			CHECK(report.messageType == ParameterStatisticsService::MessageType::ParameterStatisticsReport);
-			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // start time
-			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // end time
+			checkEvaluationTimes(report, false);
 			CHECK(report.readUint16() == 2);                                    // number of parameters reported
 			// Parameter B
 			CHECK(report.read<ParameterId>() == 5);                             // ID-2
 			CHECK(report.read<ParameterSampleCount>() == 6);                    // number of samples
+			checkEvaluationTimes(report, true);
 			CHECK(report.readFloat() == 13);                                    // max value
 			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // max time
 			CHECK(report.readFloat() == 3);                                     // min value
 			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // min time
 			CHECK(report.readFloat() == 8);                                     // mean
 			CHECK(report.readFloat() == Catch::Approx(3.41565).epsilon(0.01));
+			checkQuantiles(report, {9, 13, 13});
 			// Parameter A
 			CHECK(report.read<ParameterId>() == 7);                             // ID-1
 			CHECK(report.read<ParameterSampleCount>() == 3);                    // number of samples
+			checkEvaluationTimes(report, true);
 			CHECK(report.readFloat() == 5);                                     // max value
 			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // max time
 			CHECK(report.readFloat() == 1);                                     // min value
 			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // min time
 			CHECK(report.readFloat() == 3);                                     // mean
 			CHECK(static_cast<int>(report.readFloat()) == 1);                   // stddev
+			checkQuantiles(report, {3, 5, 5});
+			CHECK(report.readPosition == report.dataSize);
 
 			CHECK(not Services.parameterStatistics.statisticsMap[5].statisticsAreInitialized());
 			CHECK(not Services.parameterStatistics.statisticsMap[7].statisticsAreInitialized());
@@ -94,27 +127,31 @@ TEST_CASE("Reporting of statistics") {
 			Message report = ServiceTests::get(0);
 			CHECK(report.serviceType == ParameterStatisticsService::ServiceType);
 			CHECK(report.messageType == ParameterStatisticsService::MessageType::ParameterStatisticsReport);
-			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // start time
-			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // end time
+			checkEvaluationTimes(report, false);
 			CHECK(report.readUint16() == 2);                                    // number of parameters reported
 			// Parameter B
 			CHECK(report.read<ParameterId>() == 5);                             // ID-2
 			CHECK(report.read<ParameterSampleCount>() == 6);                    // number of samples
+			checkEvaluationTimes(report, true);
 			CHECK(report.readFloat() == 13);                                    // max value
 			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // max time
 			CHECK(report.readFloat() == 3);                                     // min value
 			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // min time
 			CHECK(report.readFloat() == 8);                                     // mean
 			CHECK(report.readFloat() == Catch::Approx(3.41565).epsilon(0.01));
+			checkQuantiles(report, {9, 13, 13});
 			// Parameter A
 			CHECK(report.read<ParameterId>() == 7);                             // ID-1
 			CHECK(report.read<ParameterSampleCount>() == 3);                    // number of samples
+			checkEvaluationTimes(report, true);
 			CHECK(report.readFloat() == 5);                                     // max value
 			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // max time
 			CHECK(report.readFloat() == 1);                                     // min value
 			CHECK(report.read<Time::DefaultCUC>().formatAsBytes() == 86769000); // min time
 			CHECK(report.readFloat() == 3);                                     // mean
 			CHECK(static_cast<int>(report.readFloat()) == 1);                   // stddev
+			checkQuantiles(report, {3, 5, 5});
+			CHECK(report.readPosition == report.dataSize);
 
 			CHECK(not Services.parameterStatistics.statisticsMap[5].statisticsAreInitialized());
 			CHECK(not Services.parameterStatistics.statisticsMap[7].statisticsAreInitialized());
@@ -417,3 +454,181 @@ TEST_CASE("Parameter statistics definition report") {
 		ServiceTests::reset();
 	}
 }
+
+TEST_CASE("Sampling of statistics") {
+	Services.reset();
+	auto& parameterStatistics = Services.parameterStatistics;
+	const Time::DefaultCUC startTime = TimeGetter::getCurrentTimeDefaultCUC();
+
+	Message request =
+	    Message(ParameterStatisticsService::ServiceType,
+	            ParameterStatisticsService::MessageType::AddOrUpdateParameterStatisticsDefinitions, Message::TC, 1);
+	request.appendUint16(2);
+	request.append<ParameterId>(4);
+	request.append<SamplingInterval>(1000);
+	request.append<ParameterId>(5);
+	request.append<SamplingInterval>(2000);
+	MessageParser::execute(request);
+	REQUIRE(parameterStatistics.statisticsMap.size() == 2);
+
+	SECTION("Definitions are sampled at their own interval") {
+		parameterStatistics.setPeriodicReportingStatus(false);
+		auto& parameter = static_cast<Parameter<uint8_t>&>(Services.parameterManagement.getParameter(4)->get());
+
+		parameter.setValue(10);
+		CHECK(parameterStatistics.sampleDueStatistics(startTime) == startTime + std::chrono::seconds(1));
+		parameter.setValue(20);
+		CHECK(parameterStatistics.sampleDueStatistics(startTime + std::chrono::milliseconds(500)) == startTime + std::chrono::seconds(1));
+		CHECK(parameterStatistics.statisticsMap[4].sampleCounter == 1);
+
+		CHECK(parameterStatistics.sampleDueStatistics(startTime + std::chrono::seconds(1)) == startTime + std::chrono::seconds(2));
+		CHECK(parameterStatistics.statisticsMap[4].sampleCounter == 2);
+		CHECK(parameterStatistics.statisticsMap[5].sampleCounter == 1);
+		CHECK(parameterStatistics.statisticsMap[4].mean == 15);
+
+		parameterStatistics.sampleDueStatistics(startTime + std::chrono::seconds(2));
+		CHECK(parameterStatistics.statisticsMap[4].sampleCounter == 3);
+		CHECK(parameterStatistics.statisticsMap[5].sampleCounter == 2);
+
+		// A late call takes a single sample and does not try to catch up with the missed ones
+		CHECK(parameterStatistics.sampleDueStatistics(startTime + std::chrono::seconds(10)) == startTime + std::chrono::seconds(11));
+		CHECK(parameterStatistics.statisticsMap[4].sampleCounter == 4);
+		CHECK(parameterStatistics.statisticsMap[5].sampleCounter == 3);
+		CHECK(ServiceTests::count() == 0);
+
+		Message deleteRequest =
+		    Message(ParameterStatisticsService::ServiceType,
+		            ParameterStatisticsService::MessageType::DeleteParameterStatisticsDefinitions, Message::TC, 1);
+		deleteRequest.appendUint16(1);
+		deleteRequest.append<ParameterId>(4);
+		MessageParser::execute(deleteRequest);
+		CHECK(parameterStatistics.sampleDueStatistics(startTime + std::chrono::seconds(11)) == startTime + std::chrono::seconds(12));
+		CHECK(parameterStatistics.statisticsMap[5].sampleCounter == 3);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Statistics are reported periodically") {
+		Message enableRequest =
+		    Message(ParameterStatisticsService::ServiceType,
+		            ParameterStatisticsService::MessageType::EnablePeriodicParameterReporting, Message::TC, 1);
+		enableRequest.appendUint16(1500);
+		MessageParser::execute(enableRequest);
+
+		CHECK(parameterStatistics.sampleDueStatistics(startTime) == startTime + std::chrono::seconds(1));
+		CHECK(parameterStatistics.sampleDueStatistics(startTime + std::chrono::seconds(1)) == startTime + std::chrono::milliseconds(1500));
+		CHECK(ServiceTests::count() == 0);
+
+		CHECK(parameterStatistics.sampleDueStatistics(startTime + std::chrono::milliseconds(1500)) == startTime + std::chrono::seconds(2));
+		REQUIRE(ServiceTests::count() == 1);
+		Message report = ServiceTests::get(0);
+		CHECK(report.messageType == ParameterStatisticsService::MessageType::ParameterStatisticsReport);
+		if constexpr (not SupportsSlidingWindowStatistics) {
+			report.read<Time::DefaultCUC>();
+			report.read<Time::DefaultCUC>();
+		}
+		CHECK(report.readUint16() == 2);
+
+		parameterStatistics.sampleDueStatistics(startTime + std::chrono::seconds(3));
+		CHECK(ServiceTests::count() == 2);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("Sliding window statistics") {
+	Services.reset();
+	auto& parameterStatistics = Services.parameterStatistics;
+	const Time::DefaultCUC startTime = TimeGetter::getCurrentTimeDefaultCUC();
+
+	Message definitionRequest =
+	    Message(ParameterStatisticsService::ServiceType,
+	            ParameterStatisticsService::MessageType::AddOrUpdateParameterStatisticsDefinitions, Message::TC, 1);
+	definitionRequest.appendUint16(2);
+	definitionRequest.append<ParameterId>(4);
+	definitionRequest.append<SamplingInterval>(1000);
+	definitionRequest.append<ParameterId>(7);
+	definitionRequest.append<SamplingInterval>(1000);
+	MessageParser::execute(definitionRequest);
+	Statistic& windowed = parameterStatistics.statisticsMap[4];
+
+	Message windowRequest =
+	    Message(ParameterStatisticsService::ServiceType,
+	            ParameterStatisticsService::MessageType::SetParameterStatisticsWindowLengths, Message::TC, 1);
+	windowRequest.appendUint16(2);
+	windowRequest.append<ParameterId>(4);
+	windowRequest.appendUint32(3000);
+	windowRequest.append<ParameterId>(5);
+	windowRequest.appendUint32(3000);
+	MessageParser::execute(windowRequest);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::GetNonExistingParameter) == 1);
+
+	if constexpr (not SupportsSlidingWindowStatistics) {
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidStatisticsWindowLength) == 1);
+		CHECK_FALSE(windowed.isWindowed());
+
+		ServiceTests::reset();
+		Services.reset();
+		return;
+	}
+	REQUIRE(windowed.isWindowed());
+	ServiceTests::resetErrors();
+
+	double values[6] = {9, 1, 4, 6, 5, 2};
+	for (int i = 0; i < 6; i++) {
+		windowed.updateStatistics(values[i], startTime - std::chrono::seconds(5 - i));
+	}
+	CHECK(windowed.getSampleCount() == 4);
+	CHECK(windowed.sampleCounter == 0);
+	parameterStatistics.statisticsMap[7].updateStatistics(3, startTime - std::chrono::seconds(1));
+
+	parameterStatistics.reportParameterStatistics(false);
+	REQUIRE(ServiceTests::count() == 1);
+	Message report = ServiceTests::get(0);
+	CHECK(report.readUint16() == 2);
+	CHECK(report.read<ParameterId>() == 4);
+	CHECK(report.read<ParameterSampleCount>() == 4);
+	CHECK(report.read<Time::DefaultCUC>() == startTime - std::chrono::seconds(3)); // window start
+	CHECK(report.read<Time::DefaultCUC>() == startTime);                           // window end
+	CHECK(report.readFloat() == 6);                                                // max value
+	CHECK(report.read<Time::DefaultCUC>() == startTime - std::chrono::seconds(2));
+	CHECK(report.readFloat() == 2); // min value
+	CHECK(report.read<Time::DefaultCUC>() == startTime);
+	CHECK(report.readFloat() == Catch::Approx(4.25));                 // mean
+	CHECK(report.readFloat() == Catch::Approx(1.479).epsilon(0.001)); // stddev
+	checkQuantiles(report, {5, 6, 6});
+
+	// A cumulative statistic in the same report is evaluated since the last reset
+	CHECK(report.read<ParameterId>() == 7);
+	CHECK(report.read<ParameterSampleCount>() == 1);
+	CHECK(report.read<Time::DefaultCUC>() == startTime); // evaluation start
+	CHECK(report.read<Time::DefaultCUC>() == startTime); // evaluation stop
+	CHECK(report.readFloat() == 3);                      // max value
+	CHECK(report.read<Time::DefaultCUC>() == startTime - std::chrono::seconds(1));
+	CHECK(report.readFloat() == 3); // min value
+	CHECK(report.read<Time::DefaultCUC>() == startTime - std::chrono::seconds(1));
+	CHECK(report.readFloat() == 3); // mean
+	CHECK(report.readFloat() == 0); // stddev
+	checkQuantiles(report, {3, 3, 3});
+	CHECK(report.readPosition == report.dataSize);
+
+	// The window cannot hold more samples than its capacity at the sampling interval of the definition
+	Message longWindowRequest =
+	    Message(ParameterStatisticsService::ServiceType,
+	            ParameterStatisticsService::MessageType::SetParameterStatisticsWindowLengths, Message::TC, 1);
+	longWindowRequest.appendUint16(1);
+	longWindowRequest.append<ParameterId>(4);
+	longWindowRequest.appendUint32(1000 * ECSSStatisticsMaxWindowSamples);
+	MessageParser::execute(longWindowRequest);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidStatisticsWindowLength) == 1);
+	CHECK(windowed.windowLength == std::chrono::seconds(3));
+	CHECK(windowed.getSampleCount() == 4);
+
+	CHECK(windowed.setWindowLength(std::chrono::milliseconds(0)));
+	CHECK(windowed.statisticsAreInitialized());
+
+	ServiceTests::reset();
+	Services.reset();
+}
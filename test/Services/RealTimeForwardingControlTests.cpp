@@ -964,8 +964,10 @@ TEST_CASE("Delete report types from the Application Process Configuration") {
 		                Message::TC, ApplicationId);
 		uint8_t numOfApplications = 1;
 		ApplicationProcessId applicationID = 2;
+		uint8_t numOfServices = 0;
 		request.appendUint8(numOfApplications);
 		request.append<ApplicationProcessId>(applicationID);
+		request.appendUint8(numOfServices);
 		initializeAppProcessConfig();
 
 		MessageParser::execute(request);
@@ -1279,3 +1281,331 @@ TEST_CASE("Report the Application Process Configuration content") {
 		Services.reset();
 	}
 }
+
+TEST_CASE("Forwarding of reports according to the Application Process Configuration") {
+	realTimeForwarding.controlledApplications.push_back(1);
+	realTimeForwarding.controlledApplications.push_back(2);
+
+	Message addRequest(RealTimeForwardingControlService::ServiceType,
+	                   RealTimeForwardingControlService::MessageType::AddReportTypesToAppProcessConfiguration,
+	                   Message::TC, ApplicationId);
+	addRequest.appendUint8(2); // num of applications
+	addRequest.append<ApplicationProcessId>(1);
+	addRequest.appendUint8(1); // num of services
+	addRequest.append<ServiceTypeNum>(EventReportService::ServiceType);
+	addRequest.appendUint8(1); // num of messages
+	addRequest.append<MessageTypeNum>(EventReportService::MessageType::InformativeEventReport);
+	addRequest.append<ApplicationProcessId>(2);
+	addRequest.appendUint8(1); // num of services
+	addRequest.append<ServiceTypeNum>(HousekeepingService::ServiceType);
+	addRequest.appendUint8(0); // all the report types of the service
+
+	SECTION("Only the configured report types are forwarded") {
+		MessageParser::execute(addRequest);
+		CHECK(ServiceTests::count() == 0);
+
+		Services.eventReport.informativeEventReport(EventReportService::UnknownEvent, "");
+		Services.eventReport.lowSeverityAnomalyReport(EventReportService::UnknownEvent, "");
+		REQUIRE(ServiceTests::count() == 1);
+		CHECK(ServiceTests::get(0).messageType == EventReportService::MessageType::InformativeEventReport);
+
+		CHECK(realTimeForwarding.isForwarded(Message(HousekeepingService::ServiceType,
+		                                             HousekeepingService::MessageType::HousekeepingParametersReport, Message::TM, 2)));
+		CHECK_FALSE(realTimeForwarding.isForwarded(Message(EventReportService::ServiceType,
+		                                                   EventReportService::MessageType::InformativeEventReport, Message::TM, 2)));
+		CHECK_FALSE(realTimeForwarding.isForwarded(Message(HousekeepingService::ServiceType,
+		                                                   HousekeepingService::MessageType::HousekeepingParametersReport, Message::TM, 1)));
+
+		// Applications without definitions, and telecommands, are not filtered
+		CHECK(realTimeForwarding.isForwarded(Message(EventReportService::ServiceType,
+		                                             EventReportService::MessageType::LowSeverityAnomalyReport, Message::TM, 3)));
+		CHECK(realTimeForwarding.isForwarded(Message(EventReportService::ServiceType,
+		                                             EventReportService::MessageType::LowSeverityAnomalyReport, Message::TC, 1)));
+	}
+
+	SECTION("Deleting an application process stops filtering its reports") {
+		MessageParser::execute(addRequest);
+
+		Message deleteRequest(RealTimeForwardingControlService::ServiceType,
+		                      RealTimeForwardingControlService::MessageType::DeleteReportTypesFromAppProcessConfiguration,
+		                      Message::TC, ApplicationId);
+		deleteRequest.appendUint8(1); // num of applications
+		deleteRequest.append<ApplicationProcessId>(1);
+		deleteRequest.appendUint8(0); // all the services of the application
+		MessageParser::execute(deleteRequest);
+
+		auto& definitions = realTimeForwarding.applicationProcessConfiguration.definitions;
+		REQUIRE(definitions.size() == 1);
+		CHECK(definitions.begin()->first.first == 2);
+
+		Services.eventReport.lowSeverityAnomalyReport(EventReportService::UnknownEvent, "");
+		CHECK(ServiceTests::count() == 1);
+		CHECK_FALSE(realTimeForwarding.isForwarded(Message(EventReportService::ServiceType,
+		                                                   EventReportService::MessageType::InformativeEventReport, Message::TM, 2)));
+	}
+
+	SECTION("Emptying the configuration stops all filtering") {
+		MessageParser::execute(addRequest);
+
+		Message deleteRequest(RealTimeForwardingControlService::ServiceType,
+		                      RealTimeForwardingControlService::MessageType::DeleteReportTypesFromAppProcessConfiguration,
+		                      Message::TC, ApplicationId);
+		deleteRequest.appendUint8(0);
+		MessageParser::execute(deleteRequest);
+
+		CHECK(realTimeForwarding.isForwarded(Message(EventReportService::ServiceType,
+		                                             EventReportService::MessageType::InformativeEventReport, Message::TM, 2)));
+		CHECK(realTimeForwarding.isForwarded(Message(HousekeepingService::ServiceType,
+		                                             HousekeepingService::MessageType::HousekeepingParametersReport, Message::TM, 1)));
+	}
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+/**
+ * Creates a housekeeping parameter report of application process 1 for a structure.
+ */
+Message housekeepingReport(ParameterReportStructureId structureId) {
+	Message report(HousekeepingService::ServiceType, HousekeepingService::MessageType::HousekeepingParametersReport,
+	               Message::TM, 1);
+	report.append<ParameterReportStructureId>(structureId);
+	return report;
+}
+
+TEST_CASE("Housekeeping Parameter Report configuration") {
+	realTimeForwarding.controlledApplications.push_back(1);
+
+	Message addRequest(RealTimeForwardingControlService::ServiceType,
+	                   RealTimeForwardingControlService::MessageType::AddStructuresToHousekeepingConfiguration,
+	                   Message::TC, ApplicationId);
+	addRequest.appendUint8(2); // num of applications
+	addRequest.append<ApplicationProcessId>(1);
+	addRequest.appendUint8(3); // num of structures
+	addRequest.append<ParameterReportStructureId>(4);
+	addRequest.appendUint16(1);
+	addRequest.append<ParameterReportStructureId>(7);
+	addRequest.appendUint16(3);
+	addRequest.append<ParameterReportStructureId>(9);
+	addRequest.appendUint16(0);
+	addRequest.append<ApplicationProcessId>(2);
+	addRequest.appendUint8(1); // num of structures
+	addRequest.append<ParameterReportStructureId>(4);
+	addRequest.appendUint16(1);
+
+	SECTION("Structures are added with their subsampling rates") {
+		MessageParser::execute(addRequest);
+
+		CHECK(ServiceTests::count() == 2);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::InvalidSubsamplingRate) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::NotControlledApplication) == 1);
+
+		auto& definitions = realTimeForwarding.housekeepingReportConfiguration.definitions;
+		REQUIRE(definitions.size() == 1);
+		CHECK(definitions[0].applicationID == 1);
+		CHECK(definitions[0].numberOfStructures == 2);
+		CHECK(definitions[0].subsamplingRates[4] == 1);
+		CHECK(definitions[0].subsamplingRates[7] == 3);
+		CHECK(definitions[0].subsamplingRates[9] == 0);
+
+		ServiceTests::resetErrors();
+		Message reportRequest(RealTimeForwardingControlService::ServiceType,
+		                      RealTimeForwardingControlService::MessageType::ReportHousekeepingConfigurationContent,
+		                      Message::TC, ApplicationId);
+		MessageParser::execute(reportRequest);
+
+		REQUIRE(ServiceTests::count() == 1);
+		Message report = ServiceTests::get(0);
+		CHECK(report.messageType == RealTimeForwardingControlService::MessageType::HousekeepingConfigurationContentReport);
+		CHECK(report.readUint8() == 1);                            // num of applications
+		CHECK(report.read<ApplicationProcessId>() == 1);
+		CHECK(report.readUint8() == 2);                            // num of structures
+		CHECK(report.read<ParameterReportStructureId>() == 4);
+		CHECK(report.readUint16() == 1);
+		CHECK(report.read<ParameterReportStructureId>() == 7);
+		CHECK(report.readUint16() == 3);
+	}
+
+	SECTION("Reports are subsampled per structure") {
+		MessageParser::execute(addRequest);
+		ServiceTests::resetErrors();
+
+		for (int i = 0; i < 3; i++) {
+			CHECK(realTimeForwarding.isForwarded(housekeepingReport(4)));
+		}
+
+		CHECK(realTimeForwarding.isForwarded(housekeepingReport(7)));
+		CHECK_FALSE(realTimeForwarding.isForwarded(housekeepingReport(7)));
+		CHECK_FALSE(realTimeForwarding.isForwarded(housekeepingReport(7)));
+		CHECK(realTimeForwarding.isForwarded(housekeepingReport(7)));
+
+		// Structures outside the configuration of a configured application are not forwarded
+		CHECK_FALSE(realTimeForwarding.isForwarded(housekeepingReport(9)));
+
+		Message otherApplication(HousekeepingService::ServiceType,
+		                         HousekeepingService::MessageType::HousekeepingParametersReport, Message::TM, 3);
+		otherApplication.append<ParameterReportStructureId>(9);
+		CHECK(realTimeForwarding.isForwarded(otherApplication));
+	}
+
+	SECTION("Structures are deleted from the configuration") {
+		MessageParser::execute(addRequest);
+		ServiceTests::resetErrors();
+
+		Message deleteRequest(RealTimeForwardingControlService::ServiceType,
+		                      RealTimeForwardingControlService::MessageType::DeleteStructuresFromHousekeepingConfiguration,
+		                      Message::TC, ApplicationId);
+		deleteRequest.appendUint8(2); // num of applications
+		deleteRequest.append<ApplicationProcessId>(1);
+		deleteRequest.appendUint8(2); // num of structures
+		deleteRequest.append<ParameterReportStructureId>(7);
+		deleteRequest.append<ParameterReportStructureId>(9);
+		deleteRequest.append<ApplicationProcessId>(2);
+		deleteRequest.appendUint8(1);
+		deleteRequest.append<ParameterReportStructureId>(4);
+		MessageParser::execute(deleteRequest);
+
+		CHECK(ServiceTests::count() == 2);
+		CHECK(ServiceTests::countThrownErrors(
+		          ErrorHandler::ExecutionStartErrorType::NonExistentHousekeepingStructureDefinition) == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::NonExistentApplicationProcess) == 1);
+		CHECK_FALSE(realTimeForwarding.isForwarded(housekeepingReport(7)));
+		CHECK(realTimeForwarding.isForwarded(housekeepingReport(4)));
+
+		// Deleting the last structure of an application stops filtering its reports
+		ServiceTests::resetErrors();
+		Message deleteLast(RealTimeForwardingControlService::ServiceType,
+		                   RealTimeForwardingControlService::MessageType::DeleteStructuresFromHousekeepingConfiguration,
+		                   Message::TC, ApplicationId);
+		deleteLast.appendUint8(1);
+		deleteLast.append<ApplicationProcessId>(1);
+		deleteLast.appendUint8(1);
+		deleteLast.append<ParameterReportStructureId>(4);
+		MessageParser::execute(deleteLast);
+
+		CHECK(ServiceTests::count() == 0);
+		CHECK(realTimeForwarding.housekeepingReportConfiguration.definitions.empty());
+		CHECK(realTimeForwarding.isForwarded(housekeepingReport(7)));
+	}
+
+	SECTION("Max number of structures per application") {
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::AddStructuresToHousekeepingConfiguration,
+		                Message::TC, ApplicationId);
+		request.appendUint8(1);
+		request.append<ApplicationProcessId>(1);
+		request.appendUint8(ECSSMaxHousekeepingStructures + 1);
+		for (uint8_t structureId = 0; structureId <= ECSSMaxHousekeepingStructures; structureId++) {
+			request.append<ParameterReportStructureId>(structureId);
+			request.appendUint16(2);
+		}
+		MessageParser::execute(request);
+
+		CHECK(ServiceTests::count() == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::MaxHousekeepingStructuresReached) == 1);
+		CHECK(realTimeForwarding.housekeepingReportConfiguration.definitions[0].numberOfStructures ==
+		      ECSSMaxHousekeepingStructures);
+	}
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Event Report Blocking configuration") {
+	realTimeForwarding.controlledApplications.push_back(1);
+
+	Message addRequest(RealTimeForwardingControlService::ServiceType,
+	                   RealTimeForwardingControlService::MessageType::AddEventDefinitionsToEventReportConfiguration,
+	                   Message::TC, ApplicationId);
+	addRequest.appendUint8(1); // num of applications
+	addRequest.append<ApplicationProcessId>(1);
+	addRequest.appendUint8(4); // num of events
+	addRequest.append<EventDefinitionId>(EventReportService::UnknownEvent);
+	addRequest.append<EventDefinitionId>(ECSSEventCatalogueSize - 1);
+	addRequest.append<EventDefinitionId>(ECSSEventCatalogueSize);
+	addRequest.append<EventDefinitionId>(EventReportService::UnknownEvent);
+
+	SECTION("Blocked events are not forwarded") {
+		MessageParser::execute(addRequest);
+
+		CHECK(ServiceTests::count() == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::UnknownEventDefinitionId) == 1);
+		ServiceTests::resetErrors();
+
+		Services.eventReport.informativeEventReport(EventReportService::UnknownEvent, "");
+		Services.eventReport.highSeverityAnomalyReport(EventReportService::UnknownEvent, "");
+		CHECK(ServiceTests::count() == 0);
+		Services.eventReport.informativeEventReport(EventReportService::WWDGReset, "");
+		CHECK(ServiceTests::count() == 1);
+
+		Message report(EventReportService::ServiceType, EventReportService::MessageType::LowSeverityAnomalyReport,
+		               Message::TM, 1);
+		report.append<EventDefinitionId>(ECSSEventCatalogueSize - 1);
+		CHECK_FALSE(realTimeForwarding.isForwarded(report));
+
+		ServiceTests::resetErrors();
+		Message reportRequest(RealTimeForwardingControlService::ServiceType,
+		                      RealTimeForwardingControlService::MessageType::ReportEventReportConfigurationContent,
+		                      Message::TC, ApplicationId);
+		MessageParser::execute(reportRequest);
+
+		REQUIRE(ServiceTests::count() == 1);
+		Message content = ServiceTests::get(0);
+		CHECK(content.messageType == RealTimeForwardingControlService::MessageType::EventReportConfigurationContentReport);
+		CHECK(content.readUint8() == 1);                // num of applications
+		CHECK(content.read<ApplicationProcessId>() == 1);
+		CHECK(content.readUint8() == 2);                // num of events
+		CHECK(content.read<EventDefinitionId>() == EventReportService::UnknownEvent);
+		CHECK(content.read<EventDefinitionId>() == ECSSEventCatalogueSize - 1);
+	}
+
+	SECTION("Event definitions are deleted from the configuration") {
+		MessageParser::execute(addRequest);
+		ServiceTests::resetErrors();
+
+		Message deleteRequest(RealTimeForwardingControlService::ServiceType,
+		                      RealTimeForwardingControlService::MessageType::DeleteEventDefinitionsFromEventReportConfiguration,
+		                      Message::TC, ApplicationId);
+		deleteRequest.appendUint8(1);
+		deleteRequest.append<ApplicationProcessId>(1);
+		deleteRequest.appendUint8(2);
+		deleteRequest.append<EventDefinitionId>(EventReportService::UnknownEvent);
+		deleteRequest.append<EventDefinitionId>(EventReportService::WWDGReset);
+		MessageParser::execute(deleteRequest);
+
+		CHECK(ServiceTests::count() == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::NonExistentEventDefinition) == 1);
+		ServiceTests::resetErrors();
+
+		Services.eventReport.informativeEventReport(EventReportService::UnknownEvent, "");
+		CHECK(ServiceTests::count() == 1);
+
+		Message clearRequest(RealTimeForwardingControlService::ServiceType,
+		                     RealTimeForwardingControlService::MessageType::DeleteEventDefinitionsFromEventReportConfiguration,
+		                     Message::TC, ApplicationId);
+		clearRequest.appendUint8(0);
+		MessageParser::execute(clearRequest);
+		CHECK(realTimeForwarding.eventReportBlockingConfiguration.definitions.empty());
+	}
+
+	SECTION("Max number of blocked events per application") {
+		Message request(RealTimeForwardingControlService::ServiceType,
+		                RealTimeForwardingControlService::MessageType::AddEventDefinitionsToEventReportConfiguration,
+		                Message::TC, ApplicationId);
+		request.appendUint8(1);
+		request.append<ApplicationProcessId>(1);
+		request.appendUint8(ECSSMaxEventDefinitionIDs + 1);
+		for (EventDefinitionId eventID = 1; eventID <= ECSSMaxEventDefinitionIDs + 1; eventID++) {
+			request.append<EventDefinitionId>(eventID);
+		}
+		MessageParser::execute(request);
+
+		CHECK(ServiceTests::count() == 1);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::ExecutionStartErrorType::MaxEventDefinitionsReached) == 1);
+		CHECK(realTimeForwarding.eventReportBlockingConfiguration.definitions[0].numberOfEvents ==
+		      ECSSMaxEventDefinitionIDs);
+	}
+
+	ServiceTests::reset();
+	Services.reset();
+}
@@ -1,5 +1,7 @@
 #include <Message.hpp>
+#include <MessageParser.hpp>
 #include <Services/RequestVerificationService.hpp>
+#include <Services/TestService.hpp>
 #include <catch2/catch_all.hpp>
 #include "ServiceTests.hpp"
 
@@ -8,6 +10,7 @@ RequestVerificationService& reqVerifService = Services.requestVerification;
 
 TEST_CASE("TM[1,1]", "[service][st01]") {
 	Message receivedMessage = Message(RequestVerificationService::ServiceType, RequestVerificationService::MessageType::SuccessfulAcceptanceReport, Message::TC, 3);
+	receivedMessage.acknowledgementFlags = Message::AcknowledgeAcceptance;
 	reqVerifService.successAcceptanceVerification(receivedMessage);
 	REQUIRE(ServiceTests::hasOneMessage());
 
@@ -51,6 +54,7 @@ TEST_CASE("TM[1,2]", "[service][st01]") {
 
 TEST_CASE("TM[1,3]", "[service][st01]") {
 	Message receivedMessage = Message(RequestVerificationService::ServiceType, RequestVerificationService::MessageType::SuccessfulStartOfExecution, Message::TC, 3);
+	receivedMessage.acknowledgementFlags = Message::AcknowledgeStart;
 	reqVerifService.successStartExecutionVerification(receivedMessage);
 	REQUIRE(ServiceTests::hasOneMessage());
 
@@ -94,6 +98,7 @@ TEST_CASE("TM[1,4]", "[service][st01]") {
 
 TEST_CASE("TM[1,5]", "[service][st01]") {
 	Message receivedMessage = Message(RequestVerificationService::ServiceType, RequestVerificationService::MessageType::SuccessfulProgressOfExecution, Message::TC, 3);
+	receivedMessage.acknowledgementFlags = Message::AcknowledgeProgress;
 	reqVerifService.successProgressExecutionVerification(receivedMessage, 0);
 	REQUIRE(ServiceTests::hasOneMessage());
 
@@ -139,6 +144,7 @@ TEST_CASE("TM[1,6]", "[service][st01]") {
 
 TEST_CASE("TM[1,7]", "[service][st01]") {
 	Message receivedMessage = Message(RequestVerificationService::ServiceType, RequestVerificationService::MessageType::SuccessfulCompletionOfExecution, Message::TC, 3);
+	receivedMessage.acknowledgementFlags = Message::AcknowledgeCompletion;
 	reqVerifService.successCompletionExecutionVerification(receivedMessage);
 	REQUIRE(ServiceTests::hasOneMessage());
 
@@ -218,3 +224,61 @@ TEST_CASE("assembleReportMessage", "[service][st01]"){
 
 }
 
+
+TEST_CASE("Request ID with a non-zero APID and sequence count", "[service][st01]") {
+	Message receivedMessage = Message(TestService::ServiceType, TestService::MessageType::AreYouAliveTest, Message::TC, 0x5a5);
+	receivedMessage.packetSequenceCount = 0x2bcd;
+	Message report = Message(RequestVerificationService::ServiceType, RequestVerificationService::MessageType::FailedRoutingReport, Message::TM, 3);
+
+	reqVerifService.assembleReportMessage(receivedMessage, report);
+
+	REQUIRE(report.dataSize == 4);
+	CHECK(report.readEnumerated(reqVerifService.CCSDSPacketVersionBits) == CCSDSPacketVersion);
+	CHECK(report.readEnumerated(reqVerifService.PacketTypeBits) == Message::TC);
+	CHECK(report.readBits(reqVerifService.SecondaryHeaderFlagBits) == 1);
+	CHECK(report.readEnumerated(reqVerifService.ApplicationIdBits) == 0x5a5);
+	CHECK(report.readEnumerated(reqVerifService.ECSSSequenceFlagsBits) == ECSSSequenceFlags);
+	CHECK(report.readBits(reqVerifService.PacketSequenceCountBits) == 0x2bcd);
+}
+
+TEST_CASE("Acknowledgement flags", "[service][st01]") {
+	SECTION("Successful reports are only generated when requested") {
+		Message request(TestService::ServiceType, TestService::MessageType::AreYouAliveTest, Message::TC, 3);
+		request.acknowledgementFlags = Message::AcknowledgeAcceptance | Message::AcknowledgeCompletion;
+
+		reqVerifService.successAcceptanceVerification(request);
+		reqVerifService.successStartExecutionVerification(request);
+		reqVerifService.successProgressExecutionVerification(request, 0);
+		reqVerifService.successCompletionExecutionVerification(request);
+
+		REQUIRE(ServiceTests::count() == 2);
+		CHECK(ServiceTests::get(0).messageType == RequestVerificationService::MessageType::SuccessfulAcceptanceReport);
+		CHECK(ServiceTests::get(1).messageType == RequestVerificationService::MessageType::SuccessfulCompletionOfExecution);
+	}
+
+	SECTION("Failures are always reported") {
+		Message request(TestService::ServiceType, TestService::MessageType::AreYouAliveTest, Message::TC, 3);
+
+		reqVerifService.failAcceptanceVerification(request, ErrorHandler::UnknownAcceptanceError);
+		reqVerifService.failStartExecutionVerification(request, ErrorHandler::UnknownExecutionStartError);
+		reqVerifService.failProgressExecutionVerification(request, ErrorHandler::UnknownExecutionProgressError, 0);
+		reqVerifService.failCompletionExecutionVerification(request, ErrorHandler::UnknownExecutionCompletionError);
+		reqVerifService.failRoutingVerification(request, ErrorHandler::UnknownRoutingError);
+
+		CHECK(ServiceTests::count() == 5);
+	}
+
+	SECTION("The flags are parsed from and composed into the TC header") {
+		Message request(TestService::ServiceType, TestService::MessageType::AreYouAliveTest, Message::TC, 3);
+		request.acknowledgementFlags = Message::AcknowledgeStart | Message::AcknowledgeProgress;
+
+		auto packet = MessageParser::compose(request);
+		CHECK((static_cast<uint8_t>(packet[CCSDSPrimaryHeaderSize]) & 0x0fU) == 0b0110);
+		const Message parsed = MessageParser::parseEmbeddedTC(reinterpret_cast<uint8_t*>(packet.data()), packet.size());
+		CHECK(parsed.acknowledgementFlags == (Message::AcknowledgeStart | Message::AcknowledgeProgress));
+		CHECK(parsed.isAcknowledgementRequested(Message::AcknowledgeStart));
+		CHECK_FALSE(parsed.isAcknowledgementRequested(Message::AcknowledgeCompletion));
+	}
+
+	ServiceTests::reset();
+}
@@ -2,6 +2,7 @@
 #include <catch2/catch_all.hpp>
 #include "ServiceTests.hpp"
 
+#include <chrono>
 #include <ctime>
 #include <vector>
 
@@ -22,18 +23,36 @@ namespace unit_test {
 		}
 
 		/*
-		 * Read the private member scheduled activities and since it is a list and it can't be
-		 * accessed, get each element and save it to a vector.
+		 * Read the private member scheduled activities and since it is a heap and it can't be
+		 * iterated in order, get each element in release order and save it to a vector.
 		 */
 		static auto scheduledActivities(TimeBasedSchedulingService& tmService) {
 			std::vector<TimeBasedSchedulingService::ScheduledActivity*> listElements;
 
-			std::transform(
-			    tmService.scheduledActivities.begin(), tmService.scheduledActivities.end(),
-			    std::back_inserter(listElements), [](auto& activity) -> auto { return &activity; });
+			tmService.scheduledActivities.forEachInReleaseOrder([&listElements](auto /* index */, auto& activity) {
+				listElements.push_back(&activity);
+			});
 
 			return listElements; // Return the list elements
 		}
+
+		/*
+		 * Parse the request packet of a scheduled activity, which is stored in the service.
+		 */
+		static Message request(TimeBasedSchedulingService& tmService, const TimeBasedSchedulingService::ScheduledActivity& activity) {
+			const auto packet = tmService.scheduledRequests.get(activity.request);
+			return MessageParser::parseEmbeddedTC(packet.data(), packet.size());
+		}
+
+		/*
+		 * Index the scheduled activities again by their request ID, after a test has modified them directly.
+		 */
+		static void rebuildRequestIDIndex(TimeBasedSchedulingService& tmService) {
+			tmService.requestIDIndex.clear();
+			tmService.scheduledActivities.forEach([&tmService](auto index, auto& activity) {
+				tmService.requestIDIndex.insert(activity.requestID, index);
+			});
+		}
 	};
 } // namespace unit_test
 
@@ -73,24 +92,29 @@ auto activityInsertion(TimeBasedSchedulingService& timeService) {
 	}
 
 	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+	receivedMessage.append<SubScheduleId>(0); // Sub-schedule of the activities
 	receivedMessage.appendUint16(4); // Total number of requests
 	receivedMessage.sourceId = 0;    // todo(#276): proper handling of sourceID when globally integrated
 
 	// Test activity 1
+	receivedMessage.append<SchedulingGroupId>(TimeBasedSchedulingService::DefaultGroup);
 	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 155643s);
-	receivedMessage.appendMessage(testMessage1, ECSSTCRequestStringSize);
+	receivedMessage.appendPacket(testMessage1);
 
 	// Test activity 2
+	receivedMessage.append<SchedulingGroupId>(TimeBasedSchedulingService::DefaultGroup);
 	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 195723s);
-	receivedMessage.appendMessage(testMessage2, ECSSTCRequestStringSize);
+	receivedMessage.appendPacket(testMessage2);
 
 	// Test activity 3
+	receivedMessage.append<SchedulingGroupId>(TimeBasedSchedulingService::DefaultGroup);
 	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 172643s);
-	receivedMessage.appendMessage(testMessage3, ECSSTCRequestStringSize);
+	receivedMessage.appendPacket(testMessage3);
 
 	// Test activity 4
+	receivedMessage.append<SchedulingGroupId>(TimeBasedSchedulingService::DefaultGroup);
 	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 1724843s);
-	receivedMessage.appendMessage(testMessage4, ECSSTCRequestStringSize);
+	receivedMessage.appendPacket(testMessage4);
 
 	// Insert activities in the schedule. They have to be inserted sorted
 	timeService.insertActivities(receivedMessage);
@@ -142,6 +166,47 @@ TEST_CASE("Execute the first activity, removes it from the list and return the r
 	REQUIRE(iterationCount == 0);
 }
 
+TEST_CASE("Execute all the due activities in one call, within the release budget") {
+	Services.reset();
+	currentTime = TimeGetter::getCurrentTimeDefaultCUC();
+	constexpr uint16_t ActivityCount = 10;
+	static_assert(ActivityCount > ECSSMaxTimeSchedReleasesPerTick);
+
+	Message areYouAlive(17, 1, Message::TC, 1);
+	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+	receivedMessage.append<SubScheduleId>(0); // Sub-schedule of the activities
+	receivedMessage.appendUint16(ActivityCount);
+	for (uint16_t i = 0; i < ActivityCount - 1; i++) {
+		receivedMessage.append<SchedulingGroupId>(TimeBasedSchedulingService::DefaultGroup);
+		receivedMessage.appendDefaultCUCTimeStamp(currentTime + 100s);
+		receivedMessage.appendPacket(areYouAlive);
+	}
+	receivedMessage.append<SchedulingGroupId>(TimeBasedSchedulingService::DefaultGroup);
+	receivedMessage.appendDefaultCUCTimeStamp(currentTime + 200s);
+	receivedMessage.appendPacket(areYouAlive);
+	timeBasedService.insertActivities(receivedMessage);
+
+	CHECK(timeBasedService.executeScheduledActivity(currentTime + 99s) == currentTime + 100s);
+	CHECK(ServiceTests::count() == 0);
+
+	CHECK(timeBasedService.executeScheduledActivity(currentTime + 105s) == currentTime + 100s);
+	CHECK(ServiceTests::count() == ECSSMaxTimeSchedReleasesPerTick);
+	CHECK(timeBasedService.releaseBudgetExhaustedCount == 1);
+	CHECK(timeBasedService.lateReleaseCount == ECSSMaxTimeSchedReleasesPerTick);
+	CHECK(timeBasedService.maximumReleaseDelay == 5000);
+
+	CHECK(timeBasedService.executeScheduledActivity(currentTime + 105s) == currentTime + 200s);
+	CHECK(ServiceTests::count() == ActivityCount - 1);
+	CHECK(timeBasedService.releaseBudgetExhaustedCount == 1);
+
+	CHECK(timeBasedService.executeScheduledActivity(currentTime + 200s) == Time::DefaultCUC::max());
+	CHECK(ServiceTests::count() == ActivityCount);
+	CHECK(timeBasedService.lateReleaseCount == ActivityCount - 1);
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
 TEST_CASE("TC[11,1] Enable Schedule Execution", "[service][st11]") {
 	Services.reset();
 	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::EnableTimeBasedScheduleExecutionFunction, Message::TC, 1);
@@ -169,20 +234,38 @@ TEST_CASE("TC[11,4] Activity Insertion", "[service][st11]") {
 	REQUIRE(scheduledActivities.at(2)->requestReleaseTime == currentTime + 195723s);
 	REQUIRE(scheduledActivities.at(3)->requestReleaseTime == currentTime + 1724843s);
 
-	REQUIRE(testMessage1.bytesEqualWith(scheduledActivities.at(0)->request));
-	REQUIRE(testMessage3.bytesEqualWith(scheduledActivities.at(1)->request));
-	REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(2)->request));
-	REQUIRE(testMessage4.bytesEqualWith(scheduledActivities.at(3)->request));
+	REQUIRE(testMessage1.bytesEqualWith(unit_test::Tester::request(timeBasedService, *scheduledActivities.at(0))));
+	REQUIRE(testMessage3.bytesEqualWith(unit_test::Tester::request(timeBasedService, *scheduledActivities.at(1))));
+	REQUIRE(testMessage2.bytesEqualWith(unit_test::Tester::request(timeBasedService, *scheduledActivities.at(2))));
+	REQUIRE(testMessage4.bytesEqualWith(unit_test::Tester::request(timeBasedService, *scheduledActivities.at(3))));
 
 	SECTION("Error throw test") {
 		Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+		receivedMessage.append<SubScheduleId>(0); // Sub-schedule of the activities
 		receivedMessage.appendUint16(1); // Total number of requests
 
+		receivedMessage.append<SchedulingGroupId>(TimeBasedSchedulingService::DefaultGroup);
 		receivedMessage.appendDefaultCUCTimeStamp(currentTime - 155643s);
+		receivedMessage.appendPacket(testMessage1);
 		MessageParser::execute(receivedMessage); //timeService.insertActivities(receivedMessage);
 
 		REQUIRE(ServiceTests::thrownError(ErrorHandler::InstructionExecutionStartError));
 	}
+
+	SECTION("Truncated request") {
+		Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+		receivedMessage.append<SubScheduleId>(0); // Sub-schedule of the activities
+		receivedMessage.appendUint16(1); // Total number of requests
+
+		receivedMessage.append<SchedulingGroupId>(TimeBasedSchedulingService::DefaultGroup);
+		receivedMessage.appendDefaultCUCTimeStamp(currentTime + 155643s);
+		receivedMessage.appendPacket(testMessage1);
+		receivedMessage.dataSize -= 1;
+		MessageParser::execute(receivedMessage);
+
+		REQUIRE(ServiceTests::thrownError(ErrorHandler::MessageTooShort));
+		REQUIRE(unit_test::Tester::scheduledActivities(timeBasedService).size() == 4);
+	}
 }
 
 TEST_CASE("TC[11,15] Time shift all scheduled activities", "[service][st11]") {
@@ -231,6 +314,7 @@ TEST_CASE("TC[11,7] Time shift activities by ID", "[service][st11]") {
 
 	auto scheduledActivities = activityInsertion(timeBasedService);
 	scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+	unit_test::Tester::rebuildRequestIDIndex(timeBasedService);
 	CHECK(scheduledActivities.size() == 4);
 
 	constexpr Time::RelativeTime timeShift = 67890000; // Relative time-shift value
@@ -247,7 +331,7 @@ TEST_CASE("TC[11,7] Time shift activities by ID", "[service][st11]") {
 
 		// Make sure the new value is inserted sorted
 		REQUIRE(scheduledActivities.at(3)->requestReleaseTime == currentTime + 195723s + std::chrono::seconds(timeShift));
-		REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(3)->request));
+		REQUIRE(testMessage2.bytesEqualWith(unit_test::Tester::request(timeBasedService, *scheduledActivities.at(3))));
 	}
 
 	SECTION("Negative Shift") {
@@ -262,7 +346,7 @@ TEST_CASE("TC[11,7] Time shift activities by ID", "[service][st11]") {
 
 		// Output should be sorted
 		REQUIRE(scheduledActivities.at(1)->requestReleaseTime == currentTime + 195723s - 25000s);
-		REQUIRE(testMessage2.bytesEqualWith(scheduledActivities.at(1)->request));
+		REQUIRE(testMessage2.bytesEqualWith(unit_test::Tester::request(timeBasedService, *scheduledActivities.at(1))));
 	}
 
 	SECTION("Error throw on wrong request ID") {
@@ -299,6 +383,7 @@ TEST_CASE("TC[11,9] Detail report scheduled activities by ID", "[service][st11]"
 		CHECK(scheduledActivities.size() == 4);
 		scheduledActivities.at(0)->requestID.applicationID = 8; // Append a dummy application ID
 		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::rebuildRequestIDIndex(timeBasedService);
 
 		receivedMessage.appendUint16(2);                                          // Two instructions in the request
 		receivedMessage.append<SourceId>(0);                                      // Source ID is not implemented
@@ -319,18 +404,18 @@ TEST_CASE("TC[11,9] Detail report scheduled activities by ID", "[service][st11]"
 		uint16_t iterationCount = response.readUint16();
 		CHECK(iterationCount == 2);
 		for (uint16_t i = 0; i < iterationCount; i++) {
+			CHECK(response.read<SubScheduleId>() == 0);
+			CHECK(response.read<SchedulingGroupId>() == TimeBasedSchedulingService::DefaultGroup);
 			Time::DefaultCUC receivedReleaseTime(response.readDefaultCUCTimeStamp());
 
-			Message receivedTCPacket;
-			uint8_t receivedDataStr[ECSSTCRequestStringSize];
-			response.readString(receivedDataStr, ECSSTCRequestStringSize);
-			receivedTCPacket = MessageParser::parseECSSTC(receivedDataStr);
+			const auto receivedPacket = response.readPacket();
+			Message receivedTCPacket = MessageParser::parseEmbeddedTC(receivedPacket.data(), receivedPacket.size());
 			if (i == 0) {
 				REQUIRE(receivedReleaseTime == scheduledActivities.at(0)->requestReleaseTime);
-				REQUIRE(receivedTCPacket == scheduledActivities.at(0)->request);
+				REQUIRE(receivedTCPacket == unit_test::Tester::request(timeBasedService, *scheduledActivities.at(0)));
 			} else {
 				REQUIRE(receivedReleaseTime == scheduledActivities.at(2)->requestReleaseTime);
-				REQUIRE(receivedTCPacket == scheduledActivities.at(2)->request);
+				REQUIRE(receivedTCPacket == unit_test::Tester::request(timeBasedService, *scheduledActivities.at(2)));
 			}
 		}
 	}
@@ -357,6 +442,7 @@ TEST_CASE("TM[11,10] time-based schedule detail report", "[service][st11]") {
 		CHECK(scheduledActivities.size() == 4);
 		scheduledActivities.at(0)->requestID.applicationID = 8; // Append a dummy application ID
 		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::rebuildRequestIDIndex(timeBasedService);
 
 		receivedMessage.appendUint16(2);                                          // Two instructions in the request
 		receivedMessage.append<SourceId>(0);                                      // Source ID is not implemented
@@ -377,18 +463,18 @@ TEST_CASE("TM[11,10] time-based schedule detail report", "[service][st11]") {
 		uint16_t iterationCount = response.readUint16();
 		CHECK(iterationCount == 2);
 		for (uint16_t i = 0; i < iterationCount; i++) {
+			CHECK(response.read<SubScheduleId>() == 0);
+			CHECK(response.read<SchedulingGroupId>() == TimeBasedSchedulingService::DefaultGroup);
 			Time::DefaultCUC receivedReleaseTime(response.readDefaultCUCTimeStamp());
 
-			Message receivedTCPacket;
-			uint8_t receivedDataStr[ECSSTCRequestStringSize];
-			response.readString(receivedDataStr, ECSSTCRequestStringSize);
-			receivedTCPacket = MessageParser::parseECSSTC(receivedDataStr);
+			const auto receivedPacket = response.readPacket();
+			Message receivedTCPacket = MessageParser::parseEmbeddedTC(receivedPacket.data(), receivedPacket.size());
 			if (i == 0) {
 				REQUIRE(receivedReleaseTime == scheduledActivities.at(0)->requestReleaseTime);
-				REQUIRE(receivedTCPacket == scheduledActivities.at(0)->request);
+				REQUIRE(receivedTCPacket == unit_test::Tester::request(timeBasedService, *scheduledActivities.at(0)));
 			} else {
 				REQUIRE(receivedReleaseTime == scheduledActivities.at(2)->requestReleaseTime);
-				REQUIRE(receivedTCPacket == scheduledActivities.at(2)->request);
+				REQUIRE(receivedTCPacket == unit_test::Tester::request(timeBasedService, *scheduledActivities.at(2)));
 			}
 		}
 	}
@@ -405,6 +491,7 @@ TEST_CASE("TC[11,12] Summary report scheduled activities by ID", "[service][st11
 		CHECK(scheduledActivities.size() == 4);
 		scheduledActivities.at(0)->requestID.applicationID = 8; // Append a dummy application ID
 		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::rebuildRequestIDIndex(timeBasedService);
 
 		receivedMessage.appendUint16(2);                                          // Two instructions in the request
 		receivedMessage.append<SourceId>(0);                                      // Source ID is not implemented
@@ -424,6 +511,8 @@ TEST_CASE("TC[11,12] Summary report scheduled activities by ID", "[service][st11
 
 		uint16_t iterationCount = response.readUint16();
 		for (uint16_t i = 0; i < iterationCount; i++) {
+			CHECK(response.read<SubScheduleId>() == 0);
+			CHECK(response.read<SchedulingGroupId>() == TimeBasedSchedulingService::DefaultGroup);
 			Time::DefaultCUC receivedReleaseTime(response.readDefaultCUCTimeStamp());
 			SourceId receivedSourceID = response.read<SourceId>();
 			ApplicationProcessId receivedApplicationID = response.read<ApplicationProcessId>();
@@ -465,6 +554,7 @@ TEST_CASE("TM[11,13] time-based schedule summary report", "[service][st11]") {
 		CHECK(scheduledActivities.size() == 4);
 		scheduledActivities.at(0)->requestID.applicationID = 8; // Append a dummy application ID
 		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::rebuildRequestIDIndex(timeBasedService);
 
 		receivedMessage.appendUint16(2);                                          // Two instructions in the request
 		receivedMessage.append<SourceId>(0);                                      // Source ID is not implemented
@@ -484,6 +574,8 @@ TEST_CASE("TM[11,13] time-based schedule summary report", "[service][st11]") {
 
 		uint16_t iterationCount = response.readUint16();
 		for (uint16_t i = 0; i < iterationCount; i++) {
+			CHECK(response.read<SubScheduleId>() == 0);
+			CHECK(response.read<SchedulingGroupId>() == TimeBasedSchedulingService::DefaultGroup);
 			Time::DefaultCUC receivedReleaseTime(response.readDefaultCUCTimeStamp());
 			SourceId receivedSourceID = response.read<SourceId>();
 			ApplicationProcessId receivedApplicationID = response.read<ApplicationProcessId>();
@@ -520,14 +612,14 @@ TEST_CASE("TC[11,16] Detail report all scheduled activities", "[service][st11]")
 	REQUIRE(iterationCount == scheduledActivities.size());
 
 	for (uint16_t i = 0; i < iterationCount; i++) {
+		CHECK(response.read<SubScheduleId>() == 0);
+		CHECK(response.read<SchedulingGroupId>() == TimeBasedSchedulingService::DefaultGroup);
 		Time::DefaultCUC receivedReleaseTime(response.readDefaultCUCTimeStamp());
 
-		Message receivedTCPacket;
-		uint8_t receivedDataStr[ECSSTCRequestStringSize];
-		response.readString(receivedDataStr, ECSSTCRequestStringSize);
-		receivedTCPacket = MessageParser::parseECSSTC(receivedDataStr);
+		const auto receivedPacket = response.readPacket();
+		Message receivedTCPacket = MessageParser::parseEmbeddedTC(receivedPacket.data(), receivedPacket.size());
 		REQUIRE(receivedReleaseTime == scheduledActivities.at(i)->requestReleaseTime);
-		REQUIRE(receivedTCPacket.bytesEqualWith(scheduledActivities.at(i)->request));
+		REQUIRE(receivedTCPacket.bytesEqualWith(unit_test::Tester::request(timeBasedService, *scheduledActivities.at(i))));
 	}
 }
 
@@ -541,6 +633,7 @@ TEST_CASE("TC[11,5] Activity deletion by ID", "[service][st11]") {
 		// Verify that everything is in place
 		CHECK(scheduledActivities.size() == 4);
 		scheduledActivities.at(2)->requestID.applicationID = 4; // Append a dummy application ID
+		unit_test::Tester::rebuildRequestIDIndex(timeBasedService);
 
 		receivedMessage.appendUint16(1);                                          // Just one instruction to delete an activity
 		receivedMessage.append<SourceId>(0);                                      // Source ID is not implemented
@@ -553,7 +646,7 @@ TEST_CASE("TC[11,5] Activity deletion by ID", "[service][st11]") {
 
 		REQUIRE(scheduledActivities.size() == 3);
 		REQUIRE(scheduledActivities.at(2)->requestReleaseTime == currentTime + 1724843s);
-		REQUIRE(testMessage4.bytesEqualWith(scheduledActivities.at(2)->request));
+		REQUIRE(testMessage4.bytesEqualWith(unit_test::Tester::request(timeBasedService, *scheduledActivities.at(2))));
 	}
 
 	SECTION("Error throw on wrong request ID") {
@@ -579,3 +672,497 @@ TEST_CASE("TC[11,3] Reset schedule", "[service][st11]") {
 	REQUIRE(scheduledActivities.empty());
 	REQUIRE(not unit_test::Tester::executionFunctionStatus(timeBasedService));
 }
+
+/*
+ * Insert one TC[17,1] activity in a sub-schedule and a group
+ */
+void insertAreYouAliveActivity(SubScheduleId subScheduleID, SchedulingGroupId groupID, Time::DefaultCUC releaseTime,
+                               SequenceCount sequenceCount = 0) {
+	Message areYouAlive(17, 1, Message::TC, 1);
+	Message receivedMessage(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::InsertActivities, Message::TC, 1);
+	receivedMessage.packetSequenceCount = sequenceCount;
+	receivedMessage.append<SubScheduleId>(subScheduleID);
+	receivedMessage.appendUint16(1);
+	receivedMessage.append<SchedulingGroupId>(groupID);
+	receivedMessage.appendDefaultCUCTimeStamp(releaseTime);
+	receivedMessage.appendPacket(areYouAlive);
+	MessageParser::execute(receivedMessage);
+}
+
+/*
+ * Build a TC that lists sub-schedule or group identifiers
+ */
+Message identifierListRequest(TimeBasedSchedulingService::MessageType messageType, std::initializer_list<uint8_t> identifiers) {
+	Message request(TimeBasedSchedulingService::ServiceType, messageType, Message::TC, 1);
+	request.appendUint16(identifiers.size());
+	for (const uint8_t identifier: identifiers) {
+		request.appendUint8(identifier);
+	}
+	return request;
+}
+
+Message createGroupsRequest(std::initializer_list<std::pair<SchedulingGroupId, bool>> groups) {
+	Message request(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::CreateSchedulingGroups, Message::TC, 1);
+	request.appendUint16(groups.size());
+	for (const auto& [groupID, status]: groups) {
+		request.append<SchedulingGroupId>(groupID);
+		request.appendBoolean(status);
+	}
+	return request;
+}
+
+TEST_CASE("TC[11,22] Create scheduling groups", "[service][st11]") {
+	Services.reset();
+
+	SECTION("Valid groups") {
+		Message request = createGroupsRequest({{3, true}, {7, false}});
+		MessageParser::execute(request);
+
+		Message reportRequest(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportSchedulingGroupStatus, Message::TC, 1);
+		MessageParser::execute(reportRequest);
+		REQUIRE(ServiceTests::hasOneMessage());
+
+		Message report = ServiceTests::get(0);
+		CHECK(report.messageType == TimeBasedSchedulingService::MessageType::SchedulingGroupStatusReport);
+		REQUIRE(report.readUint16() == 3);
+		CHECK(report.read<SchedulingGroupId>() == TimeBasedSchedulingService::DefaultGroup);
+		CHECK(report.readBoolean());
+		CHECK(report.read<SchedulingGroupId>() == 3);
+		CHECK(report.readBoolean());
+		CHECK(report.read<SchedulingGroupId>() == 7);
+		CHECK(not report.readBoolean());
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Existing group") {
+		Message request = createGroupsRequest({{TimeBasedSchedulingService::DefaultGroup, true}});
+		MessageParser::execute(request);
+		CHECK(ServiceTests::thrownError(ErrorHandler::SchedulingGroupAlreadyExists));
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Out of range group") {
+		Message request = createGroupsRequest({{ECSSMaxTimeSchedGroups, true}});
+		MessageParser::execute(request);
+		CHECK(ServiceTests::thrownError(ErrorHandler::InvalidSchedulingGroupId));
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("TC[11,23] Delete scheduling groups", "[service][st11]") {
+	Services.reset();
+	currentTime = TimeGetter::getCurrentTimeDefaultCUC();
+	Message request = createGroupsRequest({{1, true}, {2, true}});
+	MessageParser::execute(request);
+	insertAreYouAliveActivity(0, 2, currentTime + 100s);
+
+	SECTION("Empty group") {
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::DeleteSchedulingGroups, {1});
+		MessageParser::execute(request);
+
+		insertAreYouAliveActivity(0, 1, currentTime + 100s);
+		CHECK(ServiceTests::thrownError(ErrorHandler::InvalidSchedulingGroupId));
+		CHECK(unit_test::Tester::scheduledActivities(timeBasedService).size() == 1);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Group with activities") {
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::DeleteSchedulingGroups, {2});
+		MessageParser::execute(request);
+		CHECK(ServiceTests::thrownError(ErrorHandler::SchedulingGroupIsNotEmpty));
+
+		const auto requestID = unit_test::Tester::scheduledActivities(timeBasedService).at(0)->requestID;
+		request = Message(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DeleteActivitiesById, Message::TC, 1);
+		request.appendUint16(1);
+		request.append<SourceId>(requestID.sourceID);
+		request.append<ApplicationProcessId>(requestID.applicationID);
+		request.append<SequenceCount>(requestID.sequenceCount);
+		MessageParser::execute(request);
+		CHECK(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::DeleteSchedulingGroups, {2});
+		MessageParser::execute(request);
+		insertAreYouAliveActivity(0, 2, currentTime + 100s);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidSchedulingGroupId) == 1);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Default group") {
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::DeleteSchedulingGroups, {TimeBasedSchedulingService::DefaultGroup});
+		MessageParser::execute(request);
+		CHECK(ServiceTests::thrownError(ErrorHandler::InvalidSchedulingGroupId));
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("All groups") {
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::DeleteSchedulingGroups, {});
+		MessageParser::execute(request);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::SchedulingGroupIsNotEmpty) == 1);
+
+		Message reportRequest(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportSchedulingGroupStatus, Message::TC, 1);
+		MessageParser::execute(reportRequest);
+		Message report = ServiceTests::get(1); // The first message is the failed start of execution report
+		REQUIRE(report.readUint16() == 2);
+		CHECK(report.read<SchedulingGroupId>() == TimeBasedSchedulingService::DefaultGroup);
+		report.readBoolean();
+		CHECK(report.read<SchedulingGroupId>() == 2);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("TC[11,24] and TC[11,25] Enable and disable scheduling groups", "[service][st11]") {
+	Services.reset();
+	currentTime = TimeGetter::getCurrentTimeDefaultCUC();
+	Message request = createGroupsRequest({{1, true}, {2, true}});
+	MessageParser::execute(request);
+	insertAreYouAliveActivity(0, 1, currentTime + 100s);
+	insertAreYouAliveActivity(0, 2, currentTime + 100s);
+	insertAreYouAliveActivity(0, TimeBasedSchedulingService::DefaultGroup, currentTime + 100s);
+
+	SECTION("Disabled group") {
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::DisableSchedulingGroups, {1});
+		MessageParser::execute(request);
+
+		timeBasedService.executeScheduledActivity(currentTime + 100s);
+		CHECK(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+		CHECK(ServiceTests::count() == 2);
+		CHECK(timeBasedService.discardedActivityCount == 1);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Group enabled again before the release") {
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::DisableSchedulingGroups, {});
+		MessageParser::execute(request);
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::EnableSchedulingGroups, {2});
+		MessageParser::execute(request);
+
+		timeBasedService.executeScheduledActivity(currentTime + 100s);
+		CHECK(ServiceTests::count() == 1);
+		CHECK(timeBasedService.discardedActivityCount == 2);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("All groups enabled") {
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::DisableSchedulingGroups, {1, 2});
+		MessageParser::execute(request);
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::EnableSchedulingGroups, {});
+		MessageParser::execute(request);
+
+		timeBasedService.executeScheduledActivity(currentTime + 100s);
+		CHECK(ServiceTests::count() == 3);
+		CHECK(timeBasedService.discardedActivityCount == 0);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Group that does not exist") {
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::EnableSchedulingGroups, {5});
+		MessageParser::execute(request);
+		CHECK(ServiceTests::thrownError(ErrorHandler::InvalidSchedulingGroupId));
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("TC[11,20] and TC[11,21] Enable and disable sub-schedules", "[service][st11]") {
+	Services.reset();
+	currentTime = TimeGetter::getCurrentTimeDefaultCUC();
+	insertAreYouAliveActivity(0, TimeBasedSchedulingService::DefaultGroup, currentTime + 100s);
+	insertAreYouAliveActivity(4, TimeBasedSchedulingService::DefaultGroup, currentTime + 100s);
+
+	SECTION("Disabled sub-schedule") {
+		Message request = identifierListRequest(TimeBasedSchedulingService::MessageType::DisableSubSchedules, {4});
+		MessageParser::execute(request);
+
+		timeBasedService.executeScheduledActivity(currentTime + 100s);
+		CHECK(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+		CHECK(ServiceTests::count() == 1);
+		CHECK(timeBasedService.discardedActivityCount == 1);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("All sub-schedules") {
+		Message request = identifierListRequest(TimeBasedSchedulingService::MessageType::DisableSubSchedules, {});
+		MessageParser::execute(request);
+		request = identifierListRequest(TimeBasedSchedulingService::MessageType::EnableSubSchedules, {0});
+		MessageParser::execute(request);
+
+		Message reportRequest(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportSubScheduleStatus, Message::TC, 1);
+		MessageParser::execute(reportRequest);
+		Message report = ServiceTests::get(0);
+		CHECK(report.messageType == TimeBasedSchedulingService::MessageType::SubScheduleStatusReport);
+		REQUIRE(report.readUint16() == ECSSMaxTimeSchedSubSchedules);
+		for (SubScheduleId subScheduleID = 0; subScheduleID < ECSSMaxTimeSchedSubSchedules; subScheduleID++) {
+			CHECK(report.read<SubScheduleId>() == subScheduleID);
+			CHECK(report.readBoolean() == (subScheduleID == 0));
+		}
+
+		timeBasedService.executeScheduledActivity(currentTime + 100s);
+		CHECK(ServiceTests::count() == 2);
+		CHECK(timeBasedService.discardedActivityCount == 1);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Sub-schedule that does not exist") {
+		Message request = identifierListRequest(TimeBasedSchedulingService::MessageType::EnableSubSchedules, {ECSSMaxTimeSchedSubSchedules});
+		MessageParser::execute(request);
+		CHECK(ServiceTests::thrownError(ErrorHandler::InvalidSubScheduleId));
+
+		insertAreYouAliveActivity(ECSSMaxTimeSchedSubSchedules, TimeBasedSchedulingService::DefaultGroup, currentTime + 100s);
+		CHECK(ServiceTests::countThrownErrors(ErrorHandler::InvalidSubScheduleId) == 2);
+		CHECK(unit_test::Tester::scheduledActivities(timeBasedService).size() == 2);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("TC[11,3] Reset schedule deletes the groups and enables the sub-schedules", "[service][st11]") {
+	Services.reset();
+	Message request = createGroupsRequest({{1, true}});
+	MessageParser::execute(request);
+	request = identifierListRequest(TimeBasedSchedulingService::MessageType::DisableSubSchedules, {});
+	MessageParser::execute(request);
+	request = identifierListRequest(TimeBasedSchedulingService::MessageType::DisableSchedulingGroups, {});
+	MessageParser::execute(request);
+
+	Message resetRequest(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ResetTimeBasedSchedule, Message::TC, 1);
+	MessageParser::execute(resetRequest);
+
+	Message reportRequest(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportSchedulingGroupStatus, Message::TC, 1);
+	MessageParser::execute(reportRequest);
+	Message report = ServiceTests::get(0);
+	REQUIRE(report.readUint16() == 1);
+	CHECK(report.read<SchedulingGroupId>() == TimeBasedSchedulingService::DefaultGroup);
+	CHECK(report.readBoolean());
+
+	reportRequest = Message(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportSubScheduleStatus, Message::TC, 1);
+	MessageParser::execute(reportRequest);
+	report = ServiceTests::get(1);
+	REQUIRE(report.readUint16() == ECSSMaxTimeSchedSubSchedules);
+	for (SubScheduleId subScheduleID = 0; subScheduleID < ECSSMaxTimeSchedSubSchedules; subScheduleID++) {
+		CHECK(report.read<SubScheduleId>() == subScheduleID);
+		CHECK(report.readBoolean());
+	}
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+/*
+ * Describe the scheduled activities by release order, to compare a schedule before and after a restart
+ */
+std::vector<std::tuple<uint32_t, SchedulingGroupId, std::vector<uint8_t>>> scheduleContents() {
+	std::vector<std::tuple<uint32_t, SchedulingGroupId, std::vector<uint8_t>>> contents;
+	for (auto* activity: unit_test::Tester::scheduledActivities(timeBasedService)) {
+		const auto packet = MessageParser::composeECSS(unit_test::Tester::request(timeBasedService, *activity));
+		contents.emplace_back(activity->requestReleaseTime.formatAsBytes(), activity->groupID,
+		                      std::vector<uint8_t>(packet.begin(), packet.end()));
+	}
+	return contents;
+}
+
+TEST_CASE("Time-based schedule journal", "[service][st11]") {
+	Services.reset();
+	std::vector<uint8_t> region(4096);
+	timeBasedService.attachJournal(region);
+
+	auto scheduledActivities = activityInsertion(timeBasedService);
+	Message request = createGroupsRequest({{1, false}});
+	MessageParser::execute(request);
+	insertAreYouAliveActivity(0, 1, currentTime + 160000s);
+	request = identifierListRequest(TimeBasedSchedulingService::MessageType::DisableSubSchedules, {3});
+	MessageParser::execute(request);
+
+	request = Message(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::TimeShiftALlScheduledActivities, Message::TC, 1);
+	request.append<Time::RelativeTime>(10);
+	MessageParser::execute(request);
+	timeBasedService.executeScheduledActivity(currentTime + 155653s);
+	REQUIRE(unit_test::Tester::scheduledActivities(timeBasedService).size() == 4);
+
+	SECTION("Restart") {
+		const auto contents = scheduleContents();
+		Services.reset();
+		CHECK(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+
+		timeBasedService.attachJournal(region);
+		CHECK(scheduleContents() == contents);
+
+		request = Message(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportSchedulingGroupStatus, Message::TC, 1);
+		MessageParser::execute(request);
+		request = Message(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ReportSubScheduleStatus, Message::TC, 1);
+		MessageParser::execute(request);
+		Message report = ServiceTests::get(0);
+		REQUIRE(report.readUint16() == 2);
+		report.read<SchedulingGroupId>();
+		report.readBoolean();
+		CHECK(report.read<SchedulingGroupId>() == 1);
+		CHECK(not report.readBoolean());
+		report = ServiceTests::get(1);
+		report.readUint16();
+		for (SubScheduleId subScheduleID = 0; subScheduleID < ECSSMaxTimeSchedSubSchedules; subScheduleID++) {
+			CHECK(report.read<SubScheduleId>() == subScheduleID);
+			CHECK(report.readBoolean() == (subScheduleID != 3));
+		}
+
+		// The restored schedule keeps being journaled
+		insertAreYouAliveActivity(0, TimeBasedSchedulingService::DefaultGroup, currentTime + 170000s);
+		const auto newContents = scheduleContents();
+		Services.reset();
+		timeBasedService.attachJournal(region);
+		CHECK(scheduleContents() == newContents);
+		CHECK(newContents.size() == 5);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Compaction") {
+		const auto contents = scheduleContents();
+		timeBasedService.compactJournal();
+		Services.reset();
+		timeBasedService.attachJournal(region);
+		CHECK(scheduleContents() == contents);
+
+		// Fill the journal many times over, so that it is compacted whenever it is full
+		for (SequenceCount sequenceCount = 1; sequenceCount <= 100; sequenceCount++) {
+			insertAreYouAliveActivity(0, TimeBasedSchedulingService::DefaultGroup, currentTime + 170000s, sequenceCount);
+			request = Message(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DeleteActivitiesById, Message::TC, 1);
+			request.appendUint16(1);
+			request.append<SourceId>(0);
+			request.append<ApplicationProcessId>(ApplicationId);
+			request.append<SequenceCount>(sequenceCount);
+			MessageParser::execute(request);
+		}
+		CHECK(scheduleContents() == contents);
+		Services.reset();
+		timeBasedService.attachJournal(region);
+		CHECK(scheduleContents() == contents);
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+
+	SECTION("Reset") {
+		request = Message(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::ResetTimeBasedSchedule, Message::TC, 1);
+		MessageParser::execute(request);
+		Services.reset();
+		timeBasedService.attachJournal(region);
+		CHECK(unit_test::Tester::scheduledActivities(timeBasedService).empty());
+
+		ServiceTests::reset();
+		Services.reset();
+	}
+}
+
+TEST_CASE("Time-based schedule journal without space for a snapshot", "[service][st11]") {
+	Services.reset();
+	std::vector<uint8_t> region(300);
+	timeBasedService.attachJournal(region);
+	currentTime = TimeGetter::getCurrentTimeDefaultCUC();
+
+	const auto deleteActivity = [](SequenceCount sequenceCount) {
+		Message request(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::DeleteActivitiesById, Message::TC, 1);
+		request.appendUint16(1);
+		request.append<SourceId>(0);
+		request.append<ApplicationProcessId>(ApplicationId);
+		request.append<SequenceCount>(sequenceCount);
+		MessageParser::execute(request);
+	};
+
+	// Insert activities until the journal is full and the snapshot of the schedule does not fit either
+	auto journaledContents = scheduleContents();
+	SequenceCount sequenceCount = 0;
+	while (ServiceTests::countThrownErrors(ErrorHandler::ScheduleJournalIsFull) == 0) {
+		journaledContents = scheduleContents();
+		sequenceCount++;
+		REQUIRE(sequenceCount < ECSSMaxNumberOfTimeSchedActivities);
+		insertAreYouAliveActivity(0, TimeBasedSchedulingService::DefaultGroup, currentTime + 170000s + std::chrono::seconds(sequenceCount),
+		                          sequenceCount);
+	}
+	REQUIRE(sequenceCount > 1);
+
+	// Every later change is dropped and reported, even one that is small enough for the space left in the journal
+	Message request(TimeBasedSchedulingService::ServiceType, TimeBasedSchedulingService::MessageType::EnableTimeBasedScheduleExecutionFunction, Message::TC, 1);
+	MessageParser::execute(request);
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::ScheduleJournalIsFull) == 2);
+	const std::vector<uint8_t> droppedChangesRegion = region;
+
+	// Once the schedule shrinks enough, a snapshot is written and the journal is up to date again
+	for (SequenceCount deleted = sequenceCount; deleted > 1; deleted--) {
+		deleteActivity(deleted);
+	}
+	CHECK(ServiceTests::countThrownErrors(ErrorHandler::ScheduleJournalIsFull) >= 3);
+	const auto contents = scheduleContents();
+	REQUIRE(contents.size() == 1);
+
+	std::vector<uint8_t> restartedRegion = droppedChangesRegion;
+	Services.reset();
+	timeBasedService.attachJournal(restartedRegion);
+	CHECK(scheduleContents() == journaledContents);
+	CHECK(not unit_test::Tester::executionFunctionStatus(timeBasedService));
+
+	Services.reset();
+	timeBasedService.attachJournal(region);
+	CHECK(scheduleContents() == contents);
+	CHECK(unit_test::Tester::executionFunctionStatus(timeBasedService));
+
+	ServiceTests::reset();
+	Services.reset();
+}
+
+TEST_CASE("Time-based schedule journal benchmark", "[.][benchmark]") {
+	Services.reset();
+	// Enough space for a snapshot of a full schedule in each area, with room for the records that follow it
+	std::vector<uint8_t> region(ECSSMaxNumberOfTimeSchedActivities * 128U);
+	timeBasedService.attachJournal(region);
+	currentTime = TimeGetter::getCurrentTimeDefaultCUC();
+
+	const auto insertStart = std::chrono::steady_clock::now();
+	for (SequenceCount sequenceCount = 1; sequenceCount <= ECSSMaxNumberOfTimeSchedActivities; sequenceCount++) {
+		insertAreYouAliveActivity(0, TimeBasedSchedulingService::DefaultGroup, currentTime + 170000s + std::chrono::seconds(sequenceCount),
+		                          sequenceCount);
+	}
+	const auto insertTime = std::chrono::steady_clock::now() - insertStart;
+	const auto contents = scheduleContents();
+	REQUIRE(contents.size() == ECSSMaxNumberOfTimeSchedActivities);
+
+	Services.reset();
+	const auto restoreStart = std::chrono::steady_clock::now();
+	timeBasedService.attachJournal(region);
+	const auto restoreTime = std::chrono::steady_clock::now() - restoreStart;
+	CHECK(scheduleContents() == contents);
+
+	using Microseconds = std::chrono::duration<double, std::micro>;
+	const double insertMicroseconds = Microseconds(insertTime).count() / ECSSMaxNumberOfTimeSchedActivities;
+	const double restoreMicroseconds = Microseconds(restoreTime).count();
+	WARN("TC[11,4] with journal: " << insertMicroseconds << " us per activity, restore of "
+	                               << ECSSMaxNumberOfTimeSchedActivities << " activities: " << restoreMicroseconds << " us");
+
+	ServiceTests::reset();
+	Services.reset();
+}
@@ -4,6 +4,7 @@
 #include <Logger.hpp>
 #include <Message.hpp>
 #include <Service.hpp>
+#include <ServicePool.hpp>
 #include <catch2/catch_all.hpp>
 #include "Helpers/Demangle.hpp"
 #include <filesystem>
@@ -41,6 +42,12 @@ std::multimap<std::pair<ErrorHandler::ErrorSource, uint16_t>, bool> ServiceTests
 bool ServiceTests::expectingErrors = false;
 
 void Service::storeMessage(Message& message) {
+#ifdef SERVICE_REALTIMEFORWARDINGCONTROL
+	if (not Services.realTimeForwarding.isForwarded(message)) {
+		return;
+	}
+#endif
+
 	// Just add the message to the queue
 	ServiceTests::queue(message);
 }